@@ -17,10 +17,48 @@ AC_DEFUN([AX_LIBFSFAT_CHECK_LOCAL],
       [1])
   ])
 
+  dnl Headers included in libfsfat/libfsfat_statistics.c
+  AC_CHECK_HEADERS([sys/time.h])
+
+  dnl Functions used in libfsfat/libfsfat_statistics.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([clock_gettime gettimeofday])
+  ])
+
   dnl Check for internationalization functions in libfsfat/libfsfat_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 ])
 
+dnl Function to detect whether USDT probes should be enabled
+AC_DEFUN([AX_LIBFSFAT_CHECK_ENABLE_USDT],
+  [AX_COMMON_ARG_ENABLE(
+    [usdt],
+    [usdt],
+    [enable user-level statically defined tracing (USDT) probes],
+    [auto-detect])
+
+  AS_IF(
+    [test "x$ac_cv_enable_usdt" != xno],
+    [dnl Headers included in libfsfat/libfsfat_trace.h
+    AC_CHECK_HEADERS([sys/sdt.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_sys_sdt_h" = xyes],
+      [AC_DEFINE(
+        [HAVE_LIBFSFAT_USDT],
+        [1],
+        [Define to 1 if USDT probes should be used.])
+
+      ac_cv_enable_usdt=yes],
+      [test "x$ac_cv_enable_usdt" = xyes],
+      [AC_MSG_FAILURE(
+        [Missing header: sys/sdt.h],
+        [1])],
+      [ac_cv_enable_usdt=no])
+  ])
+])
+
 dnl Function to detect if fsfattools dependencies are available
 AC_DEFUN([AX_FSFATTOOLS_CHECK_LOCAL],
   [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
@@ -31,6 +31,17 @@
 extern "C" {
 #endif
 
+#define DIGEST_HASH_STRING_SIZE_MD5	33
+#define DIGEST_HASH_STRING_SIZE_SHA1	41
+#define DIGEST_HASH_STRING_SIZE_SHA256	65
+
+enum DIGEST_HASH_TYPES
+{
+	DIGEST_HASH_TYPE_MD5		= 0x01,
+	DIGEST_HASH_TYPE_SHA1		= 0x02,
+	DIGEST_HASH_TYPE_SHA256		= 0x04
+};
+
 int digest_hash_copy_to_string(
      const uint8_t *digest_hash,
      size_t digest_hash_size,
@@ -72,19 +72,36 @@ void usage_fprint(
 	fprintf( stream, "Use fsfatinfo to determine information about a File Allocation Table (FAT)\n"
 	                 "file system volume.\n\n" );
 
-	fprintf( stream, "Usage: fsfatinfo [ -B bodyfile ] [ -E identifier ] [ -F file_entry ]\n"
-	                 "                 [ -o offset ] [ -dhHvV ] source\n\n" );
+	fprintf( stream, "Usage: fsfatinfo [ -b read_buffer_size ] [ -B bodyfile ]\n"
+	                 "                 [ -D digest_types ] [ -E identifier ] [ -F file_entry ]\n"
+	                 "                 [ -j number_of_jobs ] [ -o offset ]\n"
+	                 "                 [ -T timeline_format ] [ -dhHvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file or device\n\n" );
 
+	fprintf( stream, "\t-b:     the maximum size of a read when hashing file entry data in\n"
+	                 "\t        bytes, where read_buffer_size is a value from 512 to\n"
+	                 "\t        67108864 (default is 4194304). Reads do not cross extent\n"
+	                 "\t        boundaries.\n" );
 	fprintf( stream, "\t-B:     output file system information as a bodyfile\n" );
 	fprintf( stream, "\t-d:     calculate a MD5 hash of a file entry to include in the\n"
 	                 "\t        bodyfile\n" );
+	fprintf( stream, "\t-D:     calculate digest (hash) types of a file entry to include in\n"
+	                 "\t        the bodyfile, options: md5, sha1, sha256, multiple types\n"
+	                 "\t        are separated by a comma. SHA1 and SHA256 hashes are\n"
+	                 "\t        added as additional columns.\n" );
 	fprintf( stream, "\t-E:     show information about a specific identifier.\n" );
 	fprintf( stream, "\t-F:     show information about a specific file entry path.\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-H:     shows the file system hierarchy\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "\t-j:     the number of concurrent hashing jobs (threads), where\n"
+	                 "\t        number_of_jobs is a value from 0 to 64, where 0 hashes\n"
+	                 "\t        on the main thread (default is 4)\n" );
+#endif
 	fprintf( stream, "\t-o:     specify the volume offset\n" );
+	fprintf( stream, "\t-T:     specify the format of the bodyfile, options: bodyfile\n"
+	                 "\t        (default), csv, jsonl (JSON Lines)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -143,8 +160,12 @@ int main( int argc, char * const argv[] )
 {
 	libfsfat_error_t *error                          = NULL;
 	system_character_t *option_bodyfile              = NULL;
+	system_character_t *option_digest_types          = NULL;
 	system_character_t *option_file_entry_identifier = NULL;
 	system_character_t *option_file_entry_path       = NULL;
+	system_character_t *option_number_of_jobs        = NULL;
+	system_character_t *option_read_buffer_size      = NULL;
+	system_character_t *option_timeline_format       = NULL;
 	system_character_t *option_volume_offset         = NULL;
 	system_character_t *source                       = NULL;
 	char *program                                    = "fsfatinfo";
@@ -188,7 +209,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = fsfattools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "B:dE:F:hHo:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "b:B:dD:E:F:hHj:o:T:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -204,6 +225,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				option_read_buffer_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'B':
 				option_bodyfile = optarg;
 
@@ -214,6 +240,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'D':
+				option_digest_types = optarg;
+
+				break;
+
 			case (system_integer_t) 'E':
 				option_mode                  = FSFATINFO_MODE_FILE_ENTRY_BY_IDENTIFIER;
 				option_file_entry_identifier = optarg;
@@ -237,11 +268,21 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
 				break;
 
+			case (system_integer_t) 'T':
+				option_timeline_format = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -300,6 +341,62 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_timeline_format != NULL )
+	{
+		if( info_handle_set_timeline_format(
+		     fsfatinfo_info_handle,
+		     option_timeline_format,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set timeline format.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_digest_types != NULL )
+	{
+		if( info_handle_set_digest_types(
+		     fsfatinfo_info_handle,
+		     option_digest_types,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set digest types.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_number_of_jobs != NULL )
+	{
+		if( info_handle_set_number_of_hashing_threads(
+		     fsfatinfo_info_handle,
+		     option_number_of_jobs,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_read_buffer_size != NULL )
+	{
+		if( info_handle_set_hash_read_buffer_size(
+		     fsfatinfo_info_handle,
+		     option_read_buffer_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set read buffer size.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_volume_offset != NULL )
 	{
 		if( info_handle_set_volume_offset(
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
 
@@ -66,14 +67,22 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use fsfatmount to mount a File Allocation Table (FAT) file system volume\n\n" );
 
-	fprintf( stream, "Usage: fsfatmount [ -o offset ] [ -X extended_options ] [ -hvV ] volume\n"
-	                 "                  mount_point\n\n" );
+	fprintf( stream, "Usage: fsfatmount [ -C cache_timeout ] [ -o offset ]\n"
+	                 "                  [ -t number_of_threads ] [ -X extended_options ]\n"
+	                 "                  [ -hvV ] volume mount_point\n\n" );
 
 	fprintf( stream, "\tvolume:      a File Allocation Table (FAT) file system volume\n\n" );
 	fprintf( stream, "\tmount_point: the directory to serve as mount point\n\n" );
 
+	fprintf( stream, "\t-C:          specify the number of seconds entries, attributes and data can be\n"
+	                 "\t             cached, where 0 represents the defaults of the sub system\n"
+	                 "\t             (default is 0)\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
 	fprintf( stream, "\t-o:          specify the volume offset in bytes\n" );
+	fprintf( stream, "\t-t:          specify the number of threads used to serve requests, where\n"
+	                 "\t             1 represents single-threaded (default is 1), other values\n"
+	                 "\t             let the sub system start threads on demand and are used\n"
+	                 "\t             as a hint of the number of idle threads to keep\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr, while fsfatmount will remain running in the\n"
 	                 "\t             foreground\n" );
 	fprintf( stream, "\t-V:          print version\n" );
@@ -132,15 +141,17 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libfsfat_error_t *error                     = NULL;
-	system_character_t *mount_point             = NULL;
-	system_character_t *option_extended_options = NULL;
-	system_character_t *option_offset           = NULL;
-	system_character_t *source                  = NULL;
-	char *program                               = "fsfatmount";
-	system_integer_t option                     = 0;
-	int result                                  = 0;
-	int verbose                                 = 0;
+	libfsfat_error_t *error                      = NULL;
+	system_character_t *mount_point              = NULL;
+	system_character_t *option_cache_timeout     = NULL;
+	system_character_t *option_extended_options  = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_offset            = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "fsfatmount";
+	system_integer_t option                      = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 	struct fuse_operations fsfatmount_fuse_operations;
@@ -154,9 +165,14 @@ int main( int argc, char * const argv[] )
 #else
 	struct fuse_args fsfatmount_fuse_arguments = FUSE_ARGS_INIT(0, NULL);
 	struct fuse_chan *fsfatmount_fuse_channel  = NULL;
+	char fuse_timeout_options[ 128 ];
 #endif
 	struct fuse *fsfatmount_fuse_handle        = NULL;
 
+#if defined( HAVE_LIBFUSE3 ) && ( FUSE_USE_VERSION >= 32 )
+	struct fuse_loop_config fsfatmount_fuse_loop_config;
+#endif
+
 #elif defined( HAVE_LIBDOKAN )
 	DOKAN_OPERATIONS fsfatmount_dokan_operations;
 	DOKAN_OPTIONS fsfatmount_dokan_options;
@@ -195,7 +211,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = fsfattools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:vVX:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "C:ho:t:vVX:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -211,6 +227,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'C':
+				option_cache_timeout = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
@@ -222,6 +243,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -297,6 +323,34 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		if( mount_handle_set_number_of_threads(
+		     fsfatmount_mount_handle,
+		     option_number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_cache_timeout != NULL )
+	{
+		if( mount_handle_set_cache_timeout(
+		     fsfatmount_mount_handle,
+		     option_cache_timeout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache timeout.\n" );
+
+			goto on_error;
+		}
+	}
 	if( mount_handle_open(
 	     fsfatmount_mount_handle,
 	     source,
@@ -349,6 +403,83 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+#if !defined( HAVE_LIBFUSE3 )
+	/* Report the file entry identifiers as inode numbers
+	 */
+	if( fsfatmount_fuse_arguments.argc == 0 )
+	{
+		/* This argument is required but ignored
+		 */
+		if( fuse_opt_add_arg(
+		     &fsfatmount_fuse_arguments,
+		     "" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fuse_opt_add_arg(
+	     &fsfatmount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &fsfatmount_fuse_arguments,
+	     "use_ino" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fsfatmount_mount_handle->cache_timeout > 0 )
+	{
+		if( narrow_string_snprintf(
+		     fuse_timeout_options,
+		     128,
+		     "entry_timeout=%d,attr_timeout=%d,negative_timeout=%d",
+		     fsfatmount_mount_handle->cache_timeout,
+		     fsfatmount_mount_handle->cache_timeout,
+		     fsfatmount_mount_handle->cache_timeout ) < 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create fuse timeout options.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &fsfatmount_fuse_arguments,
+		     "-o" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &fsfatmount_fuse_arguments,
+		     fuse_timeout_options ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+#endif /* !defined( HAVE_LIBFUSE3 ) */
+
 	if( memory_set(
 	     &fsfatmount_fuse_operations,
 	     0,
@@ -369,6 +500,14 @@ int main( int argc, char * const argv[] )
 	fsfatmount_fuse_operations.getattr    = &mount_fuse_getattr;
 	fsfatmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( HAVE_LIBFUSE3 ) || ( defined( HAVE_LIBFUSE ) && ( FUSE_VERSION >= 29 ) )
+	fsfatmount_fuse_operations.read_buf   = &mount_fuse_read_buf;
+#endif
+
+#if defined( HAVE_LIBFUSE3 )
+	fsfatmount_fuse_operations.init       = &mount_fuse_init;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	fsfatmount_fuse_handle = fuse_new(
 	                          &fsfatmount_fuse_arguments,
@@ -438,8 +577,38 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          fsfatmount_fuse_handle );
+	if( fsfatmount_mount_handle->number_of_threads <= 1 )
+	{
+		result = fuse_loop(
+		          fsfatmount_fuse_handle );
+	}
+	else
+	{
+		/* The multi-threaded loop starts worker threads on demand, so that
+		 * a slow read does not block requests of other processes, libfuse
+		 * only uses the number of threads as the maximum number of idle threads
+		 */
+#if defined( HAVE_LIBFUSE3 ) && ( FUSE_USE_VERSION >= 32 )
+		fsfatmount_fuse_loop_config.clone_fd         = 0;
+		fsfatmount_fuse_loop_config.max_idle_threads = (unsigned int) fsfatmount_mount_handle->number_of_threads;
+
+		result = fuse_loop_mt(
+		          fsfatmount_fuse_handle,
+		          &fsfatmount_fuse_loop_config );
+
+#elif defined( HAVE_LIBFUSE3 )
+		/* The number of worker threads is managed by libfuse
+		 */
+		result = fuse_loop_mt(
+		          fsfatmount_fuse_handle,
+		          0 );
+#else
+		/* The number of worker threads is managed by libfuse
+		 */
+		result = fuse_loop_mt(
+		          fsfatmount_fuse_handle );
+#endif
+	}
 
 	if( result != 0 )
 	{
@@ -484,9 +653,23 @@ int main( int argc, char * const argv[] )
 	fsfatmount_dokan_options.MountPoint = mount_point;
 
 #if DOKAN_MINIMUM_COMPATIBLE_VERSION >= 200
-	fsfatmount_dokan_options.SingleThread = TRUE;
+	if( fsfatmount_mount_handle->number_of_threads <= 1 )
+	{
+		fsfatmount_dokan_options.SingleThread = TRUE;
+	}
+	else
+	{
+		fsfatmount_dokan_options.SingleThread = FALSE;
+	}
 #else
-	fsfatmount_dokan_options.ThreadCount  = 0;
+	if( fsfatmount_mount_handle->number_of_threads <= 1 )
+	{
+		fsfatmount_dokan_options.ThreadCount = 0;
+	}
+	else
+	{
+		fsfatmount_dokan_options.ThreadCount = (USHORT) fsfatmount_mount_handle->number_of_threads;
+	}
 #endif
 	if( verbose != 0 )
 	{
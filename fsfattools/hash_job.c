@@ -0,0 +1,291 @@
+/*
+ * Hash job
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "digest_hash.h"
+#include "fsfattools_libcerror.h"
+#include "fsfattools_libfsfat.h"
+#include "hash_job.h"
+
+/* Creates a hash job
+ * Make sure the value hash_job is referencing, is set to NULL
+ * The hash job takes over management of the file entry
+ * Returns 1 if successful or -1 on error
+ */
+int hash_job_initialize(
+     hash_job_t **hash_job,
+     libfsfat_file_entry_t *file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *file_entry_name,
+     size_t file_entry_name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_job_initialize";
+
+	if( hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file entry name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_job = memory_allocate_structure(
+	             hash_job_t );
+
+	if( *hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_job,
+	     0,
+	     sizeof( hash_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash job.",
+		 function );
+
+		memory_free(
+		 *hash_job );
+
+		*hash_job = NULL;
+
+		return( -1 );
+	}
+	( *hash_job )->path = system_string_allocate(
+	                       path_length + 1 );
+
+	if( ( *hash_job )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *hash_job )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_job )->path[ path_length ] = 0;
+
+	( *hash_job )->path_length = path_length;
+
+	if( file_entry_name != NULL )
+	{
+		( *hash_job )->file_entry_name = system_string_allocate(
+		                                  file_entry_name_length + 1 );
+
+		if( ( *hash_job )->file_entry_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *hash_job )->file_entry_name,
+		     file_entry_name,
+		     file_entry_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file entry name.",
+			 function );
+
+			goto on_error;
+		}
+		( *hash_job )->file_entry_name[ file_entry_name_length ] = 0;
+
+		( *hash_job )->file_entry_name_length = file_entry_name_length;
+	}
+	( *hash_job )->file_entry = file_entry;
+
+	return( 1 );
+
+on_error:
+	if( *hash_job != NULL )
+	{
+		if( ( *hash_job )->file_entry_name != NULL )
+		{
+			memory_free(
+			 ( *hash_job )->file_entry_name );
+		}
+		if( ( *hash_job )->path != NULL )
+		{
+			memory_free(
+			 ( *hash_job )->path );
+		}
+		memory_free(
+		 *hash_job );
+
+		*hash_job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash job
+ * Returns 1 if successful or -1 on error
+ */
+int hash_job_free(
+     hash_job_t **hash_job,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_job_free";
+	int result            = 1;
+
+	if( hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_job != NULL )
+	{
+		if( libfsfat_file_entry_free(
+		     &( ( *hash_job )->file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *hash_job )->file_entry_name != NULL )
+		{
+			memory_free(
+			 ( *hash_job )->file_entry_name );
+		}
+		if( ( *hash_job )->path != NULL )
+		{
+			memory_free(
+			 ( *hash_job )->path );
+		}
+		memory_free(
+		 *hash_job );
+
+		*hash_job = NULL;
+	}
+	return( result );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Hash job
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HASH_JOB_H )
+#define _HASH_JOB_H
+
+#include <common.h>
+#include <types.h>
+
+#include "digest_hash.h"
+#include "fsfattools_libcerror.h"
+#include "fsfattools_libfsfat.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct hash_job hash_job_t;
+
+struct hash_job
+{
+	/* The file entry
+	 */
+	libfsfat_file_entry_t *file_entry;
+
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The file entry name
+	 */
+	system_character_t *file_entry_name;
+
+	/* The file entry name length
+	 */
+	size_t file_entry_name_length;
+
+	/* The MD5 hash string
+	 */
+	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ];
+
+	/* The SHA1 hash string
+	 */
+	char sha1_string[ DIGEST_HASH_STRING_SIZE_SHA1 ];
+
+	/* The SHA256 hash string
+	 */
+	char sha256_string[ DIGEST_HASH_STRING_SIZE_SHA256 ];
+
+	/* The status, 0 if pending, 1 if calculated or -1 on error
+	 */
+	int status;
+};
+
+int hash_job_initialize(
+     hash_job_t **hash_job,
+     libfsfat_file_entry_t *file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *file_entry_name,
+     size_t file_entry_name_length,
+     libcerror_error_t **error );
+
+int hash_job_free(
+     hash_job_t **hash_job,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HASH_JOB_H ) */
+
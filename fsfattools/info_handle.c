@@ -32,12 +32,15 @@
 #include "fsfattools_libcerror.h"
 #include "fsfattools_libclocale.h"
 #include "fsfattools_libcnotify.h"
+#include "fsfattools_libcthreads.h"
 #include "fsfattools_libfdatetime.h"
 #include "fsfattools_libfguid.h"
 #include "fsfattools_libfsfat.h"
 #include "fsfattools_libhmac.h"
 #include "fsfattools_libuna.h"
+#include "hash_job.h"
 #include "info_handle.h"
+#include "timeline_writer.h"
 
 #if !defined( LIBFSFAT_HAVE_BFIO )
 
@@ -55,7 +58,6 @@ int libfsfat_volume_open_file_io_handle(
 
 #endif /* !defined( LIBFSFAT_HAVE_BFIO ) */
 
-#define DIGEST_HASH_STRING_SIZE_MD5	33
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
 /* Copies a string of a decimal value to a 64-bit value
@@ -287,8 +289,14 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->calculate_md5 = calculate_md5;
-	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	if( calculate_md5 != 0 )
+	{
+		( *info_handle )->digest_types = DIGEST_HASH_TYPE_MD5;
+	}
+	( *info_handle )->number_of_hashing_threads = INFO_HANDLE_DEFAULT_NUMBER_OF_HASHING_THREADS;
+	( *info_handle )->hash_read_buffer_size     = INFO_HANDLE_DEFAULT_HASH_READ_BUFFER_SIZE;
+	( *info_handle )->timeline_format           = TIMELINE_WRITER_FORMAT_BODYFILE;
+	( *info_handle )->notify_stream             = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -332,6 +340,22 @@ int info_handle_free(
 	}
 	if( *info_handle != NULL )
 	{
+		if( ( *info_handle )->hash_jobs != NULL )
+		{
+			if( info_handle_stop_hashing(
+			     *info_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop hashing.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *info_handle )->input_volume != NULL )
 		{
 			if( libfsfat_volume_free(
@@ -361,6 +385,22 @@ int info_handle_free(
 
 			result = -1;
 		}
+		if( ( *info_handle )->timeline_writer != NULL )
+		{
+			if( timeline_writer_free(
+			     &( ( *info_handle )->timeline_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free timeline writer.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *info_handle )->bodyfile_stream != NULL )
 		{
 			if( file_stream_close(
@@ -377,6 +417,11 @@ int info_handle_free(
 			}
 			( *info_handle )->bodyfile_stream = NULL;
 		}
+		if( ( *info_handle )->path_stack != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->path_stack );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -492,6 +537,302 @@ int info_handle_set_bodyfile(
 	return( 1 );
 }
 
+/* Sets the timeline format
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_timeline_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_timeline_format";
+	size_t string_length  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->timeline_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - timeline writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 8 )
+	 && ( system_string_compare_no_case(
+	       string,
+	       _SYSTEM_STRING( "bodyfile" ),
+	       8 ) == 0 ) )
+	{
+		info_handle->timeline_format = TIMELINE_WRITER_FORMAT_BODYFILE;
+	}
+	else if( ( string_length == 3 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "csv" ),
+	            3 ) == 0 ) )
+	{
+		info_handle->timeline_format = TIMELINE_WRITER_FORMAT_CSV;
+	}
+	else if( ( string_length == 5 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "jsonl" ),
+	            5 ) == 0 ) )
+	{
+		info_handle->timeline_format = TIMELINE_WRITER_FORMAT_JSONL;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported timeline format.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the digest types
+ * The string contains the digest types separated by a comma, e.g. md5,sha1,sha256
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_digest_types(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function      = "info_handle_set_digest_types";
+	size_t segment_length      = 0;
+	size_t segment_start_index = 0;
+	size_t string_index        = 0;
+	size_t string_length       = 0;
+	uint8_t digest_types       = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_start_index;
+
+		if( ( segment_length == 3 )
+		 && ( system_string_compare_no_case(
+		       &( string[ segment_start_index ] ),
+		       _SYSTEM_STRING( "md5" ),
+		       3 ) == 0 ) )
+		{
+			digest_types |= DIGEST_HASH_TYPE_MD5;
+		}
+		else if( ( segment_length == 4 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start_index ] ),
+		            _SYSTEM_STRING( "sha1" ),
+		            4 ) == 0 ) )
+		{
+			digest_types |= DIGEST_HASH_TYPE_SHA1;
+		}
+		else if( ( segment_length == 6 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start_index ] ),
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			digest_types |= DIGEST_HASH_TYPE_SHA256;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type at index: %" PRIzd ".",
+			 function,
+			 segment_start_index );
+
+			return( -1 );
+		}
+		segment_start_index = string_index + 1;
+	}
+	info_handle->digest_types |= digest_types;
+
+	return( 1 );
+}
+
+/* Sets the number of concurrent hashing jobs
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_number_of_hashing_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_hashing_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( info_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) INFO_HANDLE_MAXIMUM_NUMBER_OF_HASHING_THREADS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hashing threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->number_of_hashing_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the maximum size of a read of file entry data when hashing
+ * The size is rounded down to a multiple of 512 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_hash_read_buffer_size(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_hash_read_buffer_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( info_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit < (uint64_t) INFO_HANDLE_MINIMUM_HASH_READ_BUFFER_SIZE )
+	 || ( value_64bit > (uint64_t) INFO_HANDLE_MAXIMUM_HASH_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash read buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->hash_read_buffer_size = (size_t) ( value_64bit & ~( (uint64_t) 511 ) );
+
+	return( 1 );
+}
+
 /* Sets the volume offset
  * Returns 1 if successful or -1 on error
  */
@@ -812,24 +1153,40 @@ on_error:
 	return( -1 );
 }
 
-/* Calculates the MD5 of the contents of a file entry
+/* Calculates the digest hashes of the contents of a file entry
+ * Only the digest hashes of the digest types of the info handle are calculated
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_entry_calculate_md5(
+int info_handle_file_entry_calculate_digest_hashes(
      info_handle_t *info_handle,
      libfsfat_file_entry_t *file_entry,
      char *md5_string,
      size_t md5_string_size,
+     char *sha1_string,
+     size_t sha1_string_size,
+     char *sha256_string,
+     size_t sha256_string_size,
      libcerror_error_t **error )
 {
 	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	uint8_t read_buffer[ 4096 ];
-
-	libhmac_md5_context_t *md5_context = NULL;
-	static char *function              = "info_handle_file_entry_calculate_md5";
-	size64_t data_size                 = 0;
-	size_t read_size                   = 0;
-	ssize_t read_count                 = 0;
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	libhmac_md5_context_t *md5_context       = NULL;
+	libhmac_sha1_context_t *sha1_context     = NULL;
+	libhmac_sha256_context_t *sha256_context = NULL;
+	uint8_t *read_buffer                     = NULL;
+	static char *function                    = "info_handle_file_entry_calculate_digest_hashes";
+	size64_t data_size                       = 0;
+	size64_t extent_remaining_size           = 0;
+	size_t read_buffer_size                  = 0;
+	size_t read_size                         = 0;
+	ssize_t read_count                       = 0;
+	off64_t data_offset                      = 0;
+	off64_t extent_offset                    = 0;
+	uint32_t extent_flags                    = 0;
+	int extent_index                         = 0;
+	int number_of_extents                    = 0;
 
 	if( info_handle == NULL )
 	{
@@ -856,46 +1213,145 @@ int info_handle_file_entry_calculate_md5(
 
 		goto on_error;
 	}
-	if( libfsfat_file_entry_seek_offset(
-	     file_entry,
-	     0,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( ( info_handle->digest_types & DIGEST_HASH_TYPE_MD5 ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: 0 in file entry.",
-		 function );
-
-		goto on_error;
-	}
-	if( libhmac_md5_initialize(
-	     &md5_context,
-	     error ) != 1 )
+		if( libhmac_md5_initialize(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( info_handle->digest_types & DIGEST_HASH_TYPE_SHA1 ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize MD5 context.",
-		 function );
+		if( libhmac_sha1_initialize(
+		     &sha1_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	if( ( info_handle->digest_types & DIGEST_HASH_TYPE_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_size > 0 )
+	{
+		if( libfsfat_file_entry_get_number_of_extents(
+		     file_entry,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents.",
+			 function );
+
+			goto on_error;
+		}
+		/* The read buffer is no larger than the data, so small files
+		 * do not allocate a buffer of the maximum read size
+		 */
+		read_buffer_size = info_handle->hash_read_buffer_size;
+
+		if( (size64_t) read_buffer_size > data_size )
+		{
+			read_buffer_size = (size_t) data_size;
+		}
+		read_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * read_buffer_size );
+
+		if( read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	while( data_size > 0 )
 	{
-		read_size = 4096;
+		/* Reads do not cross an extent boundary, so every read maps onto
+		 * a single contiguous range of clusters in the volume
+		 */
+		if( extent_remaining_size == 0 )
+		{
+			if( extent_index < number_of_extents )
+			{
+				if( libfsfat_file_entry_get_extent_by_index(
+				     file_entry,
+				     extent_index,
+				     &extent_offset,
+				     &extent_remaining_size,
+				     &extent_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve extent: %d.",
+					 function,
+					 extent_index );
+
+					goto on_error;
+				}
+				extent_index++;
+			}
+			/* Data that is not covered by an extent is read in buffer sized blocks
+			 */
+			if( extent_remaining_size == 0 )
+			{
+				extent_remaining_size = data_size;
+			}
+		}
+		read_size = read_buffer_size;
 
+		if( (size64_t) read_size > extent_remaining_size )
+		{
+			read_size = (size_t) extent_remaining_size;
+		}
 		if( (size64_t) read_size > data_size )
 		{
 			read_size = (size_t) data_size;
 		}
-		read_count = libfsfat_file_entry_read_buffer(
+		read_count = libfsfat_file_entry_read_buffer_at_offset(
 		              file_entry,
 		              read_buffer,
 		              read_size,
+		              data_offset,
 		              error );
 
 		if( read_count != (ssize_t) read_size )
@@ -909,78 +1365,1081 @@ int info_handle_file_entry_calculate_md5(
 
 			goto on_error;
 		}
-		data_size -= read_size;
+		data_offset           += (off64_t) read_size;
+		data_size             -= read_size;
+		extent_remaining_size -= read_size;
+
+		if( md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     md5_context,
+			     read_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( sha1_context != NULL )
+		{
+			if( libhmac_sha1_update(
+			     sha1_context,
+			     read_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA1 hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( sha256_context != NULL )
+		{
+			if( libhmac_sha256_update(
+			     sha256_context,
+			     read_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA256 hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
 
-		if( libhmac_md5_update(
+		read_buffer = NULL;
+	}
+	if( md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
 		     md5_context,
-		     read_buffer,
-		     read_size,
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_md5_free(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     md5_string,
+		     md5_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set MD5 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     sha1_context,
+		     sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha1_free(
+		     &sha1_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     sha1_string,
+		     sha1_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA1 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     sha256_context,
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_free(
+		     &sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     sha256_string,
+		     sha256_string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 hash.",
+			 "%s: unable to set SHA256 hash string.",
 			 function );
 
-			goto on_error;
-		}
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Calculates the digest hashes of a hash job
+ * Callback for the hashing thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_job_callback(
+     hash_job_t *hash_job,
+     info_handle_t *info_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "info_handle_hash_job_callback";
+	int result               = 1;
+	int status               = 1;
+
+	if( hash_job == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash job.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_file_entry_calculate_digest_hashes(
+	     info_handle,
+	     hash_job->file_entry,
+	     hash_job->md5_string,
+	     DIGEST_HASH_STRING_SIZE_MD5,
+	     hash_job->sha1_string,
+	     DIGEST_HASH_STRING_SIZE_SHA1,
+	     hash_job->sha256_string,
+	     DIGEST_HASH_STRING_SIZE_SHA256,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate digest hashes.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		status = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle->hash_jobs_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     info_handle->hash_jobs_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab hash jobs mutex.",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+#endif
+	hash_job->status = status;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( result == 1 )
+	 && ( info_handle->hash_jobs_mutex != NULL ) )
+	{
+		if( libcthreads_condition_broadcast(
+		     info_handle->hash_jobs_condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast hash jobs condition.",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     info_handle->hash_jobs_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release hash jobs mutex.",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Starts hashing file entries
+ * The digest hashes are calculated by a thread pool if multi-threading is supported
+ * and the number of hashing threads is not 0, otherwise when a hash job is pushed
+ * Every hash job has its own file entry, so the hashing threads read without a shared lock
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_start_hashing(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_start_hashing";
+	size_t hash_jobs_size = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->hash_jobs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - hash jobs value already set.",
+		 function );
+
+		return( -1 );
+	}
+	hash_jobs_size = sizeof( hash_job_t * ) * INFO_HANDLE_MAXIMUM_NUMBER_OF_HASH_JOBS;
+
+	info_handle->hash_jobs = (hash_job_t **) memory_allocate(
+	                                          hash_jobs_size );
+
+	if( info_handle->hash_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     info_handle->hash_jobs,
+	     0,
+	     hash_jobs_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash jobs.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->number_of_hash_jobs = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle->number_of_hashing_threads > 0 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( info_handle->hash_jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize hash jobs mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( info_handle->hash_jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize hash jobs condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( info_handle->hash_thread_pool ),
+		     NULL,
+		     info_handle->number_of_hashing_threads,
+		     INFO_HANDLE_MAXIMUM_NUMBER_OF_HASH_JOBS,
+		     (int (*)(intptr_t *, void *)) &info_handle_hash_job_callback,
+		     (void *) info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hashing thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	info_handle_stop_hashing(
+	 info_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Stops hashing file entries
+ * Waits for the pending hash jobs to complete and frees the hash jobs that were not output
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_stop_hashing(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_stop_hashing";
+	int hash_job_index    = 0;
+	int result            = 1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle->hash_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( info_handle->hash_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join hashing thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( info_handle->hash_jobs_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( info_handle->hash_jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash jobs condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( info_handle->hash_jobs_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( info_handle->hash_jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash jobs mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( info_handle->hash_jobs != NULL )
+	{
+		for( hash_job_index = 0;
+		     hash_job_index < info_handle->number_of_hash_jobs;
+		     hash_job_index++ )
+		{
+			if( info_handle->hash_jobs[ hash_job_index ] == NULL )
+			{
+				continue;
+			}
+			if( hash_job_free(
+			     &( info_handle->hash_jobs[ hash_job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hash job: %d.",
+				 function,
+				 hash_job_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 info_handle->hash_jobs );
+
+		info_handle->hash_jobs = NULL;
+	}
+	info_handle->number_of_hash_jobs = 0;
+
+	return( result );
+}
+
+/* Pushes a hash job for a file entry
+ * The hash job takes over management of the file entry, after which it is set to NULL
+ * Pending hash jobs are output first when the maximum number of hash jobs is reached
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_push_hash_job(
+     info_handle_t *info_handle,
+     libfsfat_file_entry_t **file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *file_entry_name,
+     size_t file_entry_name_length,
+     libcerror_error_t **error )
+{
+	hash_job_t *hash_job  = NULL;
+	static char *function = "info_handle_push_hash_job";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->hash_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing hash jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->number_of_hash_jobs >= INFO_HANDLE_MAXIMUM_NUMBER_OF_HASH_JOBS )
+	{
+		if( info_handle_flush_hash_jobs(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to flush hash jobs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( hash_job_initialize(
+	     &hash_job,
+	     *file_entry,
+	     path,
+	     path_length,
+	     file_entry_name,
+	     file_entry_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash job.",
+		 function );
+
+		return( -1 );
+	}
+	*file_entry = NULL;
+
+	info_handle->hash_jobs[ info_handle->number_of_hash_jobs ] = hash_job;
+
+	info_handle->number_of_hash_jobs += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle->hash_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     info_handle->hash_thread_pool,
+		     (intptr_t *) hash_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push hash job onto hashing thread pool.",
+			 function );
+
+			hash_job->status = -1;
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( info_handle_hash_job_callback(
+	     hash_job,
+	     info_handle ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate digest hashes of hash job.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Outputs the pending hash jobs in the order they were pushed
+ * Waits for the digest hashes of each hash job to be calculated
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_flush_hash_jobs(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	hash_job_t *hash_job  = NULL;
+	static char *function = "info_handle_flush_hash_jobs";
+	int hash_job_index    = 0;
+	int status            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->hash_jobs == NULL )
+	{
+		return( 1 );
+	}
+	for( hash_job_index = 0;
+	     hash_job_index < info_handle->number_of_hash_jobs;
+	     hash_job_index++ )
+	{
+		hash_job = info_handle->hash_jobs[ hash_job_index ];
+
+		if( hash_job == NULL )
+		{
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( info_handle->hash_jobs_mutex != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     info_handle->hash_jobs_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab hash jobs mutex.",
+				 function );
+
+				return( -1 );
+			}
+			while( hash_job->status == 0 )
+			{
+				if( libcthreads_condition_wait(
+				     info_handle->hash_jobs_condition,
+				     info_handle->hash_jobs_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for hash jobs condition.",
+					 function );
+
+					libcthreads_mutex_release(
+					 info_handle->hash_jobs_mutex,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+			status = hash_job->status;
+
+			if( libcthreads_mutex_release(
+			     info_handle->hash_jobs_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release hash jobs mutex.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+#endif
+		{
+			status = hash_job->status;
+		}
+		if( status != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate digest hashes of hash job: %d.",
+			 function,
+			 hash_job_index );
+
+			return( -1 );
+		}
+		if( info_handle_file_entry_value_with_name_fprint(
+		     info_handle,
+		     hash_job->file_entry,
+		     hash_job->path,
+		     hash_job->path_length,
+		     hash_job->file_entry_name,
+		     hash_job->file_entry_name_length,
+		     hash_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print file entry of hash job: %d.",
+			 function,
+			 hash_job_index );
+
+			return( -1 );
+		}
+		if( hash_job_free(
+		     &( info_handle->hash_jobs[ hash_job_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash job: %d.",
+			 function,
+			 hash_job_index );
+
+			return( -1 );
+		}
+	}
+	info_handle->number_of_hash_jobs = 0;
+
+	return( 1 );
+}
+
+/* Resizes the path stack
+ * The path stack is only grown and retains its contents
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_path_stack_resize(
+     info_handle_t *info_handle,
+     size_t path_stack_size,
+     libcerror_error_t **error )
+{
+	system_character_t *path_stack = NULL;
+	static char *function          = "info_handle_path_stack_resize";
+	size_t new_path_stack_size     = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_stack_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path stack size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_stack_size <= info_handle->path_stack_size )
+	{
+		return( 1 );
+	}
+	new_path_stack_size = info_handle->path_stack_size;
+
+	if( new_path_stack_size < INFO_HANDLE_INITIAL_PATH_STACK_SIZE )
+	{
+		new_path_stack_size = INFO_HANDLE_INITIAL_PATH_STACK_SIZE;
+	}
+	while( new_path_stack_size < path_stack_size )
+	{
+		new_path_stack_size *= 2;
+	}
+	path_stack = (system_character_t *) memory_reallocate(
+	                                     info_handle->path_stack,
+	                                     sizeof( system_character_t ) * new_path_stack_size );
+
+	if( path_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize path stack.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->path_stack      = path_stack;
+	info_handle->path_stack_size = new_path_stack_size;
+
+	return( 1 );
+}
+
+/* Appends the name of a file entry to the path on the path stack
+ * The name is stored at path length and the path stack is resized to fit
+ * the name, a trailing separator and end-of-string character
+ * Returns 1 if successful, 0 if the file entry has no name or -1 on error
+ */
+int info_handle_path_stack_append_file_entry_name(
+     info_handle_t *info_handle,
+     libfsfat_file_entry_t *file_entry,
+     size_t path_length,
+     size_t *file_entry_name_length,
+     libcerror_error_t **error )
+{
+	static char *function       = "info_handle_path_stack_append_file_entry_name";
+	size_t file_entry_name_size = 0;
+	int result                  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > info_handle->path_stack_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	if( libhmac_md5_finalize(
-	     md5_context,
-	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
-	     error ) != 1 )
+	if( file_entry_name_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize MD5 hash.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry name length.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_md5_free(
-	     &md5_context,
-	     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsfat_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &file_entry_name_size,
+	          error );
+#else
+	result = libfsfat_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &file_entry_name_size,
+	          error );
+#endif
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free MD5 context.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( file_entry_name_size == 0 ) )
+	{
+		*file_entry_name_length = 0;
+
+		return( 0 );
 	}
-	if( digest_hash_copy_to_string(
-	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
-	     md5_string,
-	     md5_string_size,
+	if( info_handle_path_stack_resize(
+	     info_handle,
+	     path_length + file_entry_name_size + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set MD5 hash string.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize path stack.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( md5_context != NULL )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsfat_file_entry_get_utf16_name(
+	          file_entry,
+	          (uint16_t *) &( info_handle->path_stack[ path_length ] ),
+	          file_entry_name_size,
+	          error );
+#else
+	result = libfsfat_file_entry_get_utf8_name(
+	          file_entry,
+	          (uint8_t *) &( info_handle->path_stack[ path_length ] ),
+	          file_entry_name_size,
+	          error );
+#endif
+	if( result != 1 )
 	{
-		libhmac_md5_free(
-		 &md5_context,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	*file_entry_name_length = file_entry_name_size - 1;
+
+	return( 1 );
 }
 
 /* Prints a file entry or data stream name
@@ -1178,6 +2637,7 @@ int info_handle_file_entry_value_with_name_fprint(
      size_t path_length,
      const system_character_t *file_entry_name,
      size_t file_entry_name_length,
+     hash_job_t *hash_job,
      libcerror_error_t **error )
 {
 	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ] = {
@@ -1187,6 +2647,9 @@ int info_handle_file_entry_value_with_name_fprint(
 
 	char file_mode_string[ 11 ]    = { '-', 'r', 'w', 'x', 'r', 'w', 'x', 'r', 'w', 'x', 0 };
 
+	char sha1_string[ DIGEST_HASH_STRING_SIZE_SHA1 ];
+	char sha256_string[ DIGEST_HASH_STRING_SIZE_SHA256 ];
+
 	static char *function          = "info_handle_file_entry_value_with_name_fprint";
 	size64_t size                  = 0;
 	uint64_t access_time           = 0;
@@ -1299,26 +2762,115 @@ int info_handle_file_entry_value_with_name_fprint(
 	}
 	if( info_handle->bodyfile_stream != NULL )
 	{
-		if( info_handle->calculate_md5 == 0 )
+		if( memory_set(
+		     sha1_string,
+		     '0',
+		     DIGEST_HASH_STRING_SIZE_SHA1 - 1 ) == NULL )
 		{
-			md5_string[ 1 ] = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear SHA1 string.",
+			 function );
+
+			return( -1 );
+		}
+		sha1_string[ DIGEST_HASH_STRING_SIZE_SHA1 - 1 ] = 0;
+
+		if( memory_set(
+		     sha256_string,
+		     '0',
+		     DIGEST_HASH_STRING_SIZE_SHA256 - 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear SHA256 string.",
+			 function );
+
+			return( -1 );
+		}
+		sha256_string[ DIGEST_HASH_STRING_SIZE_SHA256 - 1 ] = 0;
+
+		/* The digest hashes of a hash job were calculated in advance
+		 */
+		if( hash_job != NULL )
+		{
+			if( ( info_handle->digest_types & DIGEST_HASH_TYPE_MD5 ) != 0 )
+			{
+				if( memory_copy(
+				     md5_string,
+				     hash_job->md5_string,
+				     DIGEST_HASH_STRING_SIZE_MD5 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy MD5 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( ( info_handle->digest_types & DIGEST_HASH_TYPE_SHA1 ) != 0 )
+			{
+				if( memory_copy(
+				     sha1_string,
+				     hash_job->sha1_string,
+				     DIGEST_HASH_STRING_SIZE_SHA1 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy SHA1 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( ( info_handle->digest_types & DIGEST_HASH_TYPE_SHA256 ) != 0 )
+			{
+				if( memory_copy(
+				     sha256_string,
+				     hash_job->sha256_string,
+				     DIGEST_HASH_STRING_SIZE_SHA256 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy SHA256 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
 		}
-		else if( ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL ) == 0 )
+		else if( ( info_handle->digest_types != 0 )
+		      && ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL ) == 0 )
 		      && ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
 		      && ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DEVICE ) == 0 ) )
 		{
-			if( info_handle_file_entry_calculate_md5(
+			if( info_handle_file_entry_calculate_digest_hashes(
 			     info_handle,
 			     file_entry,
 			     md5_string,
 			     DIGEST_HASH_STRING_SIZE_MD5,
+			     sha1_string,
+			     DIGEST_HASH_STRING_SIZE_SHA1,
+			     sha256_string,
+			     DIGEST_HASH_STRING_SIZE_SHA256,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retreive MD5 string.",
+				 "%s: unable to retreive digest hash strings.",
 				 function );
 
 				return( -1 );
@@ -1335,50 +2887,6 @@ int info_handle_file_entry_value_with_name_fprint(
 			file_mode_string[ 5 ] = '-';
 			file_mode_string[ 8 ] = '-';
 		}
-		/* Colums in a Sleuthkit 3.x and later bodyfile
-		 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
-		 */
-		fprintf(
-		 info_handle->bodyfile_stream,
-		 "%s|",
-		 md5_string );
-
-		if( path != NULL )
-		{
-			if( info_handle_name_value_fprint(
-			     info_handle,
-			     path,
-			     path_length,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print path string.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( file_entry_name != NULL )
-		{
-			if( info_handle_name_value_fprint(
-			     info_handle,
-			     file_entry_name,
-			     file_entry_name_length,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print file entry name string.",
-				 function );
-
-				return( -1 );
-			}
-		}
 /* TODO add option to control conversion of identifier to TSK metadata address */
 		file_entry_identifier -= info_handle->root_directory_identifier;
 
@@ -1403,32 +2911,51 @@ int info_handle_file_entry_value_with_name_fprint(
 		{
 			creation_time += 31553280000;
 		}
-		if( info_handle->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+		if( info_handle->timeline_writer == NULL )
 		{
-			fprintf(
-			 info_handle->bodyfile_stream,
-			 "|%" PRIu64 "|%s|0|0|%" PRIu64 "|%" PRIu64 "|%" PRIu64 ".%02" PRIu64 "|0|%" PRIu64 ".%02" PRIu64 "\n",
-			 file_entry_identifier,
-			 file_mode_string,
-			 size,
-			 access_time / 100,
-			 modification_time / 100,
-			 modification_time % 100,
-			 creation_time / 100,
-			 creation_time % 100 );
+			if( timeline_writer_initialize(
+			     &( info_handle->timeline_writer ),
+			     info_handle->bodyfile_stream,
+			     info_handle->timeline_format,
+			     info_handle->digest_types,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create timeline writer.",
+				 function );
+
+				return( -1 );
+			}
 		}
-		else
+		if( timeline_writer_write_entry(
+		     info_handle->timeline_writer,
+		     path,
+		     path_length,
+		     file_entry_name,
+		     file_entry_name_length,
+		     file_entry_identifier,
+		     file_mode_string,
+		     size,
+		     access_time,
+		     modification_time,
+		     (uint8_t) ( info_handle->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT ),
+		     creation_time,
+		     md5_string,
+		     sha1_string,
+		     sha256_string,
+		     error ) != 1 )
 		{
-			fprintf(
-			 info_handle->bodyfile_stream,
-			 "|%" PRIu64 "|%s|0|0|%" PRIu64 "|%" PRIu64 "|%" PRIu64 "|0|%" PRIu64 ".%02" PRIu64 "\n",
-			 file_entry_identifier,
-			 file_mode_string,
-			 size,
-			 access_time / 100,
-			 modification_time / 100,
-			 creation_time / 100,
-			 creation_time % 100 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to write timeline entry.",
+			 function );
+
+			return( -1 );
 		}
 	}
 	else
@@ -1542,29 +3069,156 @@ int info_handle_file_entry_value_with_name_fprint(
 		 file_attribute_flags,
 		 info_handle->notify_stream );
 	}
-	return( 1 );
+	return( 1 );
+}
+
+/* Retrieves the name of a file entry
+ * Returns 1 if successful, 0 if the file entry has no name or -1 on error
+ */
+int info_handle_file_entry_get_name(
+     libfsfat_file_entry_t *file_entry,
+     system_character_t **file_entry_name,
+     size_t *file_entry_name_size,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_file_entry_name = NULL;
+	static char *function                    = "info_handle_file_entry_get_name";
+	size_t safe_file_entry_name_size         = 0;
+	int result                               = 0;
+
+	if( file_entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry name size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsfat_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &safe_file_entry_name_size,
+	          error );
+#else
+	result = libfsfat_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &safe_file_entry_name_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result == 0 )
+	 || ( safe_file_entry_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	safe_file_entry_name = system_string_allocate(
+	                        safe_file_entry_name_size );
+
+	if( safe_file_entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsfat_file_entry_get_utf16_name(
+	          file_entry,
+	          (uint16_t *) safe_file_entry_name,
+	          safe_file_entry_name_size,
+	          error );
+#else
+	result = libfsfat_file_entry_get_utf8_name(
+	          file_entry,
+	          (uint8_t *) safe_file_entry_name,
+	          safe_file_entry_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+	*file_entry_name      = safe_file_entry_name;
+	*file_entry_name_size = safe_file_entry_name_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_file_entry_name != NULL )
+	{
+		memory_free(
+		 safe_file_entry_name );
+	}
+	return( -1 );
 }
 
 /* Prints file entry information as part of the file system hierarchy
+ * The path of the file entry is stored on the path stack up to path length
  * Returns 1 if successful or -1 on error
  */
 int info_handle_file_system_hierarchy_fprint_file_entry(
      info_handle_t *info_handle,
      libfsfat_file_entry_t *file_entry,
-     const system_character_t *path,
      size_t path_length,
      libcerror_error_t **error )
 {
-	libfsfat_file_entry_t *sub_file_entry = NULL;
-	system_character_t *file_entry_name   = NULL;
-	system_character_t *sub_path          = NULL;
-	static char *function                 = "info_handle_file_system_hierarchy_fprint_file_entry";
-	size_t file_entry_name_length         = 0;
-	size_t file_entry_name_size           = 0;
-	size_t sub_path_size                  = 0;
-	int number_of_sub_file_entries        = 0;
-	int result                            = 0;
-	int sub_file_entry_index              = 0;
+	libfsfat_file_entry_t *sub_file_entry   = NULL;
+	system_character_t *file_entry_name     = NULL;
+	system_character_t *sub_file_entry_name = NULL;
+	static char *function                   = "info_handle_file_system_hierarchy_fprint_file_entry";
+	size_t file_entry_name_length           = 0;
+	size_t sub_file_entry_name_length       = 0;
+	size_t sub_path_length                  = 0;
+	uint16_t file_attribute_flags           = 0;
+	int number_of_sub_file_entries          = 0;
+	int result                              = 0;
+	int sub_file_entry_index                = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1577,102 +3231,75 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 
 		return( -1 );
 	}
-	if( path == NULL )
+	if( info_handle->path_stack == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing path stack.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( path_length > info_handle->path_stack_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsfat_file_entry_get_utf16_name_size(
-	          file_entry,
-	          &file_entry_name_size,
-	          error );
-#else
-	result = libfsfat_file_entry_get_utf8_name_size(
+	result = info_handle_path_stack_append_file_entry_name(
+	          info_handle,
 	          file_entry,
-	          &file_entry_name_size,
+	          path_length,
+	          &file_entry_name_length,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry name string size.",
+		 "%s: unable to retrieve file entry name.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( result == 1 )
-	 && ( file_entry_name_size > 0 ) )
+	else if( result != 0 )
 	{
-		file_entry_name = system_string_allocate(
-		                   file_entry_name_size );
-
-		if( file_entry_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create file entry name string.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfsfat_file_entry_get_utf16_name(
-		          file_entry,
-		          (uint16_t *) file_entry_name,
-		          file_entry_name_size,
-		          error );
-#else
-		result = libfsfat_file_entry_get_utf8_name(
-		          file_entry,
-		          (uint8_t *) file_entry_name,
-		          file_entry_name_size,
-		          error );
-#endif
-		if( result != 1 )
+		file_entry_name = &( info_handle->path_stack[ path_length ] );
+	}
+	if( info_handle->bodyfile_stream != NULL )
+	{
+		/* The pending hash jobs precede the file entry in the output
+		 */
+		if( info_handle_flush_hash_jobs(
+		     info_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry name string.",
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to flush hash jobs.",
 			 function );
 
 			goto on_error;
 		}
-		file_entry_name_length = file_entry_name_size - 1;
-	}
-	if( info_handle->bodyfile_stream != NULL )
-	{
 		if( info_handle_file_entry_value_with_name_fprint(
 		     info_handle,
 		     file_entry,
-		     path,
+		     info_handle->path_stack,
 		     path_length,
 		     file_entry_name,
 		     file_entry_name_length,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1689,8 +3316,8 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 	{
 		if( info_handle_name_value_fprint(
 		     info_handle,
-		     path,
-		     path_length,
+		     info_handle->path_stack,
+		     path_length + file_entry_name_length,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1702,24 +3329,6 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 
 			goto on_error;
 		}
-		if( file_entry_name != NULL )
-		{
-			if( info_handle_name_value_fprint(
-			     info_handle,
-			     file_entry_name,
-			     file_entry_name_length,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print file entry name string.",
-				 function );
-
-				goto on_error;
-			}
-		}
 		fprintf(
 		 info_handle->notify_stream,
 		 "\n" );
@@ -1738,128 +3347,142 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 
 		goto on_error;
 	}
-	if( number_of_sub_file_entries > 0 )
+	if( number_of_sub_file_entries == 0 )
 	{
-		sub_path_size = path_length + 1;
-
-		if( file_entry_name != NULL )
-		{
-			sub_path_size += file_entry_name_size;
-		}
-		sub_path = system_string_allocate(
-		            sub_path_size );
+		return( 1 );
+	}
+	/* The path of the sub file entries is the path with the file entry name
+	 * and a separator, the path stack was resized to fit the separator
+	 */
+	sub_path_length = path_length;
 
-		if( sub_path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub path.",
-			 function );
+	if( file_entry_name != NULL )
+	{
+		sub_path_length += file_entry_name_length;
 
-			goto on_error;
-		}
-		if( system_string_copy(
-		     sub_path,
-		     path,
-		     path_length ) == NULL )
+		info_handle->path_stack[ sub_path_length++ ] = (system_character_t) LIBFSFAT_SEPARATOR;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsfat_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy path to sub path.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
 
 			goto on_error;
 		}
-		if( file_entry_name != NULL )
-		{
-			if( system_string_copy(
-			     &( sub_path[ path_length ] ),
-			     file_entry_name,
-			     file_entry_name_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy file entry name to sub path.",
-				 function );
-
-				goto on_error;
-			}
-			sub_path[ sub_path_size - 2 ] = (system_character_t) LIBFSFAT_SEPARATOR;
-		}
-		sub_path[ sub_path_size - 1 ] = (system_character_t) 0;
-
-		for( sub_file_entry_index = 0;
-		     sub_file_entry_index < number_of_sub_file_entries;
-		     sub_file_entry_index++ )
+		/* When hashing, the file entry of a file is passed to a hash job
+		 * and output when its digest hashes have been calculated
+		 */
+		if( info_handle->hash_jobs != NULL )
 		{
-			if( libfsfat_file_entry_get_sub_file_entry_by_index(
-			     file_entry,
-			     sub_file_entry_index,
-			     &sub_file_entry,
-			     error ) != 1 )
+			if( libfsfat_file_entry_get_file_attribute_flags(
+			     sub_file_entry,
+			     &file_attribute_flags,
+			     error ) == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve sub file entry: %d.",
+				 "%s: unable to retrieve file attribute flags of sub file entry: %d.",
 				 function,
 				 sub_file_entry_index );
 
 				goto on_error;
 			}
-			if( info_handle_file_system_hierarchy_fprint_file_entry(
-			     info_handle,
-			     sub_file_entry,
-			     sub_path,
-			     sub_path_size - 1,
-			     error ) != 1 )
+			if( ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL ) == 0 )
+			 && ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
+			 && ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DEVICE ) == 0 ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print file entry: %d information.",
-				 function,
-				 sub_file_entry_index );
+				result = info_handle_path_stack_append_file_entry_name(
+				          info_handle,
+				          sub_file_entry,
+				          sub_path_length,
+				          &sub_file_entry_name_length,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve name of sub file entry: %d.",
+					 function,
+					 sub_file_entry_index );
 
-				goto on_error;
-			}
-			if( libfsfat_file_entry_free(
-			     &sub_file_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free sub file entry: %d.",
-				 function,
-				 sub_file_entry_index );
+					goto on_error;
+				}
+				sub_file_entry_name = NULL;
 
-				goto on_error;
+				if( result != 0 )
+				{
+					sub_file_entry_name = &( info_handle->path_stack[ sub_path_length ] );
+				}
+				if( info_handle_push_hash_job(
+				     info_handle,
+				     &sub_file_entry,
+				     info_handle->path_stack,
+				     sub_path_length,
+				     sub_file_entry_name,
+				     sub_file_entry_name_length,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push hash job of sub file entry: %d.",
+					 function,
+					 sub_file_entry_index );
+
+					goto on_error;
+				}
+				continue;
 			}
 		}
-		if( sub_path != NULL )
+		if( info_handle_file_system_hierarchy_fprint_file_entry(
+		     info_handle,
+		     sub_file_entry,
+		     sub_path_length,
+		     error ) != 1 )
 		{
-			memory_free(
-			 sub_path );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print file entry: %d information.",
+			 function,
+			 sub_file_entry_index );
 
-			sub_path = NULL;
+			goto on_error;
 		}
-	}
-	if( file_entry_name != NULL )
-	{
-		memory_free(
-		 file_entry_name );
+		if( libfsfat_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
 
-		file_entry_name = NULL;
+			goto on_error;
+		}
 	}
 	return( 1 );
 
@@ -1870,16 +3493,6 @@ on_error:
 		 &sub_file_entry,
 		 NULL );
 	}
-	if( sub_path != NULL )
-	{
-		memory_free(
-		 sub_path );
-	}
-	if( file_entry_name != NULL )
-	{
-		memory_free(
-		 file_entry_name );
-	}
 	return( -1 );
 }
 
@@ -2026,6 +3639,7 @@ int info_handle_file_entry_fprint_by_identifier(
 	     0,
 	     file_entry_name,
 	     file_entry_name_length,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2194,6 +3808,7 @@ int info_handle_file_entry_fprint_by_path(
 	     path_length,
 	     NULL,
 	     0,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2280,6 +3895,23 @@ int info_handle_file_system_hierarchy_fprint(
 
 		goto on_error;
 	}
+	if( ( info_handle->bodyfile_stream != NULL )
+	 && ( info_handle->digest_types != 0 ) )
+	{
+		if( info_handle_start_hashing(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start hashing.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	result = libfsfat_volume_get_root_directory(
 	          info_handle->input_volume,
 	          &file_entry,
@@ -2315,10 +3947,25 @@ int info_handle_file_system_hierarchy_fprint(
 				goto on_error;
 			}
 		}
+		if( info_handle_path_stack_resize(
+		     info_handle,
+		     INFO_HANDLE_INITIAL_PATH_STACK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize path stack.",
+			 function );
+
+			goto on_error;
+		}
+		info_handle->path_stack[ 0 ] = (system_character_t) LIBFSFAT_SEPARATOR;
+
 		if( info_handle_file_system_hierarchy_fprint_file_entry(
 		     info_handle,
 		     file_entry,
-		     _SYSTEM_STRING( "\\" ),
 		     1,
 		     error ) != 1 )
 		{
@@ -2345,6 +3992,51 @@ int info_handle_file_system_hierarchy_fprint(
 			goto on_error;
 		}
 	}
+	if( info_handle->hash_jobs != NULL )
+	{
+		if( info_handle_flush_hash_jobs(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to flush hash jobs.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_stop_hashing(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop hashing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->timeline_writer != NULL )
+	{
+		if( timeline_writer_flush(
+		     info_handle->timeline_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush timeline writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( info_handle->bodyfile_stream == NULL )
 	{
 		fprintf(
@@ -2354,6 +4046,12 @@ int info_handle_file_system_hierarchy_fprint(
 	return( 1 );
 
 on_error:
+	if( info_handle->hash_jobs != NULL )
+	{
+		info_handle_stop_hashing(
+		 info_handle,
+		 NULL );
+	}
 	if( file_entry != NULL )
 	{
 		libfsfat_file_entry_free(
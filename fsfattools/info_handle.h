@@ -28,12 +28,37 @@
 
 #include "fsfattools_libbfio.h"
 #include "fsfattools_libcerror.h"
+#include "fsfattools_libcthreads.h"
 #include "fsfattools_libfsfat.h"
+#include "hash_job.h"
+#include "timeline_writer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The default number of concurrent hashing jobs
+ */
+#define INFO_HANDLE_DEFAULT_NUMBER_OF_HASHING_THREADS	4
+
+/* The maximum number of concurrent hashing jobs
+ */
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_HASHING_THREADS	64
+
+/* The maximum number of hash jobs that are pending output
+ */
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_HASH_JOBS		256
+
+/* The default, minimum and maximum size of the buffer used to read file entry data when hashing
+ */
+#define INFO_HANDLE_DEFAULT_HASH_READ_BUFFER_SIZE	( 4 * 1024 * 1024 )
+#define INFO_HANDLE_MINIMUM_HASH_READ_BUFFER_SIZE	512
+#define INFO_HANDLE_MAXIMUM_HASH_READ_BUFFER_SIZE	( 64 * 1024 * 1024 )
+
+/* The initial size of the path stack
+ */
+#define INFO_HANDLE_INITIAL_PATH_STACK_SIZE		1024
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -58,14 +83,60 @@ struct info_handle
 	 */
 	uint64_t root_directory_identifier;
 
-	/* Value to indicate if the MD5 hash should be calculated
+	/* The digest types to calculate
+	 */
+	uint8_t digest_types;
+
+	/* The number of concurrent hashing jobs
+	 */
+	int number_of_hashing_threads;
+
+	/* The maximum size of a read of file entry data when hashing
+	 */
+	size_t hash_read_buffer_size;
+
+	/* The hash jobs that are pending output
+	 */
+	hash_job_t **hash_jobs;
+
+	/* The number of hash jobs that are pending output
+	 */
+	int number_of_hash_jobs;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The hashing thread pool
 	 */
-	uint8_t calculate_md5;
+	libcthreads_thread_pool_t *hash_thread_pool;
+
+	/* The hash jobs mutex
+	 */
+	libcthreads_mutex_t *hash_jobs_mutex;
+
+	/* The hash jobs condition, signalled when a hash job is calculated
+	 */
+	libcthreads_condition_t *hash_jobs_condition;
+#endif
 
 	/* The bodyfile output stream
 	 */
 	FILE *bodyfile_stream;
 
+	/* The timeline output format
+	 */
+	int timeline_format;
+
+	/* The timeline writer, buffers the bodyfile output
+	 */
+	timeline_writer_t *timeline_writer;
+
+	/* The path stack, contains the path of the file entry that is being printed
+	 */
+	system_character_t *path_stack;
+
+	/* The path stack size
+	 */
+	size_t path_stack_size;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -103,6 +174,26 @@ int info_handle_set_bodyfile(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_set_timeline_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_digest_types(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_number_of_hashing_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_hash_read_buffer_size(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_set_volume_offset(
      info_handle_t *info_handle,
      const system_character_t *string,
@@ -117,11 +208,58 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
-int info_handle_file_entry_calculate_md5(
+int info_handle_file_entry_calculate_digest_hashes(
      info_handle_t *info_handle,
      libfsfat_file_entry_t *file_entry,
      char *md5_string,
      size_t md5_string_size,
+     char *sha1_string,
+     size_t sha1_string_size,
+     char *sha256_string,
+     size_t sha256_string_size,
+     libcerror_error_t **error );
+
+int info_handle_hash_job_callback(
+     hash_job_t *hash_job,
+     info_handle_t *info_handle );
+
+int info_handle_start_hashing(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_stop_hashing(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_push_hash_job(
+     info_handle_t *info_handle,
+     libfsfat_file_entry_t **file_entry,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *file_entry_name,
+     size_t file_entry_name_length,
+     libcerror_error_t **error );
+
+int info_handle_flush_hash_jobs(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_entry_get_name(
+     libfsfat_file_entry_t *file_entry,
+     system_character_t **file_entry_name,
+     size_t *file_entry_name_size,
+     libcerror_error_t **error );
+
+int info_handle_path_stack_resize(
+     info_handle_t *info_handle,
+     size_t path_stack_size,
+     libcerror_error_t **error );
+
+int info_handle_path_stack_append_file_entry_name(
+     info_handle_t *info_handle,
+     libfsfat_file_entry_t *file_entry,
+     size_t path_length,
+     size_t *file_entry_name_length,
      libcerror_error_t **error );
 
 int info_handle_name_value_fprint(
@@ -143,12 +281,12 @@ int info_handle_file_entry_value_with_name_fprint(
      size_t path_length,
      const system_character_t *file_entry_name,
      size_t file_entry_name_length,
+     hash_job_t *hash_job,
      libcerror_error_t **error );
 
 int info_handle_file_system_hierarchy_fprint_file_entry(
      info_handle_t *info_handle,
      libfsfat_file_entry_t *file_entry,
-     const system_character_t *path,
      size_t path_length,
      libcerror_error_t **error );
 
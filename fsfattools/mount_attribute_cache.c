@@ -0,0 +1,602 @@
+/*
+ * Mount attribute cache
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fsfattools_libcerror.h"
+#include "fsfattools_libcthreads.h"
+#include "mount_attribute_cache.h"
+
+/* Creates an attribute cache
+ * Make sure the value attribute_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_attribute_cache_initialize(
+     mount_attribute_cache_t **attribute_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_attribute_cache_initialize";
+
+	if( attribute_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attribute_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid attribute cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*attribute_cache = memory_allocate_structure(
+	                    mount_attribute_cache_t );
+
+	if( *attribute_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create attribute cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *attribute_cache,
+	     0,
+	     sizeof( mount_attribute_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear attribute cache.",
+		 function );
+
+		memory_free(
+		 *attribute_cache );
+
+		*attribute_cache = NULL;
+
+		return( -1 );
+	}
+	( *attribute_cache )->entries = (mount_attribute_cache_entry_t *) memory_allocate(
+	                                 sizeof( mount_attribute_cache_entry_t ) * MOUNT_ATTRIBUTE_CACHE_NUMBER_OF_ENTRIES );
+
+	if( ( *attribute_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *attribute_cache )->entries,
+	     0,
+	     sizeof( mount_attribute_cache_entry_t ) * MOUNT_ATTRIBUTE_CACHE_NUMBER_OF_ENTRIES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *attribute_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *attribute_cache != NULL )
+	{
+		if( ( *attribute_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *attribute_cache )->entries );
+		}
+		memory_free(
+		 *attribute_cache );
+
+		*attribute_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an attribute cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_attribute_cache_free(
+     mount_attribute_cache_t **attribute_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_attribute_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( attribute_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attribute_cache != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *attribute_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *attribute_cache )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < MOUNT_ATTRIBUTE_CACHE_NUMBER_OF_ENTRIES;
+			     entry_index++ )
+			{
+				if( ( *attribute_cache )->entries[ entry_index ].path != NULL )
+				{
+					memory_free(
+					 ( *attribute_cache )->entries[ entry_index ].path );
+				}
+			}
+			memory_free(
+			 ( *attribute_cache )->entries );
+		}
+		memory_free(
+		 *attribute_cache );
+
+		*attribute_cache = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the hash of a path
+ * The hash is a 32-bit FNV-1a hash of the path characters, which determines the cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_attribute_cache_calculate_path_hash(
+     const system_character_t *path,
+     size_t path_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_attribute_cache_calculate_path_hash";
+	size_t path_index     = 0;
+	uint32_t safe_hash    = 0x811c9dc5UL;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		safe_hash ^= (uint32_t) path[ path_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	*path_hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the attributes of a specific path
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_attribute_cache_get_attributes_by_path(
+     mount_attribute_cache_t *attribute_cache,
+     const system_character_t *path,
+     size_t path_length,
+     mount_attributes_t *attributes,
+     libcerror_error_t **error )
+{
+	mount_attribute_cache_entry_t *cache_entry = NULL;
+	static char *function                      = "mount_attribute_cache_get_attributes_by_path";
+	uint32_t path_hash                         = 0;
+	int result                                 = 0;
+
+	if( attribute_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid attribute cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_attribute_cache_calculate_path_hash(
+	     path,
+	     path_length,
+	     &path_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate path hash.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = &( attribute_cache->entries[ path_hash % MOUNT_ATTRIBUTE_CACHE_NUMBER_OF_ENTRIES ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     attribute_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( cache_entry->path != NULL )
+	 && ( cache_entry->path_size == ( path_length + 1 ) ) )
+	{
+		if( memory_compare(
+		     cache_entry->path,
+		     path,
+		     sizeof( system_character_t ) * path_length ) == 0 )
+		{
+			if( memory_copy(
+			     attributes,
+			     &( cache_entry->attributes ),
+			     sizeof( mount_attributes_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy attributes.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				result = 1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     attribute_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the attributes of a specific path
+ * Replaces the attributes of another path that maps onto the same cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_attribute_cache_set_attributes_by_path(
+     mount_attribute_cache_t *attribute_cache,
+     const system_character_t *path,
+     size_t path_length,
+     const mount_attributes_t *attributes,
+     libcerror_error_t **error )
+{
+	mount_attribute_cache_entry_t *cache_entry = NULL;
+	static char *function                      = "mount_attribute_cache_set_attributes_by_path";
+	uint32_t path_hash                         = 0;
+	int result                                 = 1;
+
+	if( attribute_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid attribute cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_attribute_cache_calculate_path_hash(
+	     path,
+	     path_length,
+	     &path_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate path hash.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = &( attribute_cache->entries[ path_hash % MOUNT_ATTRIBUTE_CACHE_NUMBER_OF_ENTRIES ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     attribute_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( cache_entry->path_size != ( path_length + 1 ) )
+	{
+		if( cache_entry->path != NULL )
+		{
+			memory_free(
+			 cache_entry->path );
+		}
+		cache_entry->path_size = path_length + 1;
+
+		cache_entry->path = system_string_allocate(
+		                     cache_entry->path_size );
+
+		if( cache_entry->path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create path.",
+			 function );
+
+			cache_entry->path_size = 0;
+
+			result = -1;
+		}
+	}
+	if( cache_entry->path != NULL )
+	{
+		if( memory_copy(
+		     cache_entry->path,
+		     path,
+		     sizeof( system_character_t ) * path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			result = -1;
+		}
+		cache_entry->path[ path_length ] = 0;
+
+		if( memory_copy(
+		     &( cache_entry->attributes ),
+		     attributes,
+		     sizeof( mount_attributes_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy attributes.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			memory_free(
+			 cache_entry->path );
+
+			cache_entry->path      = NULL;
+			cache_entry->path_size = 0;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     attribute_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
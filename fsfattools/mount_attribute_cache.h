@@ -0,0 +1,133 @@
+/*
+ * Mount attribute cache
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_ATTRIBUTE_CACHE_H )
+#define _MOUNT_ATTRIBUTE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fsfattools_libcerror.h"
+#include "fsfattools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of entries in the attribute cache
+ */
+#define MOUNT_ATTRIBUTE_CACHE_NUMBER_OF_ENTRIES		16384
+
+typedef struct mount_attributes mount_attributes_t;
+
+struct mount_attributes
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The file mode
+	 */
+	uint16_t file_mode;
+
+	/* The access date and time
+	 */
+	uint64_t access_time;
+
+	/* The inode change date and time
+	 */
+	uint64_t inode_change_time;
+
+	/* The modification date and time
+	 */
+	uint64_t modification_time;
+};
+
+typedef struct mount_attribute_cache_entry mount_attribute_cache_entry_t;
+
+struct mount_attribute_cache_entry
+{
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The attributes
+	 */
+	mount_attributes_t attributes;
+};
+
+typedef struct mount_attribute_cache mount_attribute_cache_t;
+
+struct mount_attribute_cache
+{
+	/* The entries
+	 */
+	mount_attribute_cache_entry_t *entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int mount_attribute_cache_initialize(
+     mount_attribute_cache_t **attribute_cache,
+     libcerror_error_t **error );
+
+int mount_attribute_cache_free(
+     mount_attribute_cache_t **attribute_cache,
+     libcerror_error_t **error );
+
+int mount_attribute_cache_calculate_path_hash(
+     const system_character_t *path,
+     size_t path_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error );
+
+int mount_attribute_cache_get_attributes_by_path(
+     mount_attribute_cache_t *attribute_cache,
+     const system_character_t *path,
+     size_t path_length,
+     mount_attributes_t *attributes,
+     libcerror_error_t **error );
+
+int mount_attribute_cache_set_attributes_by_path(
+     mount_attribute_cache_t *attribute_cache,
+     const system_character_t *path,
+     size_t path_length,
+     const mount_attributes_t *attributes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_ATTRIBUTE_CACHE_H ) */
+
@@ -31,7 +31,9 @@
 #endif
 
 #include "fsfattools_libcerror.h"
+#include "fsfattools_libcthreads.h"
 #include "fsfattools_libfsfat.h"
+#include "mount_attribute_cache.h"
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
 
@@ -173,8 +175,27 @@ int mount_file_entry_initialize(
 
 		( *file_entry )->name_size = name_length + 1;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *file_entry )->read_ahead_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read-ahead mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *file_entry )->fsfat_file_entry = fsfat_file_entry;
 
+	/* Only the root directory has no name
+	 */
+	( *file_entry )->is_root = (uint8_t) ( name_length == 0 );
+
 	return( 1 );
 
 on_error:
@@ -221,6 +242,41 @@ int mount_file_entry_free(
 			memory_free(
 			 ( *file_entry )->name );
 		}
+		if( ( *file_entry )->packed_sub_file_entries != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->packed_sub_file_entries );
+		}
+		if( ( *file_entry )->packed_sub_file_entries_name_pool != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->packed_sub_file_entries_name_pool );
+		}
+		if( ( *file_entry )->extents != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->extents );
+		}
+		if( ( *file_entry )->read_ahead_buffer != NULL )
+		{
+			memory_free(
+			 ( *file_entry )->read_ahead_buffer );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *file_entry )->read_ahead_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( libfsfat_file_entry_free(
 		     &( ( *file_entry )->fsfat_file_entry ),
 		     error ) != 1 )
@@ -810,7 +866,199 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the name and attributes of a packed sub file entry for the specific index
+ * The packed sub file entries are retrieved in batches and kept in the file entry,
+ * so that reading the sub file entries in order does not require a lookup per entry
+ * The name is stored in the file entry and remains valid until the next call
+ * Returns 1 if successful, 0 if no such sub file entry or -1 on error
+ */
+int mount_file_entry_get_packed_sub_file_entry_by_index(
+     mount_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     const uint8_t **utf8_name,
+     mount_attributes_t *attributes,
+     libcerror_error_t **error )
+{
+	libfsfat_packed_file_entry_t *packed_sub_file_entry = NULL;
+	static char *function                               = "mount_file_entry_get_packed_sub_file_entry_by_index";
+	int packed_sub_file_entry_index                     = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid sub file entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->packed_sub_file_entries == NULL )
+	{
+		file_entry->packed_sub_file_entries = (libfsfat_packed_file_entry_t *) memory_allocate(
+		                                       sizeof( libfsfat_packed_file_entry_t ) * MOUNT_FILE_ENTRY_MAXIMUM_NUMBER_OF_PACKED_SUB_FILE_ENTRIES );
+
+		if( file_entry->packed_sub_file_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create packed sub file entries.",
+			 function );
+
+			return( -1 );
+		}
+		file_entry->number_of_packed_sub_file_entries = 0;
+	}
+	if( file_entry->packed_sub_file_entries_name_pool == NULL )
+	{
+		file_entry->packed_sub_file_entries_name_pool = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * MOUNT_FILE_ENTRY_PACKED_SUB_FILE_ENTRIES_NAME_POOL_SIZE );
+
+		if( file_entry->packed_sub_file_entries_name_pool == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create packed sub file entries name pool.",
+			 function );
+
+			return( -1 );
+		}
+		file_entry->number_of_packed_sub_file_entries = 0;
+	}
+	if( ( sub_file_entry_index < file_entry->packed_sub_file_entries_first_index )
+	 || ( ( sub_file_entry_index - file_entry->packed_sub_file_entries_first_index ) >= file_entry->number_of_packed_sub_file_entries ) )
+	{
+		file_entry->packed_sub_file_entries_first_index = sub_file_entry_index;
+		file_entry->number_of_packed_sub_file_entries   = 0;
+
+		if( libfsfat_file_entry_get_sub_file_entries_packed(
+		     file_entry->fsfat_file_entry,
+		     sub_file_entry_index,
+		     file_entry->packed_sub_file_entries,
+		     MOUNT_FILE_ENTRY_MAXIMUM_NUMBER_OF_PACKED_SUB_FILE_ENTRIES,
+		     file_entry->packed_sub_file_entries_name_pool,
+		     MOUNT_FILE_ENTRY_PACKED_SUB_FILE_ENTRIES_NAME_POOL_SIZE,
+		     &( file_entry->number_of_packed_sub_file_entries ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve packed sub file entries starting at: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			file_entry->number_of_packed_sub_file_entries = 0;
+
+			return( -1 );
+		}
+		if( file_entry->number_of_packed_sub_file_entries == 0 )
+		{
+			return( 0 );
+		}
+	}
+	packed_sub_file_entry_index = sub_file_entry_index - file_entry->packed_sub_file_entries_first_index;
+
+	packed_sub_file_entry = &( file_entry->packed_sub_file_entries[ packed_sub_file_entry_index ] );
+
+	if( ( packed_sub_file_entry->name_size == 0 )
+	 || ( packed_sub_file_entry->name_offset >= MOUNT_FILE_ENTRY_PACKED_SUB_FILE_ENTRIES_NAME_POOL_SIZE )
+	 || ( packed_sub_file_entry->name_size > ( MOUNT_FILE_ENTRY_PACKED_SUB_FILE_ENTRIES_NAME_POOL_SIZE - packed_sub_file_entry->name_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid packed sub file entry: %d - name value out of bounds.",
+		 function,
+		 sub_file_entry_index );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_mounted_timestamp(
+	     file_entry->file_system,
+	     &( attributes->inode_change_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mounted timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	attributes->identifier = packed_sub_file_entry->identifier;
+	attributes->size       = (size64_t) packed_sub_file_entry->size;
+
+	/* The file mode and timestamps are determined the same way
+	 * as for the file entry of the sub file entry
+	 */
+	attributes->file_mode = S_IFREG | 0444;
+
+#if defined( WINAPI )
+	attributes->access_time       = packed_sub_file_entry->access_time;
+	attributes->modification_time = packed_sub_file_entry->modification_time;
+#else
+	attributes->access_time       = 0;
+	attributes->modification_time = 0;
+
+	if( packed_sub_file_entry->access_time != 0 )
+	{
+		attributes->access_time = (uint64_t) ( ( (int64_t) packed_sub_file_entry->access_time - 116444736000000000L ) * 100 );
+	}
+	if( packed_sub_file_entry->modification_time != 0 )
+	{
+		attributes->modification_time = (uint64_t) ( ( (int64_t) packed_sub_file_entry->modification_time - 116444736000000000L ) * 100 );
+	}
+#endif
+	*utf8_name = &( file_entry->packed_sub_file_entries_name_pool[ packed_sub_file_entry->name_offset ] );
+
+	return( 1 );
+}
+
 /* Reads data at a specific offset
+ * Sequential reads smaller than the read-ahead size are served from a read-ahead buffer
  * Returns the number of bytes read or -1 on error
  */
 ssize_t mount_file_entry_read_buffer_at_offset(
@@ -821,6 +1069,7 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          libcerror_error_t **error )
 {
 	static char *function = "mount_file_entry_read_buffer_at_offset";
+	size_t buffer_offset  = 0;
 	ssize_t read_count    = 0;
 
 	if( file_entry == NULL )
@@ -834,64 +1083,649 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	read_count = libfsfat_file_entry_read_buffer_at_offset(
-	              file_entry->fsfat_file_entry,
-	              buffer,
-	              buffer_size,
-	              offset,
-	              error );
-
-	if( read_count < 0 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from file entry.",
-		 function,
-		 offset,
-		 offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
 		return( -1 );
 	}
-	return( read_count );
-}
-
-/* Retrieves the size
- * Returns 1 if successful or -1 on error
- */
-int mount_file_entry_get_size(
-     mount_file_entry_t *file_entry,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	static char *function = "mount_file_entry_get_size";
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
 
-	if( file_entry == NULL )
+		return( -1 );
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsfat_file_entry_get_size(
-	     file_entry->fsfat_file_entry,
-	     size,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_entry->read_ahead_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size from file entry.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead mutex.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	if( ( file_entry->read_ahead_buffer != NULL )
+	 && ( offset >= file_entry->read_ahead_offset )
+	 && ( (size64_t) ( offset - file_entry->read_ahead_offset ) < (size64_t) file_entry->read_ahead_data_size ) )
+	{
+		buffer_offset = (size_t) ( offset - file_entry->read_ahead_offset );
+
+		if( buffer_size <= ( file_entry->read_ahead_data_size - buffer_offset ) )
+		{
+			read_count = (ssize_t) buffer_size;
+		}
+		/* A read that ends beyond the read-ahead buffer at the end of the data
+		 * cannot be served with more data than the buffer contains
+		 */
+		else if( file_entry->read_ahead_data_size < MOUNT_FILE_ENTRY_READ_AHEAD_SIZE )
+		{
+			read_count = (ssize_t) ( file_entry->read_ahead_data_size - buffer_offset );
+		}
+		if( read_count > 0 )
+		{
+			if( memory_copy(
+			     buffer,
+			     &( file_entry->read_ahead_buffer[ buffer_offset ] ),
+			     (size_t) read_count ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( read_count == 0 )
+	 && ( buffer_size > 0 )
+	 && ( buffer_size < MOUNT_FILE_ENTRY_READ_AHEAD_SIZE )
+	 && ( offset == file_entry->next_read_offset ) )
+	{
+		if( file_entry->read_ahead_buffer == NULL )
+		{
+			file_entry->read_ahead_buffer = (uint8_t *) memory_allocate(
+			                                             sizeof( uint8_t ) * MOUNT_FILE_ENTRY_READ_AHEAD_SIZE );
+
+			if( file_entry->read_ahead_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create read-ahead buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		file_entry->read_ahead_offset    = offset;
+		file_entry->read_ahead_data_size = 0;
+
+		read_count = libfsfat_file_entry_read_buffer_at_offset(
+		              file_entry->fsfat_file_entry,
+		              file_entry->read_ahead_buffer,
+		              MOUNT_FILE_ENTRY_READ_AHEAD_SIZE,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read read-ahead buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from file entry.",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		file_entry->read_ahead_data_size = (size_t) read_count;
+
+		if( (size_t) read_count > buffer_size )
+		{
+			read_count = (ssize_t) buffer_size;
+		}
+		if( read_count > 0 )
+		{
+			if( memory_copy(
+			     buffer,
+			     file_entry->read_ahead_buffer,
+			     (size_t) read_count ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( ( read_count == 0 )
+	      && ( buffer_size > 0 ) )
+	{
+		read_count = libfsfat_file_entry_read_buffer_at_offset(
+		              file_entry->fsfat_file_entry,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from file entry.",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+	}
+	file_entry->next_read_offset = offset + (off64_t) read_count;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_entry->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_entry->read_ahead_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Updates the offset directly after the last read
+ * Returns 1 if the read continues the previous read, 0 if not or -1 on error
+ */
+int mount_file_entry_update_next_read_offset(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_update_next_read_offset";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_entry->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( offset == file_entry->next_read_offset )
+	{
+		result = 1;
+	}
+	file_entry->next_read_offset = offset + (off64_t) size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_entry->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_size(
+     mount_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_size";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_file_entry_get_size(
+	     file_entry->fsfat_file_entry,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from file entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier
+ * The identifier is stable for the lifetime of the mount and can be used as inode number
+ * The root directory uses MOUNT_FILE_ENTRY_ROOT_INODE_NUMBER since its file entry identifier
+ * is not unique
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_identifier(
+     mount_file_entry_t *file_entry,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_identifier";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->is_root != 0 )
+	{
+		*identifier = MOUNT_FILE_ENTRY_ROOT_INODE_NUMBER;
+
+		return( 1 );
+	}
+	if( libfsfat_file_entry_get_identifier(
+	     file_entry->fsfat_file_entry,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier from file entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data extents
+ * The extents are only kept if they map all of the data onto the volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_read_extents(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	mount_file_entry_extent_t *extents = NULL;
+	static char *function              = "mount_file_entry_read_extents";
+	size64_t data_size                 = 0;
+	size64_t extent_size               = 0;
+	off64_t data_offset                = 0;
+	off64_t extent_offset              = 0;
+	uint32_t extent_flags              = 0;
+	int extent_index                   = 0;
+	int number_of_extents              = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry - extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_file_entry_get_size(
+	     file_entry->fsfat_file_entry,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_file_entry_get_number_of_extents(
+	     file_entry->fsfat_file_entry,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents from file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size == 0 )
+	 || ( number_of_extents <= 0 ) )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_extents > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( mount_file_entry_extent_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of extents value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	extents = (mount_file_entry_extent_t *) memory_allocate(
+	                                         sizeof( mount_file_entry_extent_t ) * number_of_extents );
+
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extents.",
+		 function );
+
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( (size64_t) data_offset >= data_size )
+		{
+			break;
+		}
+		if( libfsfat_file_entry_get_extent_by_index(
+		     file_entry->fsfat_file_entry,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d from file entry.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		/* Only extents that are stored as-is in the volume can be mapped
+		 */
+		if( ( extent_flags != 0 )
+		 || ( extent_offset < 0 )
+		 || ( extent_size == 0 ) )
+		{
+			memory_free(
+			 extents );
+
+			return( 1 );
+		}
+		/* The last extent can contain more data than the file
+		 */
+		if( extent_size > ( data_size - (size64_t) data_offset ) )
+		{
+			extent_size = data_size - (size64_t) data_offset;
+		}
+		extents[ extent_index ].data_offset   = data_offset;
+		extents[ extent_index ].volume_offset = extent_offset;
+		extents[ extent_index ].size          = extent_size;
+
+		data_offset += (off64_t) extent_size;
+	}
+	if( (size64_t) data_offset < data_size )
+	{
+		memory_free(
+		 extents );
+
+		return( 1 );
+	}
+	file_entry->extents           = extents;
+	file_entry->number_of_extents = extent_index;
+
+	return( 1 );
+
+on_error:
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	return( -1 );
+}
+
+/* Retrieves the range in the volume that contains the data at a specific offset
+ * The range size is the number of bytes that are contiguous in the volume starting at the offset
+ * Returns 1 if successful, 0 if the data cannot be mapped onto the volume or -1 on error
+ */
+int mount_file_entry_get_volume_range_at_offset(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	mount_file_entry_extent_t *extent = NULL;
+	static char *function             = "mount_file_entry_get_volume_range_at_offset";
+	int extent_index                  = 0;
+	int lower_extent_index            = 0;
+	int upper_extent_index            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->extents == NULL )
+	{
+		return( 0 );
+	}
+	/* The extents are sorted by data offset
+	 */
+	upper_extent_index = file_entry->number_of_extents;
+
+	while( lower_extent_index < upper_extent_index )
+	{
+		extent_index = lower_extent_index + ( ( upper_extent_index - lower_extent_index ) / 2 );
+
+		extent = &( file_entry->extents[ extent_index ] );
+
+		if( offset < extent->data_offset )
+		{
+			upper_extent_index = extent_index;
+		}
+		else if( (size64_t) ( offset - extent->data_offset ) >= extent->size )
+		{
+			lower_extent_index = extent_index + 1;
+		}
+		else
+		{
+			*range_offset = extent->volume_offset + ( offset - extent->data_offset );
+			*range_size   = extent->size - (size64_t) ( offset - extent->data_offset );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
 }
 
@@ -26,13 +26,50 @@
 #include <types.h>
 
 #include "fsfattools_libcerror.h"
+#include "fsfattools_libcthreads.h"
 #include "fsfattools_libfsfat.h"
+#include "mount_attribute_cache.h"
 #include "mount_file_system.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The inode number of the root directory
+ * The root directory has no directory entry of its own and its file entry identifier
+ * can be the same as that of the first entry in a FAT-32 root directory
+ */
+#define MOUNT_FILE_ENTRY_ROOT_INODE_NUMBER				1
+
+/* The maximum number of packed sub file entries retrieved in one batch
+ */
+#define MOUNT_FILE_ENTRY_MAXIMUM_NUMBER_OF_PACKED_SUB_FILE_ENTRIES	256
+
+/* The size of the name pool of a batch of packed sub file entries
+ */
+#define MOUNT_FILE_ENTRY_PACKED_SUB_FILE_ENTRIES_NAME_POOL_SIZE		65536
+
+/* The size of the read-ahead buffer used for sequential reads
+ */
+#define MOUNT_FILE_ENTRY_READ_AHEAD_SIZE				( 1024 * 1024 )
+
+typedef struct mount_file_entry_extent mount_file_entry_extent_t;
+
+struct mount_file_entry_extent
+{
+	/* The offset of the extent in the data
+	 */
+	off64_t data_offset;
+
+	/* The offset of the extent in the volume
+	 */
+	off64_t volume_offset;
+
+	/* The size of the extent
+	 */
+	size64_t size;
+};
+
 typedef struct mount_file_entry mount_file_entry_t;
 
 struct mount_file_entry
@@ -52,6 +89,56 @@ struct mount_file_entry
 	/* The file entry
 	 */
 	libfsfat_file_entry_t *fsfat_file_entry;
+
+	/* Value to indicate the file entry is the root directory
+	 */
+	uint8_t is_root;
+
+	/* The packed sub file entries, used as a directory read cursor
+	 */
+	libfsfat_packed_file_entry_t *packed_sub_file_entries;
+
+	/* The name pool of the packed sub file entries
+	 */
+	uint8_t *packed_sub_file_entries_name_pool;
+
+	/* The index of the first packed sub file entry
+	 */
+	int packed_sub_file_entries_first_index;
+
+	/* The number of packed sub file entries
+	 */
+	int number_of_packed_sub_file_entries;
+
+	/* The data extents
+	 */
+	mount_file_entry_extent_t *extents;
+
+	/* The number of data extents
+	 */
+	int number_of_extents;
+
+	/* The offset directly after the last read, used to detect sequential reads
+	 */
+	off64_t next_read_offset;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_ahead_buffer;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t read_ahead_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_ahead_data_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read-ahead mutex
+	 */
+	libcthreads_mutex_t *read_ahead_mutex;
+#endif
 };
 
 int mount_file_entry_initialize(
@@ -113,6 +200,13 @@ int mount_file_entry_get_sub_file_entry_by_index(
      mount_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int mount_file_entry_get_packed_sub_file_entry_by_index(
+     mount_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     const uint8_t **utf8_name,
+     mount_attributes_t *attributes,
+     libcerror_error_t **error );
+
 ssize_t mount_file_entry_read_buffer_at_offset(
          mount_file_entry_t *file_entry,
          void *buffer,
@@ -120,11 +214,33 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+int mount_file_entry_update_next_read_offset(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_size(
      mount_file_entry_t *file_entry,
      size64_t *size,
      libcerror_error_t **error );
 
+int mount_file_entry_get_identifier(
+     mount_file_entry_t *file_entry,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
+int mount_file_entry_read_extents(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_volume_range_at_offset(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -35,12 +35,18 @@
 #include <unistd.h>
 #endif
 
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+#include <fcntl.h>
+#endif
+
 #include "fsfattools_libcerror.h"
 #include "fsfattools_libcnotify.h"
 #include "fsfattools_libfsfat.h"
 #include "fsfattools_unused.h"
+#include "mount_attribute_cache.h"
 #include "mount_fuse.h"
 #include "mount_handle.h"
+#include "mount_path_string.h"
 
 extern mount_handle_t *fsfatmount_mount_handle;
 
@@ -56,6 +62,7 @@ extern mount_handle_t *fsfatmount_mount_handle;
  */
 int mount_fuse_set_stat_info(
      struct stat *stat_info,
+     uint64_t inode_number,
      size64_t size,
      uint16_t file_mode,
      int64_t access_time,
@@ -91,6 +98,7 @@ int mount_fuse_set_stat_info(
 
 		return( -1 );
 	}
+	stat_info->st_ino   = (ino_t) inode_number;
 	stat_info->st_size  = (off_t) size;
 	stat_info->st_mode  = file_mode;
 
@@ -122,7 +130,8 @@ int mount_fuse_set_stat_info(
 }
 
 /* Fills a directory entry
- * Returns 1 if successful or -1 on error
+ * The offset is the offset of the next directory entry, where 0 represents none
+ * Returns 1 if successful, 0 if the buffer is full or -1 on error
  */
 int mount_fuse_filldir(
      void *buffer,
@@ -130,11 +139,14 @@ int mount_fuse_filldir(
      const char *name,
      struct stat *stat_info,
      mount_file_entry_t *file_entry,
+     off_t offset,
+     int fill_flags,
      libcerror_error_t **error )
 {
 	static char *function      = "mount_fuse_filldir";
 	size64_t file_size         = 0;
 	uint64_t access_time       = 0;
+	uint64_t identifier        = 0;
 	uint64_t inode_change_time = 0;
 	uint64_t modification_time = 0;
 	uint16_t file_mode         = 0;
@@ -152,6 +164,20 @@ int mount_fuse_filldir(
 	}
 	if( file_entry != NULL )
 	{
+		if( mount_file_entry_get_identifier(
+		     file_entry,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry identifier.",
+			 function );
+
+			return( -1 );
+		}
 		if( mount_file_entry_get_size(
 		     file_entry,
 		     &file_size,
@@ -239,6 +265,7 @@ int mount_fuse_filldir(
 	}
 	if( mount_fuse_set_stat_info(
 	     stat_info,
+	     identifier,
 	     file_size,
 	     file_mode,
 	     (int64_t) access_time,
@@ -260,25 +287,113 @@ int mount_fuse_filldir(
 	     buffer,
 	     name,
 	     stat_info,
-	     0,
-	     0 ) == 1 )
+	     offset,
+	     (enum fuse_fill_dir_flags) fill_flags ) == 1 )
 #else
+	FSFATTOOLS_UNREFERENCED_PARAMETER( fill_flags )
+
 	if( filler(
 	     buffer,
 	     name,
 	     stat_info,
-	     0 ) == 1 )
+	     offset ) == 1 )
 #endif
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Fills a directory entry from attributes
+ * The offset is the offset of the next directory entry, where 0 represents none
+ * Returns 1 if successful, 0 if the buffer is full or -1 on error
+ */
+int mount_fuse_filldir_attributes(
+     void *buffer,
+     fuse_fill_dir_t filler,
+     const char *name,
+     struct stat *stat_info,
+     const mount_attributes_t *attributes,
+     off_t offset,
+     int fill_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_fuse_filldir_attributes";
+
+	if( filler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filler.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     stat_info,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_fuse_set_stat_info(
+	     stat_info,
+	     attributes->identifier,
+	     attributes->size,
+	     attributes->file_mode,
+	     (int64_t) attributes->access_time,
+	     (int64_t) attributes->inode_change_time,
+	     (int64_t) attributes->modification_time,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set directory entry.",
+		 "%s: unable to set stat info.",
 		 function );
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFUSE3 )
+	if( filler(
+	     buffer,
+	     name,
+	     stat_info,
+	     offset,
+	     (enum fuse_fill_dir_flags) fill_flags ) == 1 )
+#else
+	FSFATTOOLS_UNREFERENCED_PARAMETER( fill_flags )
+
+	if( filler(
+	     buffer,
+	     name,
+	     stat_info,
+	     offset ) == 1 )
+#endif
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
@@ -372,6 +487,37 @@ int mount_fuse_open(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFUSE3 ) || ( defined( HAVE_LIBFUSE ) && ( FUSE_VERSION >= 29 ) )
+	if( fsfatmount_mount_handle->source_file_descriptor != -1 )
+	{
+		/* The extents are read on open so that concurrent reads can use them without locking
+		 * if they cannot be read the data is copied from the volume instead
+		 */
+		if( mount_file_entry_read_extents(
+		     (mount_file_entry_t *) file_info->fh,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read extents of file entry for path: %s.",
+			 function,
+			 path );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif
+	if( fsfatmount_mount_handle->cache_timeout > 0 )
+	{
+		/* The volume is read-only so data in the page cache remains valid
+		 */
+		file_info->keep_cache = 1;
+	}
 	return( 0 );
 
 on_error:
@@ -494,16 +640,39 @@ on_error:
 	return( result );
 }
 
-/* Releases a file entry
+#if defined( HAVE_LIBFUSE3 ) || ( defined( HAVE_LIBFUSE ) && ( FUSE_VERSION >= 29 ) )
+
+/* Reads a buffer of data at the specified offset into a buffer vector
+ * Data that is stored as-is in the source is referenced by file descriptor and offset
+ * so that it can be spliced, otherwise the data is read into memory
  * Returns 0 if successful or a negative errno value otherwise
  */
-int mount_fuse_release(
+int mount_fuse_read_buf(
      const char *path,
+     struct fuse_bufvec **buffer_vector,
+     size_t size,
+     off_t offset,
      struct fuse_file_info *file_info )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "mount_fuse_release";
-	int result               = 0;
+	struct fuse_bufvec *safe_buffer_vector = NULL;
+	libcerror_error_t *error               = NULL;
+	mount_file_entry_t *file_entry         = NULL;
+	void *buffer                           = NULL;
+	static char *function                  = "mount_fuse_read_buf";
+	size64_t data_size                     = 0;
+	size64_t range_size                    = 0;
+	size_t buffer_vector_size              = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	off64_t range_offset                   = 0;
+	off64_t read_offset                    = 0;
+	int buffer_index                       = 0;
+	int number_of_buffers                  = 0;
+	int result                             = 0;
+
+#if defined( POSIX_FADV_WILLNEED )
+	size_t read_ahead_size                 = 0;
+#endif
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -527,6 +696,45 @@ int mount_fuse_release(
 
 		goto on_error;
 	}
+	if( buffer_vector == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer vector.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( size > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
 	if( file_info == NULL )
 	{
 		libcerror_error_set(
@@ -540,24 +748,280 @@ int mount_fuse_release(
 
 		goto on_error;
 	}
-	if( file_info->fh != (uint64_t) NULL )
+	if( file_info->fh == (uint64_t) NULL )
 	{
-		if( mount_file_entry_free(
-		     (mount_file_entry_t **) &( file_info->fh ),
-		     &error ) != 1 )
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	file_entry = (mount_file_entry_t *) file_info->fh;
+
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &data_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( (size64_t) offset >= data_size )
+	{
+		size = 0;
+	}
+	else if( (size64_t) size > ( data_size - (size64_t) offset ) )
+	{
+		size = (size_t) ( data_size - (size64_t) offset );
+	}
+	/* Determine the number of contiguous ranges in the source that contain the data
+	 */
+	if( ( size > 0 )
+	 && ( fsfatmount_mount_handle->source_file_descriptor != -1 ) )
+	{
+		read_offset = (off64_t) offset;
+		read_size   = size;
+
+		while( read_size > 0 )
+		{
+			result = mount_file_entry_get_volume_range_at_offset(
+			          file_entry,
+			          read_offset,
+			          &range_offset,
+			          &range_size,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume range at offset: %" PRIi64 ".",
+				 function,
+				 read_offset );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				number_of_buffers = 0;
+
+				break;
+			}
+			if( range_size > (size64_t) read_size )
+			{
+				range_size = (size64_t) read_size;
+			}
+			read_offset += (off64_t) range_size;
+			read_size   -= (size_t) range_size;
+
+			number_of_buffers++;
+		}
+	}
+	if( number_of_buffers == 0 )
+	{
+		buffer_vector_size = sizeof( struct fuse_bufvec );
+	}
+	else
+	{
+		buffer_vector_size = sizeof( struct fuse_bufvec ) + ( sizeof( struct fuse_buf ) * ( number_of_buffers - 1 ) );
+	}
+	/* The buffer vector and memory buffers are freed by fuse
+	 */
+	safe_buffer_vector = (struct fuse_bufvec *) memory_allocate(
+	                                             buffer_vector_size );
+
+	if( safe_buffer_vector == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer vector.",
+		 function );
+
+		result = -ENOMEM;
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_buffer_vector,
+	     0,
+	     buffer_vector_size ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer vector.",
+		 function );
+
+		result = -ENOMEM;
+
+		goto on_error;
+	}
+	if( number_of_buffers > 0 )
+	{
+		read_offset = (off64_t) offset;
+		read_size   = size;
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( mount_file_entry_get_volume_range_at_offset(
+			     file_entry,
+			     read_offset,
+			     &range_offset,
+			     &range_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume range at offset: %" PRIi64 ".",
+				 function,
+				 read_offset );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			if( range_size > (size64_t) read_size )
+			{
+				range_size = (size64_t) read_size;
+			}
+			safe_buffer_vector->buf[ buffer_index ].size  = (size_t) range_size;
+			safe_buffer_vector->buf[ buffer_index ].flags = FUSE_BUF_IS_FD | FUSE_BUF_FD_SEEK;
+			safe_buffer_vector->buf[ buffer_index ].fd    = fsfatmount_mount_handle->source_file_descriptor;
+			safe_buffer_vector->buf[ buffer_index ].pos   = (off_t) ( fsfatmount_mount_handle->volume_offset + range_offset );
+
+			read_offset += (off64_t) range_size;
+			read_size   -= (size_t) range_size;
+		}
+		safe_buffer_vector->count = (size_t) number_of_buffers;
+
+		result = mount_file_entry_update_next_read_offset(
+		          file_entry,
+		          (off64_t) offset,
+		          size,
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file entry.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update next read offset.",
 			 function );
 
-			result = -ENOENT;
+			result = -EIO;
 
 			goto on_error;
 		}
+#if defined( POSIX_FADV_WILLNEED )
+		/* On sequential access ask the kernel to asynchronously read ahead
+		 * the volume ranges that contain the data following this read
+		 */
+		else if( result != 0 )
+		{
+			read_ahead_size = MOUNT_FILE_ENTRY_READ_AHEAD_SIZE;
+
+			while( ( read_ahead_size > 0 )
+			    && ( (size64_t) read_offset < data_size ) )
+			{
+				if( mount_file_entry_get_volume_range_at_offset(
+				     file_entry,
+				     read_offset,
+				     &range_offset,
+				     &range_size,
+				     NULL ) != 1 )
+				{
+					break;
+				}
+				if( range_size > (size64_t) read_ahead_size )
+				{
+					range_size = (size64_t) read_ahead_size;
+				}
+				/* The read-ahead is only a hint hence errors are ignored
+				 */
+				posix_fadvise(
+				 fsfatmount_mount_handle->source_file_descriptor,
+				 (off_t) ( fsfatmount_mount_handle->volume_offset + range_offset ),
+				 (off_t) range_size,
+				 POSIX_FADV_WILLNEED );
+
+				read_offset     += (off64_t) range_size;
+				read_ahead_size -= (size_t) range_size;
+			}
+		}
+#endif
+	}
+	else
+	{
+		if( size > 0 )
+		{
+			buffer = memory_allocate(
+			          size );
+
+			if( buffer == NULL )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create buffer.",
+				 function );
+
+				result = -ENOMEM;
+
+				goto on_error;
+			}
+			read_count = mount_file_entry_read_buffer_at_offset(
+			              file_entry,
+			              buffer,
+			              size,
+			              (off64_t) offset,
+			              &error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file entry.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		safe_buffer_vector->buf[ 0 ].size = (size_t) read_count;
+		safe_buffer_vector->buf[ 0 ].mem  = buffer;
+		safe_buffer_vector->count         = 1;
 	}
+	*buffer_vector = safe_buffer_vector;
+
 	return( 0 );
 
 on_error:
@@ -568,18 +1032,30 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( safe_buffer_vector != NULL )
+	{
+		memory_free(
+		 safe_buffer_vector );
+	}
 	return( result );
 }
 
-/* Opens a directory
+#endif /* defined( HAVE_LIBFUSE3 ) || ( defined( HAVE_LIBFUSE ) && ( FUSE_VERSION >= 29 ) ) */
+
+/* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
-int mount_fuse_opendir(
+int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info )
 {
 	libcerror_error_t *error = NULL;
-	static char *function    = "mount_fuse_opendir";
+	static char *function    = "mount_fuse_release";
 	int result               = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -619,19 +1095,96 @@ int mount_fuse_opendir(
 	}
 	if( file_info->fh != (uint64_t) NULL )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file information - file handle already set.",
-		 function );
-
-		result = -EINVAL;
-
-		goto on_error;
-	}
-	if( mount_handle_get_file_entry_by_path(
-	     fsfatmount_mount_handle,
+		if( mount_file_entry_free(
+		     (mount_file_entry_t **) &( file_info->fh ),
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -ENOENT;
+
+			goto on_error;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Opens a directory
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_opendir(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_opendir";
+	int result               = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh != (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file information - file handle already set.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( mount_handle_get_file_entry_by_path(
+	     fsfatmount_mount_handle,
 	     path,
 	     (mount_file_entry_t **) &( file_info->fh ),
 	     &error ) != 1 )
@@ -661,7 +1214,123 @@ on_error:
 	return( result );
 }
 
+/* Retrieves the file entry of the parent directory of a path
+ * The parent directory of the root directory is the root directory itself
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_fuse_get_parent_file_entry(
+     const char *path,
+     mount_file_entry_t **parent_file_entry,
+     libcerror_error_t **error )
+{
+	char *parent_path         = NULL;
+	static char *function     = "mount_fuse_get_parent_file_entry";
+	size_t parent_path_length = 0;
+	size_t path_length        = 0;
+	int result                = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	if( ( path_length >= 2 )
+	 && ( path[ path_length - 1 ] == '/' ) )
+	{
+		path_length--;
+	}
+	parent_path_length = path_length;
+
+	while( parent_path_length > 0 )
+	{
+		if( path[ parent_path_length - 1 ] == '/' )
+		{
+			break;
+		}
+		parent_path_length--;
+	}
+	/* Remove the trailing separator, except for the root directory
+	 */
+	if( parent_path_length > 1 )
+	{
+		parent_path_length--;
+	}
+	parent_path = narrow_string_allocate(
+	               parent_path_length + 1 );
+
+	if( parent_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parent path.",
+		 function );
+
+		goto on_error;
+	}
+	if( parent_path_length > 0 )
+	{
+		if( narrow_string_copy(
+		     parent_path,
+		     path,
+		     parent_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy parent path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	parent_path[ parent_path_length ] = 0;
+
+	result = mount_handle_get_file_entry_by_path(
+	          fsfatmount_mount_handle,
+	          parent_path,
+	          parent_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file entry.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 parent_path );
+
+	return( result );
+
+on_error:
+	if( parent_path != NULL )
+	{
+		memory_free(
+		 parent_path );
+	}
+	return( -1 );
+}
+
 /* Reads a directory
+ * The directory entries are identified by offset, where "." is at offset 0, ".." at offset 1
+ * and the sub file entries start at offset 2, which allows the directory to be read in multiple calls
  * Returns 0 if successful or a negative errno value otherwise
  */
 #if defined( HAVE_LIBFUSE3 )
@@ -669,41 +1338,44 @@ int mount_fuse_readdir(
      const char *path,
      void *buffer,
      fuse_fill_dir_t filler,
-     off_t offset FSFATTOOLS_ATTRIBUTE_UNUSED,
-     struct fuse_file_info *file_info FSFATTOOLS_ATTRIBUTE_UNUSED,
-     enum fuse_readdir_flags flags FSFATTOOLS_ATTRIBUTE_UNUSED )
+     off_t offset,
+     struct fuse_file_info *file_info,
+     enum fuse_readdir_flags flags )
 #else
 int mount_fuse_readdir(
      const char *path,
      void *buffer,
      fuse_fill_dir_t filler,
-     off_t offset FSFATTOOLS_ATTRIBUTE_UNUSED,
-     struct fuse_file_info *file_info FSFATTOOLS_ATTRIBUTE_UNUSED )
+     off_t offset,
+     struct fuse_file_info *file_info )
 #endif
 {
-	struct stat *stat_info             = NULL;
-	libcerror_error_t *error           = NULL;
-	mount_file_entry_t *sub_file_entry = NULL;
-	static char *function              = "mount_fuse_readdir";
-	char *name                         = NULL;
-	size_t name_size                   = 0;
-	int number_of_sub_file_entries     = 0;
-	int result                         = 0;
-	int sub_file_entry_index           = 0;
-
-	FSFATTOOLS_UNREFERENCED_PARAMETER( offset )
-
-#if defined( HAVE_LIBFUSE3 )
-	FSFATTOOLS_UNREFERENCED_PARAMETER( flags )
-#endif
+	mount_attributes_t attributes;
+
+	struct stat *stat_info                = NULL;
+	libcerror_error_t *error              = NULL;
+	mount_file_entry_t *file_entry        = NULL;
+	mount_file_entry_t *parent_file_entry = NULL;
+	const uint8_t *name                   = NULL;
+	char *escaped_name                    = NULL;
+	char *sub_path                        = NULL;
+	static char *function                 = "mount_fuse_readdir";
+	size_t escaped_name_size              = 0;
+	size_t name_length                    = 0;
+	size_t path_length                    = 0;
+	size_t sub_path_size                  = 0;
+	int fill_flags                        = 0;
+	int result                            = 0;
+	int sub_file_entry_index              = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: %s\n",
+		 "%s: %s at offset: %" PRIi64 "\n",
 		 function,
-		 path );
+		 path,
+		 (int64_t) offset );
 	}
 #endif
 	if( path == NULL )
@@ -719,6 +1391,19 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
 	if( file_info == NULL )
 	{
 		libcerror_error_set(
@@ -745,6 +1430,20 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
+	file_entry = (mount_file_entry_t *) file_info->fh;
+
+#if defined( HAVE_LIBFUSE3 )
+	/* In readdirplus mode the attributes are returned together with the names
+	 */
+	if( ( flags & FUSE_READDIR_PLUS ) != 0 )
+	{
+		fill_flags = FUSE_FILL_DIR_PLUS;
+	}
+#endif
+	if( offset > ( (off_t) INT_MAX + 1 ) )
+	{
+		return( 0 );
+	}
 	stat_info = memory_allocate_structure(
 	             struct stat );
 
@@ -757,130 +1456,179 @@ int mount_fuse_readdir(
 		 "%s: unable to create stat info.",
 		 function );
 
-		result = errno;
-
-		goto on_error;
-	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     ".",
-	     stat_info,
-	     (mount_file_entry_t *) file_info->fh,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set self directory entry.",
-		 function );
-
-		result = -EIO;
+		result = -ENOMEM;
 
 		goto on_error;
 	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     "..",
-	     stat_info,
-	     NULL,
-	     &error ) != 1 )
+	if( offset == 0 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent directory entry.",
-		 function );
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          ".",
+		          stat_info,
+		          file_entry,
+		          1,
+		          0,
+		          &error );
 
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_number_of_sub_file_entries(
-	     (mount_file_entry_t *) file_info->fh,
-	     &number_of_sub_file_entries,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
-	{
-		if( mount_file_entry_get_sub_file_entry_by_index(
-		     (mount_file_entry_t *) file_info->fh,
-		     sub_file_entry_index,
-		     &sub_file_entry,
-		     &error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set self directory entry.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_file_entry_get_name_size(
-		     sub_file_entry,
-		     &name_size,
-		     &error ) != 1 )
+		else if( result == 0 )
+		{
+			goto on_buffer_full;
+		}
+	}
+	if( offset <= 1 )
+	{
+		if( file_entry->is_root == 0 )
+		{
+			if( mount_fuse_get_parent_file_entry(
+			     path,
+			     &parent_file_entry,
+			     &error ) == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve parent file entry.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		/* The parent directory of the root directory is the root directory itself
+		 */
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          "..",
+		          stat_info,
+		          ( parent_file_entry != NULL ) ? parent_file_entry : file_entry,
+		          2,
+		          0,
+		          &error );
+
+		if( parent_file_entry != NULL )
+		{
+			if( mount_file_entry_free(
+			     &parent_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free parent file entry.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name size.",
-			 function,
-			 sub_file_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set parent directory entry.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		name = narrow_string_allocate(
-		        name_size );
+		else if( result == 0 )
+		{
+			goto on_buffer_full;
+		}
+		sub_file_entry_index = 0;
+	}
+	else
+	{
+		sub_file_entry_index = (int) ( offset - 2 );
+	}
+	if( fsfatmount_mount_handle->attribute_cache != NULL )
+	{
+		/* The path of a sub file entry consists of the path, a separator and the escaped name,
+		 * where a name is at most 255 characters and an escaped character is at most 10 bytes
+		 */
+		path_length = narrow_string_length(
+		               path );
 
-		if( name == NULL )
+		sub_path_size = path_length + 1 + ( 255 * 10 ) + 1;
+
+		sub_path = narrow_string_allocate(
+		            sub_path_size );
+
+		if( sub_path == NULL )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub file entry: %d name.",
+			 "%s: unable to create sub path.",
+			 function );
+
+			result = -ENOMEM;
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     sub_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
 			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_file_entry_get_name(
-		     sub_file_entry,
-		     name,
-		     name_size,
-		     &error ) != 1 )
+		if( ( path_length == 0 )
+		 || ( path[ path_length - 1 ] != '/' ) )
+		{
+			sub_path[ path_length++ ] = '/';
+		}
+	}
+	while( sub_file_entry_index < INT_MAX )
+	{
+		result = mount_file_entry_get_packed_sub_file_entry_by_index(
+		          file_entry,
+		          sub_file_entry_index,
+		          &name,
+		          &attributes,
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name.",
+			 "%s: unable to retrieve sub file entry: %d.",
 			 function,
 			 sub_file_entry_index );
 
@@ -888,39 +1636,103 @@ int mount_fuse_readdir(
 
 			goto on_error;
 		}
-		if( mount_fuse_filldir(
-		     buffer,
-		     filler,
-		     name,
-		     stat_info,
-		     sub_file_entry,
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* Escape the name the same way as mount_file_system_get_filename_from_file_entry
+		 */
+		name_length = narrow_string_length(
+		               (const char *) name );
+
+		if( mount_path_string_copy_from_file_entry_path(
+		     &escaped_name,
+		     &escaped_name_size,
+		     (const system_character_t *) name,
+		     name_length,
 		     &error ) != 1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set directory entry.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to escape sub file entry: %d name.",
+			 function,
+			 sub_file_entry_index );
 
 			result = -EIO;
 
 			goto on_error;
 		}
+		name_length = narrow_string_length(
+		               escaped_name );
+
+		if( sub_path != NULL )
+		{
+			if( name_length < ( sub_path_size - path_length ) )
+			{
+				if( narrow_string_copy(
+				     &( sub_path[ path_length ] ),
+				     escaped_name,
+				     name_length ) == NULL )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy sub file entry: %d name.",
+					 function,
+					 sub_file_entry_index );
+
+					result = -EIO;
+
+					goto on_error;
+				}
+				sub_path[ path_length + name_length ] = 0;
+
+				if( mount_attribute_cache_set_attributes_by_path(
+				     fsfatmount_mount_handle->attribute_cache,
+				     sub_path,
+				     path_length + name_length,
+				     &attributes,
+				     &error ) != 1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set attributes of sub file entry: %d in cache.",
+					 function,
+					 sub_file_entry_index );
+
+					result = -EIO;
+
+					goto on_error;
+				}
+			}
+		}
+		result = mount_fuse_filldir_attributes(
+		          buffer,
+		          filler,
+		          escaped_name,
+		          stat_info,
+		          &attributes,
+		          (off_t) sub_file_entry_index + 3,
+		          fill_flags,
+		          &error );
+
 		memory_free(
-		 name );
+		 escaped_name );
 
-		name = NULL;
+		escaped_name = NULL;
 
-		if( mount_file_entry_free(
-		     &sub_file_entry,
-		     &error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set directory entry: %d.",
 			 function,
 			 sub_file_entry_index );
 
@@ -928,6 +1740,22 @@ int mount_fuse_readdir(
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		sub_file_entry_index++;
+	}
+on_buffer_full:
+	if( escaped_name != NULL )
+	{
+		memory_free(
+		 escaped_name );
+	}
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
 	}
 	memory_free(
 	 stat_info );
@@ -942,16 +1770,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( name != NULL )
+	if( parent_file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &parent_file_entry,
+		 NULL );
+	}
+	if( escaped_name != NULL )
 	{
 		memory_free(
-		 name );
+		 escaped_name );
 	}
-	if( sub_file_entry != NULL )
+	if( sub_path != NULL )
 	{
-		mount_file_entry_free(
-		 &sub_file_entry,
-		 NULL );
+		memory_free(
+		 sub_path );
 	}
 	if( stat_info != NULL )
 	{
@@ -1009,7 +1842,21 @@ int mount_fuse_releasedir(
 	}
 	if( file_info->fh != (uint64_t) NULL )
 	{
-		file_info->fh = (uint64_t) NULL;
+		if( mount_file_entry_free(
+		     (mount_file_entry_t **) &( file_info->fh ),
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -ENOENT;
+
+			goto on_error;
+		}
 	}
 	return( 0 );
 
@@ -1031,26 +1878,27 @@ on_error:
 int mount_fuse_getattr(
      const char *path,
      struct stat *stat_info,
-     struct fuse_file_info *file_info FSFATTOOLS_ATTRIBUTE_UNUSED )
+     struct fuse_file_info *file_info )
 #else
 int mount_fuse_getattr(
      const char *path,
      struct stat *stat_info )
 #endif
 {
-	libcerror_error_t *error       = NULL;
-	mount_file_entry_t *file_entry = NULL;
-	static char *function          = "mount_fuse_getattr";
-	size64_t file_size             = 0;
-	uint64_t access_time           = 0;
-	uint64_t inode_change_time     = 0;
-	uint64_t modification_time     = 0;
-	uint16_t file_mode             = 0;
-	int result                     = 0;
-
-#if defined( HAVE_LIBFUSE3 )
-	FSFATTOOLS_UNREFERENCED_PARAMETER( file_info )
-#endif
+	mount_attributes_t attributes;
+
+	libcerror_error_t *error            = NULL;
+	mount_file_entry_t *file_entry      = NULL;
+	mount_file_entry_t *safe_file_entry = NULL;
+	static char *function               = "mount_fuse_getattr";
+	size64_t file_size                  = 0;
+	size_t path_length                  = 0;
+	uint64_t access_time                = 0;
+	uint64_t identifier                 = 0;
+	uint64_t inode_change_time          = 0;
+	uint64_t modification_time          = 0;
+	uint16_t file_mode                  = 0;
+	int result                          = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1103,32 +1951,112 @@ int mount_fuse_getattr(
 
 		goto on_error;
 	}
-	result = mount_handle_get_file_entry_by_path(
-	          fsfatmount_mount_handle,
-	          path,
-	          &file_entry,
-	          &error );
+	if( fsfatmount_mount_handle->attribute_cache != NULL )
+	{
+		path_length = narrow_string_length(
+		               path );
 
-	if( result == -1 )
+		result = mount_attribute_cache_get_attributes_by_path(
+		          fsfatmount_mount_handle->attribute_cache,
+		          path,
+		          path_length,
+		          &attributes,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attributes for: %s from cache.",
+			 function,
+			 path );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( mount_fuse_set_stat_info(
+			     stat_info,
+			     attributes.identifier,
+			     attributes.size,
+			     attributes.file_mode,
+			     (int64_t) attributes.access_time,
+			     (int64_t) attributes.inode_change_time,
+			     (int64_t) attributes.modification_time,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set stat info.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+	}
+#if defined( HAVE_LIBFUSE3 )
+	/* If the file is open use its file entry instead of resolving the path
+	 */
+	if( file_info != NULL )
+	{
+		safe_file_entry = (mount_file_entry_t *) file_info->fh;
+	}
+#endif
+	if( safe_file_entry == NULL )
+	{
+		result = mount_handle_get_file_entry_by_path(
+		          fsfatmount_mount_handle,
+		          path,
+		          &file_entry,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value for: %s.",
+			 function,
+			 path );
+
+			result = -ENOENT;
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( -ENOENT );
+		}
+		safe_file_entry = file_entry;
+	}
+	if( mount_file_entry_get_identifier(
+	     safe_file_entry,
+	     &identifier,
+	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value for: %s.",
-		 function,
-		 path );
+		 "%s: unable to retrieve file entry identifier.",
+		 function );
 
-		result = -ENOENT;
+		result = -EIO;
 
 		goto on_error;
 	}
-	else if( result == 0 )
-	{
-		return( -ENOENT );
-	}
 	if( mount_file_entry_get_size(
-	     file_entry,
+	     safe_file_entry,
 	     &file_size,
 	     &error ) != 1 )
 	{
@@ -1144,7 +2072,7 @@ int mount_fuse_getattr(
 		goto on_error;
 	}
 	if( mount_file_entry_get_file_mode(
-	     file_entry,
+	     safe_file_entry,
 	     &file_mode,
 	     &error ) != 1 )
 	{
@@ -1160,7 +2088,7 @@ int mount_fuse_getattr(
 		goto on_error;
 	}
 	if( mount_file_entry_get_access_time(
-	     file_entry,
+	     safe_file_entry,
 	     &access_time,
 	     &error ) != 1 )
 	{
@@ -1176,7 +2104,7 @@ int mount_fuse_getattr(
 		goto on_error;
 	}
 	if( mount_file_entry_get_modification_time(
-	     file_entry,
+	     safe_file_entry,
 	     &modification_time,
 	     &error ) != 1 )
 	{
@@ -1192,7 +2120,7 @@ int mount_fuse_getattr(
 		goto on_error;
 	}
 	if( mount_file_entry_get_inode_change_time(
-	     file_entry,
+	     safe_file_entry,
 	     &inode_change_time,
 	     &error ) != 1 )
 	{
@@ -1209,6 +2137,7 @@ int mount_fuse_getattr(
 	}
 	if( mount_fuse_set_stat_info(
 	     stat_info,
+	     identifier,
 	     file_size,
 	     file_mode,
 	     (int64_t) access_time,
@@ -1227,20 +2156,52 @@ int mount_fuse_getattr(
 
 		goto on_error;
 	}
-	if( mount_file_entry_free(
-	     &file_entry,
-	     &error ) != 1 )
+	if( fsfatmount_mount_handle->attribute_cache != NULL )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file entry.",
-		 function );
+		attributes.identifier        = identifier;
+		attributes.size              = file_size;
+		attributes.file_mode         = file_mode;
+		attributes.access_time       = access_time;
+		attributes.inode_change_time = inode_change_time;
+		attributes.modification_time = modification_time;
 
-		result = -EIO;
+		if( mount_attribute_cache_set_attributes_by_path(
+		     fsfatmount_mount_handle->attribute_cache,
+		     path,
+		     path_length,
+		     &attributes,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set attributes for: %s in cache.",
+			 function,
+			 path );
 
-		goto on_error;
+			result = -EIO;
+
+			goto on_error;
+		}
+	}
+	if( file_entry != NULL )
+	{
+		if( mount_file_entry_free(
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -EIO;
+
+			goto on_error;
+		}
 	}
 	return( 0 );
 
@@ -1261,6 +2222,35 @@ on_error:
 	return( result );
 }
 
+#if defined( HAVE_LIBFUSE3 )
+
+/* Initializes the file system
+ * Returns the private data
+ */
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_info FSFATTOOLS_ATTRIBUTE_UNUSED,
+       struct fuse_config *configuration )
+{
+	FSFATTOOLS_UNREFERENCED_PARAMETER( connection_info )
+
+	if( configuration != NULL )
+	{
+		/* Report the file entry identifiers as inode numbers
+		 */
+		configuration->use_ino = 1;
+
+		if( fsfatmount_mount_handle->cache_timeout > 0 )
+		{
+			configuration->entry_timeout    = (double) fsfatmount_mount_handle->cache_timeout;
+			configuration->attr_timeout     = (double) fsfatmount_mount_handle->cache_timeout;
+			configuration->negative_timeout = (double) fsfatmount_mount_handle->cache_timeout;
+		}
+	}
+	return( fuse_get_context()->private_data );
+}
+
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
 /* Cleans up when fuse is done
  */
 void mount_fuse_destroy(
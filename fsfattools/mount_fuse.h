@@ -30,9 +30,10 @@
 #if !defined( FUSE_USE_VERSION ) && !defined( CYGFUSE )
 
 /* Ensure FUSE_USE_VERSION is defined before including fuse.h
+ * Version 3.2 is required to pass the number of threads with fuse_loop_config
  */
 #if defined( HAVE_LIBFUSE3 )
-#define FUSE_USE_VERSION	30
+#define FUSE_USE_VERSION	32
 #else
 #define FUSE_USE_VERSION	26
 #endif
@@ -51,6 +52,7 @@
 
 #include "fsfattools_libcerror.h"
 #include "fsfattools_libfsfat.h"
+#include "mount_attribute_cache.h"
 #include "mount_file_entry.h"
 #include "mount_handle.h"
 
@@ -62,6 +64,7 @@ extern "C" {
 
 int mount_fuse_set_stat_info(
      struct stat *stat_info,
+     uint64_t inode_number,
      size64_t size,
      uint16_t file_mode,
      int64_t access_time,
@@ -75,6 +78,23 @@ int mount_fuse_filldir(
      const char *name,
      struct stat *stat_info,
      mount_file_entry_t *file_entry,
+     off_t offset,
+     int fill_flags,
+     libcerror_error_t **error );
+
+int mount_fuse_filldir_attributes(
+     void *buffer,
+     fuse_fill_dir_t filler,
+     const char *name,
+     struct stat *stat_info,
+     const mount_attributes_t *attributes,
+     off_t offset,
+     int fill_flags,
+     libcerror_error_t **error );
+
+int mount_fuse_get_parent_file_entry(
+     const char *path,
+     mount_file_entry_t **parent_file_entry,
      libcerror_error_t **error );
 
 int mount_fuse_open(
@@ -88,6 +108,15 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( HAVE_LIBFUSE3 ) || ( defined( HAVE_LIBFUSE ) && ( FUSE_VERSION >= 29 ) )
+int mount_fuse_read_buf(
+     const char *path,
+     struct fuse_bufvec **buffer_vector,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
@@ -128,6 +157,12 @@ int mount_fuse_getattr(
      struct stat *stat_info );
 #endif
 
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_info,
+       struct fuse_config *configuration );
+#endif
+
 void mount_fuse_destroy(
       void *private_data );
 
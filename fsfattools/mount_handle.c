@@ -26,10 +26,19 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "fsfattools_libbfio.h"
 #include "fsfattools_libcerror.h"
 #include "fsfattools_libcpath.h"
 #include "fsfattools_libfsfat.h"
+#include "mount_attribute_cache.h"
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
 #include "mount_handle.h"
@@ -215,6 +224,9 @@ int mount_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	( *mount_handle )->source_file_descriptor = -1;
+#endif
 	if( mount_file_system_initialize(
 	     &( ( *mount_handle )->file_system ),
 	     error ) != 1 )
@@ -264,6 +276,22 @@ int mount_handle_free(
 	}
 	if( *mount_handle != NULL )
 	{
+		if( ( *mount_handle )->attribute_cache != NULL )
+		{
+			if( mount_attribute_cache_free(
+			     &( ( *mount_handle )->attribute_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attribute cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( mount_file_system_free(
 		     &( ( *mount_handle )->file_system ),
 		     error ) != 1 )
@@ -277,6 +305,26 @@ int mount_handle_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+		/* The source file descriptor is still open if mount_handle_close was not called
+		 */
+		if( ( *mount_handle )->source_file_descriptor != -1 )
+		{
+			if( close(
+			     ( *mount_handle )->source_file_descriptor ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close source file descriptor.",
+				 function );
+
+				result = -1;
+			}
+			( *mount_handle )->source_file_descriptor = -1;
+		}
+#endif
 		memory_free(
 		 *mount_handle );
 
@@ -425,6 +473,139 @@ int mount_handle_set_offset(
 	return( 1 );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_number_of_threads(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) MOUNT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the cache timeout
+ * A cache timeout other than 0 also enables the attribute cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_cache_timeout(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_cache_timeout";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) MOUNT_HANDLE_MAXIMUM_CACHE_TIMEOUT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache timeout value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit != 0 )
+	 && ( mount_handle->attribute_cache == NULL ) )
+	{
+		if( mount_attribute_cache_initialize(
+		     &( mount_handle->attribute_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize attribute cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	mount_handle->cache_timeout = (int) value_64bit;
+
+	return( 1 );
+}
+
 /* Sets the password
  * Returns 1 if successful or -1 on error
  */
@@ -645,6 +826,14 @@ int mount_handle_open(
 	}
 	mount_handle->file_io_handle = file_io_handle;
 
+#if ( defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The source is opened a second time so that the kernel can splice data directly from it,
+	 * if this fails the data is read using the volume
+	 */
+	mount_handle->source_file_descriptor = open(
+	                                        filename,
+	                                        O_RDONLY );
+#endif
 	return( 1 );
 
 on_error:
@@ -727,6 +916,24 @@ int mount_handle_close(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	if( mount_handle->source_file_descriptor != -1 )
+	{
+		if( close(
+		     mount_handle->source_file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source file descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		mount_handle->source_file_descriptor = -1;
+	}
+#endif
 	if( libbfio_handle_close(
 	     mount_handle->file_io_handle,
 	     error ) != 0 )
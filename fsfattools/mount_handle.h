@@ -29,6 +29,7 @@
 #include "fsfattools_libbfio.h"
 #include "fsfattools_libcerror.h"
 #include "fsfattools_libfsfat.h"
+#include "mount_attribute_cache.h"
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
 
@@ -36,6 +37,12 @@
 extern "C" {
 #endif
 
+#define MOUNT_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum cache timeout in seconds
+ */
+#define MOUNT_HANDLE_MAXIMUM_CACHE_TIMEOUT	86400
+
 typedef struct mount_handle mount_handle_t;
 
 struct mount_handle
@@ -75,6 +82,24 @@ struct mount_handle
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
+
+	/* The number of threads used to serve requests
+	 */
+	int number_of_threads;
+
+	/* The number of seconds attributes and data can be cached, where 0 represents the defaults
+	 */
+	int cache_timeout;
+
+	/* The attribute cache
+	 */
+	mount_attribute_cache_t *attribute_cache;
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 )
+	/* The source file descriptor, used to splice data from the source
+	 */
+	int source_file_descriptor;
+#endif
 };
 
 int mount_handle_system_string_copy_from_64_bit_in_decimal(
@@ -105,6 +130,16 @@ int mount_handle_set_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int mount_handle_set_number_of_threads(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_set_cache_timeout(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int mount_handle_set_password(
      mount_handle_t *mount_handle,
      const system_character_t *string,
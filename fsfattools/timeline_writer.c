@@ -0,0 +1,1097 @@
+/*
+ * Timeline writer
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "digest_hash.h"
+#include "fsfattools_libcerror.h"
+#include "fsfattools_libuna.h"
+#include "timeline_writer.h"
+
+/* Creates a timeline writer
+ * Make sure the value timeline_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_initialize(
+     timeline_writer_t **timeline_writer,
+     FILE *stream,
+     int format,
+     uint8_t digest_types,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_initialize";
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != TIMELINE_WRITER_FORMAT_BODYFILE )
+	 && ( format != TIMELINE_WRITER_FORMAT_CSV )
+	 && ( format != TIMELINE_WRITER_FORMAT_JSONL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*timeline_writer = memory_allocate_structure(
+	                    timeline_writer_t );
+
+	if( *timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *timeline_writer,
+	     0,
+	     sizeof( timeline_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline writer.",
+		 function );
+
+		memory_free(
+		 *timeline_writer );
+
+		*timeline_writer = NULL;
+
+		return( -1 );
+	}
+	( *timeline_writer )->buffer = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * TIMELINE_WRITER_BUFFER_SIZE );
+
+	if( ( *timeline_writer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *timeline_writer )->buffer_size  = TIMELINE_WRITER_BUFFER_SIZE;
+	( *timeline_writer )->stream       = stream;
+	( *timeline_writer )->format       = format;
+	( *timeline_writer )->digest_types = digest_types;
+
+	return( 1 );
+
+on_error:
+	if( *timeline_writer != NULL )
+	{
+		memory_free(
+		 *timeline_writer );
+
+		*timeline_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a timeline writer
+ * The buffered output is flushed, the stream is not closed
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_free(
+     timeline_writer_t **timeline_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_free";
+	int result            = 1;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_writer != NULL )
+	{
+		if( timeline_writer_flush(
+		     *timeline_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush timeline writer.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *timeline_writer )->buffer );
+
+		memory_free(
+		 *timeline_writer );
+
+		*timeline_writer = NULL;
+	}
+	return( result );
+}
+
+/* Writes the buffered output to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_flush(
+     timeline_writer_t *timeline_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_flush";
+	size_t write_count    = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	write_count = file_stream_write(
+	               timeline_writer->stream,
+	               timeline_writer->buffer,
+	               timeline_writer->buffer_offset );
+
+	if( write_count != timeline_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to stream.",
+		 function );
+
+		return( -1 );
+	}
+	timeline_writer->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Appends data to the buffered output
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_append_data(
+     timeline_writer_t *timeline_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_append_data";
+	size_t write_count    = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( timeline_writer->buffer_size - timeline_writer->buffer_offset ) )
+	{
+		if( timeline_writer_flush(
+		     timeline_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush timeline writer.",
+			 function );
+
+			return( -1 );
+		}
+		/* Data that does not fit in the buffer is written directly
+		 */
+		if( data_size > timeline_writer->buffer_size )
+		{
+			write_count = file_stream_write(
+			               timeline_writer->stream,
+			               data,
+			               data_size );
+
+			if( write_count != data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data to stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( memory_copy(
+	     &( timeline_writer->buffer[ timeline_writer->buffer_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	timeline_writer->buffer_offset += data_size;
+
+	return( 1 );
+}
+
+/* Appends a narrow string to the buffered output
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_append_string(
+     timeline_writer_t *timeline_writer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_append_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer_append_data(
+	     timeline_writer,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit value as a decimal string to the buffered output
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_append_decimal(
+     timeline_writer_t *timeline_writer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	uint8_t decimal_string[ 20 ];
+
+	static char *function       = "timeline_writer_append_decimal";
+	size_t decimal_string_index = 20;
+
+	do
+	{
+		decimal_string_index--;
+
+		decimal_string[ decimal_string_index ] = (uint8_t) '0' + (uint8_t) ( value % 10 );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( timeline_writer_append_data(
+	     timeline_writer,
+	     &( decimal_string[ decimal_string_index ] ),
+	     20 - decimal_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append decimal string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a timestamp to the buffered output
+ * The timestamp is a number of 10 milli seconds since January 1, 1970
+ * and is written as a number of seconds with an optional fraction of 2 digits
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_append_timestamp(
+     timeline_writer_t *timeline_writer,
+     uint64_t timestamp,
+     uint8_t include_fraction,
+     libcerror_error_t **error )
+{
+	uint8_t fraction_string[ 3 ];
+
+	static char *function = "timeline_writer_append_timestamp";
+
+	if( timeline_writer_append_decimal(
+	     timeline_writer,
+	     timestamp / 100,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( include_fraction != 0 )
+	{
+		fraction_string[ 0 ] = (uint8_t) '.';
+		fraction_string[ 1 ] = (uint8_t) '0' + (uint8_t) ( ( timestamp % 100 ) / 10 );
+		fraction_string[ 2 ] = (uint8_t) '0' + (uint8_t) ( timestamp % 10 );
+
+		if( timeline_writer_append_data(
+		     timeline_writer,
+		     fraction_string,
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append fraction.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a name to the buffered output
+ * The name is written as UTF-8 and escaped according to the output format
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_append_name(
+     timeline_writer_t *timeline_writer,
+     const system_character_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static uint8_t hexadecimal_digits[ 16 ] = {
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+	uint8_t *buffer                              = NULL;
+	static char *function                        = "timeline_writer_append_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t buffer_offset                         = 0;
+	size_t name_index                            = 0;
+	int result                                   = 0;
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	buffer        = timeline_writer->buffer;
+	buffer_offset = timeline_writer->buffer_offset;
+
+	while( name_index < name_length )
+	{
+		/* An escaped or UTF-8 encoded character requires at most 6 bytes
+		 */
+		if( ( timeline_writer->buffer_size - buffer_offset ) < 6 )
+		{
+			timeline_writer->buffer_offset = buffer_offset;
+
+			if( timeline_writer_flush(
+			     timeline_writer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush timeline writer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset = 0;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libuna_unicode_character_copy_from_utf16(
+		          &unicode_character,
+		          (libuna_utf16_character_t *) name,
+		          name_length,
+		          &name_index,
+		          error );
+#else
+		result = libuna_unicode_character_copy_from_utf8(
+		          &unicode_character,
+		          (libuna_utf8_character_t *) name,
+		          name_length,
+		          &name_index,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from name.",
+			 function );
+
+			timeline_writer->buffer_offset = buffer_offset;
+
+			return( -1 );
+		}
+		/* Replace:
+		 *   Control characters ([U+0-U+1f, U+7f-U+9f]) by \x## or by \u00## for JSON
+		 */
+		if( ( unicode_character <= 0x1f )
+		 || ( ( unicode_character >= 0x7f )
+		  &&  ( unicode_character <= 0x9f ) ) )
+		{
+			buffer[ buffer_offset++ ] = (uint8_t) '\\';
+
+			if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+			{
+				buffer[ buffer_offset++ ] = (uint8_t) 'u';
+				buffer[ buffer_offset++ ] = (uint8_t) '0';
+				buffer[ buffer_offset++ ] = (uint8_t) '0';
+			}
+			else
+			{
+				buffer[ buffer_offset++ ] = (uint8_t) 'x';
+			}
+			buffer[ buffer_offset++ ] = hexadecimal_digits[ ( unicode_character >> 4 ) & 0x0f ];
+			buffer[ buffer_offset++ ] = hexadecimal_digits[ unicode_character & 0x0f ];
+
+			continue;
+		}
+		/* Replace:
+		 *   " by "" for CSV
+		 *   " and \ by \" and \\ for JSON
+		 */
+		if( timeline_writer->format == TIMELINE_WRITER_FORMAT_CSV )
+		{
+			if( unicode_character == (libuna_unicode_character_t) '"' )
+			{
+				buffer[ buffer_offset++ ] = (uint8_t) '"';
+			}
+		}
+		else if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+		{
+			if( ( unicode_character == (libuna_unicode_character_t) '"' )
+			 || ( unicode_character == (libuna_unicode_character_t) '\\' ) )
+			{
+				buffer[ buffer_offset++ ] = (uint8_t) '\\';
+			}
+		}
+		if( unicode_character < 0x80 )
+		{
+			buffer[ buffer_offset++ ] = (uint8_t) unicode_character;
+		}
+		else if( libuna_unicode_character_copy_to_utf8(
+		          unicode_character,
+		          (libuna_utf8_character_t *) buffer,
+		          timeline_writer->buffer_size,
+		          &buffer_offset,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to buffer.",
+			 function );
+
+			timeline_writer->buffer_offset = buffer_offset;
+
+			return( -1 );
+		}
+	}
+	timeline_writer->buffer_offset = buffer_offset;
+
+	return( 1 );
+}
+
+/* Writes the header of the output format if it has one
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_write_header(
+     timeline_writer_t *timeline_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "timeline_writer_write_header";
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeline_writer->format != TIMELINE_WRITER_FORMAT_CSV )
+	{
+		return( 1 );
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     "md5,name,inode,mode,uid,gid,size,atime,mtime,ctime,crtime",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( timeline_writer->digest_types & DIGEST_HASH_TYPE_SHA1 ) != 0 )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ",sha1",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( timeline_writer->digest_types & DIGEST_HASH_TYPE_SHA256 ) != 0 )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ",sha256",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     "\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append header.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes a timeline entry
+ * The path and name are concatenated, the timestamps are a number of 10 milli seconds
+ * since January 1, 1970 or 0 if not set
+ * Returns 1 if successful or -1 on error
+ */
+int timeline_writer_write_entry(
+     timeline_writer_t *timeline_writer,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *name,
+     size_t name_length,
+     uint64_t inode,
+     const char *mode_string,
+     size64_t size,
+     uint64_t access_time,
+     uint64_t modification_time,
+     uint8_t modification_time_has_fraction,
+     uint64_t creation_time,
+     const char *md5_string,
+     const char *sha1_string,
+     const char *sha256_string,
+     libcerror_error_t **error )
+{
+	const char *column_separator = NULL;
+	const char *name_quote       = NULL;
+	static char *function        = "timeline_writer_write_entry";
+
+	if( timeline_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode_string == NULL )
+	 || ( md5_string == NULL )
+	 || ( sha1_string == NULL )
+	 || ( sha256_string == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( timeline_writer->number_of_entries == 0 )
+	 && ( timeline_writer->format == TIMELINE_WRITER_FORMAT_CSV ) )
+	{
+		if( timeline_writer_write_header(
+		     timeline_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to write header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Colums in a Sleuthkit 3.x and later bodyfile
+	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+	 * the CSV and JSON Lines formats use the same columns
+	 */
+	if( ( timeline_writer->digest_types & DIGEST_HASH_TYPE_MD5 ) == 0 )
+	{
+		md5_string = "0";
+	}
+	switch( timeline_writer->format )
+	{
+		case TIMELINE_WRITER_FORMAT_CSV:
+			column_separator = ",";
+			name_quote       = "\"";
+			break;
+
+		case TIMELINE_WRITER_FORMAT_JSONL:
+			column_separator = ",";
+			name_quote       = "\"";
+			break;
+
+		default:
+			column_separator = "|";
+			name_quote       = "";
+			break;
+	}
+	if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     "{\"md5\":\"",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     md5_string,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     "\",\"name\":\"",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     column_separator,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     name_quote,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( path != NULL )
+	{
+		if( timeline_writer_append_name(
+		     timeline_writer,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( name != NULL )
+	{
+		if( timeline_writer_append_name(
+		     timeline_writer,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     name_quote,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ",\"inode\":",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     column_separator,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( timeline_writer_append_decimal(
+	     timeline_writer,
+	     inode,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ",\"mode\":\"",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     mode_string,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     "\",\"uid\":0,\"gid\":0,\"size\":",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     column_separator,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     mode_string,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_CSV ) ? ",0,0," : "|0|0|",
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( timeline_writer_append_decimal(
+	     timeline_writer,
+	     (uint64_t) size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL ) ? ",\"atime\":" : column_separator,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer_append_timestamp(
+	     timeline_writer,
+	     access_time,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL ) ? ",\"mtime\":" : column_separator,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer_append_timestamp(
+	     timeline_writer,
+	     modification_time,
+	     modification_time_has_fraction,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL ) ? ",\"ctime\":0,\"crtime\":" : ( timeline_writer->format == TIMELINE_WRITER_FORMAT_CSV ) ? ",0," : "|0|",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( timeline_writer_append_timestamp(
+	     timeline_writer,
+	     creation_time,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Additional digest hashes are appended as columns
+	 */
+	if( ( timeline_writer->digest_types & DIGEST_HASH_TYPE_SHA1 ) != 0 )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL ) ? ",\"sha1\":\"" : column_separator,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     sha1_string,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+		{
+			if( timeline_writer_append_string(
+			     timeline_writer,
+			     "\"",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	if( ( timeline_writer->digest_types & DIGEST_HASH_TYPE_SHA256 ) != 0 )
+	{
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL ) ? ",\"sha256\":\"" : column_separator,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer_append_string(
+		     timeline_writer,
+		     sha256_string,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL )
+		{
+			if( timeline_writer_append_string(
+			     timeline_writer,
+			     "\"",
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	if( timeline_writer_append_string(
+	     timeline_writer,
+	     ( timeline_writer->format == TIMELINE_WRITER_FORMAT_JSONL ) ? "}\n" : "\n",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	timeline_writer->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append entry.",
+	 function );
+
+	return( -1 );
+}
+
@@ -0,0 +1,149 @@
+/*
+ * Timeline writer
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TIMELINE_WRITER_H )
+#define _TIMELINE_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsfattools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the output buffer
+ */
+#define TIMELINE_WRITER_BUFFER_SIZE	( 1024 * 1024 )
+
+enum TIMELINE_WRITER_FORMATS
+{
+	TIMELINE_WRITER_FORMAT_BODYFILE	= 1,
+	TIMELINE_WRITER_FORMAT_CSV	= 2,
+	TIMELINE_WRITER_FORMAT_JSONL	= 3
+};
+
+typedef struct timeline_writer timeline_writer_t;
+
+struct timeline_writer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The output format
+	 */
+	int format;
+
+	/* The digest types that are written
+	 */
+	uint8_t digest_types;
+
+	/* The output buffer
+	 */
+	uint8_t *buffer;
+
+	/* The output buffer size
+	 */
+	size_t buffer_size;
+
+	/* The output buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The number of entries written
+	 */
+	uint64_t number_of_entries;
+};
+
+int timeline_writer_initialize(
+     timeline_writer_t **timeline_writer,
+     FILE *stream,
+     int format,
+     uint8_t digest_types,
+     libcerror_error_t **error );
+
+int timeline_writer_free(
+     timeline_writer_t **timeline_writer,
+     libcerror_error_t **error );
+
+int timeline_writer_flush(
+     timeline_writer_t *timeline_writer,
+     libcerror_error_t **error );
+
+int timeline_writer_append_data(
+     timeline_writer_t *timeline_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int timeline_writer_append_string(
+     timeline_writer_t *timeline_writer,
+     const char *string,
+     libcerror_error_t **error );
+
+int timeline_writer_append_decimal(
+     timeline_writer_t *timeline_writer,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int timeline_writer_append_timestamp(
+     timeline_writer_t *timeline_writer,
+     uint64_t timestamp,
+     uint8_t include_fraction,
+     libcerror_error_t **error );
+
+int timeline_writer_append_name(
+     timeline_writer_t *timeline_writer,
+     const system_character_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int timeline_writer_write_header(
+     timeline_writer_t *timeline_writer,
+     libcerror_error_t **error );
+
+int timeline_writer_write_entry(
+     timeline_writer_t *timeline_writer,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *name,
+     size_t name_length,
+     uint64_t inode,
+     const char *mode_string,
+     size64_t size,
+     uint64_t access_time,
+     uint64_t modification_time,
+     uint8_t modification_time_has_fraction,
+     uint64_t creation_time,
+     const char *md5_string,
+     const char *sha1_string,
+     const char *sha256_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TIMELINE_WRITER_H ) */
+
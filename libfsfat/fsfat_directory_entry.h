@@ -73,10 +73,11 @@ struct fsfat_directory_entry
 	 */
 	uint8_t access_date[ 2 ];
 
-	/* Unknown
+	/* The data start cluster upper 16-bit
 	 * Consists of 2 bytes
+	 * Only used by FAT-32
 	 */
-	uint8_t unknown3[ 2 ];
+	uint8_t data_start_cluster_upper[ 2 ];
 
 	/* The (last) modification time
 	 * Consists of 2 bytes
@@ -0,0 +1,85 @@
+/*
+ * Metadata index file definitions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSFAT_INDEX_H )
+#define _FSFAT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsfat_index_file_header fsfat_index_file_header_t;
+
+struct fsfat_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "FSFATIDX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_blocks[ 4 ];
+
+	/* The boot record checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the boot record data
+	 */
+	uint8_t boot_record_checksum[ 4 ];
+
+	/* The allocation table checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the allocation table data
+	 */
+	uint8_t allocation_table_checksum[ 4 ];
+};
+
+typedef struct fsfat_index_block_header fsfat_index_block_header_t;
+
+struct fsfat_index_block_header
+{
+	/* The offset of the block data in the volume
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+
+	/* The block data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSFAT_INDEX_H ) */
+
@@ -25,12 +25,14 @@
 #include <types.h>
 
 #include "libfsfat_allocation_table.h"
+#include "libfsfat_checksum.h"
 #include "libfsfat_debug.h"
 #include "libfsfat_definitions.h"
 #include "libfsfat_io_handle.h"
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcerror.h"
 #include "libfsfat_libcnotify.h"
+#include "libfsfat_statistics.h"
 
 /* Creates an allocation table
  * Make sure the value allocation_table is referencing, is set to NULL
@@ -212,8 +214,10 @@ int libfsfat_allocation_table_read_file_io_handle(
 	static char *function    = "libfsfat_allocation_table_read_file_io_handle";
 	size_t read_size         = 0;
 	size_t table_data_offset = 0;
+	size_t table_data_size   = 0;
 	size_t table_offset      = 0;
 	ssize_t read_count       = 0;
+	uint64_t decode_time     = 0;
 	uint32_t cluster_number  = 0;
 	int table_index          = 0;
 
@@ -250,10 +254,19 @@ int libfsfat_allocation_table_read_file_io_handle(
 
 		return( -1 );
 	}
+	/* Read multiple sectors at once, the number of sectors is a multiple of 3
+	 * so that a pair of FAT-12 cluster numbers is never split between reads
+	 */
+	table_data_size = (size_t) io_handle->bytes_per_sector * LIBFSFAT_ALLOCATION_TABLE_READ_NUMBER_OF_SECTORS;
+
+	if( (size64_t) table_data_size > size )
+	{
+		table_data_size = (size_t) size;
+	}
 	/* Add 2 bytes to ensure we can read 3 bytes from the table data buffer
 	 */
 	table_data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->bytes_per_sector + 2 );
+	                          table_data_size + 2 );
 
 	if( table_data == NULL )
 	{
@@ -266,10 +279,9 @@ int libfsfat_allocation_table_read_file_io_handle(
 
 		goto on_error;
 	}
-	table_data[ io_handle->bytes_per_sector     ] = 0;
-	table_data[ io_handle->bytes_per_sector + 1 ] = 0;
+	read_size = table_data_size;
 
-	read_size = io_handle->bytes_per_sector;
+	allocation_table->checksum = 0;
 
 	while( table_offset < size )
 	{
@@ -277,6 +289,9 @@ int libfsfat_allocation_table_read_file_io_handle(
 		{
 			read_size = (size_t) size - table_offset;
 		}
+		table_data[ read_size     ] = 0;
+		table_data[ read_size + 1 ] = 0;
+
 		read_count = libbfio_handle_read_buffer_at_offset(
 		              file_io_handle,
 		              table_data,
@@ -297,11 +312,42 @@ int libfsfat_allocation_table_read_file_io_handle(
 
 			goto on_error;
 		}
+		LIBFSFAT_STATISTICS_ADD(
+		 io_handle->statistics.number_of_read_calls,
+		 1 );
+
+		LIBFSFAT_STATISTICS_ADD(
+		 io_handle->statistics.number_of_bytes_read,
+		 read_size );
+
+		/* The checksum of the table data is used to validate a metadata index
+		 */
+		if( libfsfat_checksum_calculate_crc32(
+		     &( allocation_table->checksum ),
+		     table_data,
+		     read_size,
+		     allocation_table->checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate allocation table checksum.",
+			 function );
+
+			goto on_error;
+		}
 		file_offset  += read_size;
 		table_offset += read_size;
 
 		table_data_offset = 0;
 
+		if( ( io_handle->statistics.flags & LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) != 0 )
+		{
+			decode_time = libfsfat_statistics_get_timestamp();
+		}
+
 		while( table_data_offset < read_size )
 		{
 			if( table_index >= allocation_table->number_of_cluster_numbers )
@@ -464,6 +510,12 @@ int libfsfat_allocation_table_read_file_io_handle(
 			}
 			table_index++;
 		}
+		if( ( io_handle->statistics.flags & LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) != 0 )
+		{
+			LIBFSFAT_STATISTICS_ADD(
+			 io_handle->statistics.allocation_table_decode_time,
+			 libfsfat_statistics_get_timestamp() - decode_time );
+		}
 	}
 	memory_free(
 	 table_data );
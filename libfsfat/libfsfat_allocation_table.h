@@ -44,6 +44,10 @@ struct libfsfat_allocation_table
 	/* The cluster numbers
 	 */
 	uint32_t *cluster_numbers;
+
+	/* The CRC-32 of the allocation table data
+	 */
+	uint32_t checksum;
 };
 
 int libfsfat_allocation_table_initialize(
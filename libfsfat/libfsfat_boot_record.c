@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libfsfat_boot_record.h"
+#include "libfsfat_checksum.h"
 #include "libfsfat_definitions.h"
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcerror.h"
@@ -987,6 +988,22 @@ int libfsfat_boot_record_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfsfat_checksum_calculate_crc32(
+	     &( boot_record->checksum ),
+	     boot_record_data,
+	     sizeof( fsfat_boot_record_fat12_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate boot record checksum.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
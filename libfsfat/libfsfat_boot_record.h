@@ -79,6 +79,10 @@ struct libfsfat_boot_record
 	/* The first cluster offset
 	 */
 	off64_t first_cluster_offset;
+
+	/* The CRC-32 of the boot record data
+	 */
+	uint32_t checksum;
 };
 
 int libfsfat_boot_record_initialize(
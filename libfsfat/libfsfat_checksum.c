@@ -0,0 +1,140 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsfat_checksum.h"
+#include "libfsfat_libcerror.h"
+
+/* Table of CRC-32 values of 8-bit values
+ */
+uint32_t libfsfat_checksum_crc32_table[ 256 ];
+
+/* Value to indicate the CRC-32 table been computed
+ */
+int libfsfat_checksum_crc32_table_computed = 0;
+
+/* Initializes the internal CRC-32 table
+ * The table speeds up the CRC-32 calculation
+ */
+void libfsfat_checksum_initialize_crc32_table(
+      uint32_t polynomial )
+{
+	uint32_t checksum    = 0;
+	uint32_t table_index = 0;
+	uint8_t bit_iterator = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		checksum = (uint32_t) table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( checksum & 1 ) != 0 )
+			{
+				checksum = polynomial ^ ( checksum >> 1 );
+			}
+			else
+			{
+				checksum = checksum >> 1;
+			}
+		}
+		libfsfat_checksum_crc32_table[ table_index ] = checksum;
+	}
+	libfsfat_checksum_crc32_table_computed = 1;
+}
+
+/* Calculates the CRC-32 of the data
+ * Uses the reversed polynomial 0xedb88320 (IEEE 802.3)
+ * The initial value allows the CRC-32 to be calculated over multiple buffers,
+ * use 0 for the first buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_checksum_calculate_crc32(
+     uint32_t *checksum,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsfat_checksum_calculate_crc32";
+	size_t data_offset     = 0;
+	uint32_t safe_checksum = 0;
+	uint32_t table_index   = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_checksum_crc32_table_computed == 0 )
+	{
+		libfsfat_checksum_initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	safe_checksum = initial_value ^ (uint32_t) 0xffffffffUL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		table_index = ( safe_checksum ^ data[ data_offset ] ) & 0x000000ffUL;
+
+		safe_checksum = libfsfat_checksum_crc32_table[ table_index ] ^ ( safe_checksum >> 8 );
+	}
+	*checksum = safe_checksum ^ 0xffffffffUL;
+
+	return( 1 );
+}
+
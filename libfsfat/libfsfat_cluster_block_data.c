@@ -24,17 +24,138 @@
 #include <types.h>
 
 #include "libfsfat_cluster_block_data.h"
+#include "libfsfat_io_handle.h"
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcerror.h"
 #include "libfsfat_libfdata.h"
+#include "libfsfat_statistics.h"
 #include "libfsfat_unused.h"
 
+/* Creates cluster block data
+ * Make sure the value cluster_block_data is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_cluster_block_data_initialize(
+     libfsfat_cluster_block_data_t **cluster_block_data,
+     libfsfat_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_cluster_block_data_initialize";
+
+	if( cluster_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cluster block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cluster_block_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cluster block data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*cluster_block_data = memory_allocate_structure(
+	                       libfsfat_cluster_block_data_t );
+
+	if( *cluster_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cluster block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cluster_block_data,
+	     0,
+	     sizeof( libfsfat_cluster_block_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cluster block data.",
+		 function );
+
+		goto on_error;
+	}
+	( *cluster_block_data )->io_handle = io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *cluster_block_data != NULL )
+	{
+		memory_free(
+		 *cluster_block_data );
+
+		*cluster_block_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees cluster block data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_cluster_block_data_free(
+     libfsfat_cluster_block_data_t **cluster_block_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_cluster_block_data_free";
+
+	if( cluster_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cluster block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cluster_block_data != NULL )
+	{
+		memory_free(
+		 *cluster_block_data );
+
+		*cluster_block_data = NULL;
+	}
+	return( 1 );
+}
+
 /* Reads data from the current offset into a buffer
  * Callback for the cluster block data stream
+ * The data is read at the offset tracked by the cluster block data, so that
+ * data streams that share the file IO handle can be read concurrently
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfsfat_cluster_block_data_read_segment_data(
-         intptr_t *data_handle LIBFSFAT_ATTRIBUTE_UNUSED,
+         libfsfat_cluster_block_data_t *cluster_block_data,
          libbfio_handle_t *file_io_handle,
          int segment_index LIBFSFAT_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSFAT_ATTRIBUTE_UNUSED,
@@ -47,12 +168,22 @@ ssize_t libfsfat_cluster_block_data_read_segment_data(
 	static char *function = "libfsfat_cluster_block_data_read_segment_data";
 	ssize_t read_count    = 0;
 
-	LIBFSFAT_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSFAT_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSFAT_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBFSFAT_UNREFERENCED_PARAMETER( segment_flags )
 	LIBFSFAT_UNREFERENCED_PARAMETER( read_flags )
 
+	if( cluster_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cluster block data.",
+		 function );
+
+		return( -1 );
+	}
 	if( segment_data == NULL )
 	{
 		libcerror_error_set(
@@ -75,10 +206,11 @@ ssize_t libfsfat_cluster_block_data_read_segment_data(
 
 		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
+	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              segment_data,
 	              segment_data_size,
+	              cluster_block_data->current_offset,
 	              error );
 
 	if( read_count < 0 )
@@ -87,21 +219,35 @@ ssize_t libfsfat_cluster_block_data_read_segment_data(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment data.",
-		 function );
+		 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 cluster_block_data->current_offset,
+		 cluster_block_data->current_offset );
 
 		return( -1 );
 	}
+	LIBFSFAT_STATISTICS_ADD(
+	 cluster_block_data->io_handle->statistics.number_of_read_calls,
+	 1 );
+
+	LIBFSFAT_STATISTICS_ADD(
+	 cluster_block_data->io_handle->statistics.number_of_bytes_read,
+	 read_count );
+
+	cluster_block_data->current_offset += (off64_t) read_count;
+
 	return( read_count );
 }
 
 /* Seeks a certain offset of the data
  * Callback for the cluster block data stream
+ * Only the offset tracked by the cluster block data is changed, the file IO handle
+ * is positioned when the data is read
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libfsfat_cluster_block_data_seek_segment_offset(
-         intptr_t *data_handle LIBFSFAT_ATTRIBUTE_UNUSED,
-         libbfio_handle_t *file_io_handle,
+         libfsfat_cluster_block_data_t *cluster_block_data,
+         libbfio_handle_t *file_io_handle LIBFSFAT_ATTRIBUTE_UNUSED,
          int segment_index LIBFSFAT_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSFAT_ATTRIBUTE_UNUSED,
          off64_t segment_offset,
@@ -109,38 +255,34 @@ off64_t libfsfat_cluster_block_data_seek_segment_offset(
 {
 	static char *function = "libfsfat_cluster_block_data_seek_segment_offset";
 
-	LIBFSFAT_UNREFERENCED_PARAMETER( data_handle )
+	LIBFSFAT_UNREFERENCED_PARAMETER( file_io_handle )
 	LIBFSFAT_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSFAT_UNREFERENCED_PARAMETER( segment_file_index )
 
-	if( segment_offset < 0 )
+	if( cluster_block_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cluster block data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     segment_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( segment_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek segment offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 segment_offset,
-		 segment_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
+	cluster_block_data->current_offset = segment_offset;
+
 	return( segment_offset );
 }
 
@@ -34,8 +34,30 @@
 extern "C" {
 #endif
 
+typedef struct libfsfat_cluster_block_data libfsfat_cluster_block_data_t;
+
+struct libfsfat_cluster_block_data
+{
+	/* The IO handle
+	 */
+	libfsfat_io_handle_t *io_handle;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+};
+
+int libfsfat_cluster_block_data_initialize(
+     libfsfat_cluster_block_data_t **cluster_block_data,
+     libfsfat_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libfsfat_cluster_block_data_free(
+     libfsfat_cluster_block_data_t **cluster_block_data,
+     libcerror_error_t **error );
+
 ssize_t libfsfat_cluster_block_data_read_segment_data(
-         intptr_t *data_handle,
+         libfsfat_cluster_block_data_t *cluster_block_data,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -46,7 +68,7 @@ ssize_t libfsfat_cluster_block_data_read_segment_data(
          libcerror_error_t **error );
 
 off64_t libfsfat_cluster_block_data_seek_segment_offset(
-         intptr_t *data_handle,
+         libfsfat_cluster_block_data_t *cluster_block_data,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -29,6 +29,7 @@
 #include "libfsfat_libcdata.h"
 #include "libfsfat_libcerror.h"
 #include "libfsfat_libuna.h"
+#include "libfsfat_name.h"
 
 /* Creates a directory
  * Make sure the value directory is referencing, is set to NULL
@@ -281,6 +282,96 @@ int libfsfat_directory_get_file_entry_by_index(
 	return( 1 );
 }
 
+/* Determines the names and case folded names of the file entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_directory_determine_names(
+     libfsfat_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsfat_directory_determine_names";
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory->file_entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     directory->file_entries_array,
+		     entry_index,
+		     (intptr_t **) &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( directory_entry->case_folded_name == NULL )
+		{
+			if( libfsfat_directory_entry_get_case_folded_name(
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine case folded name of file entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the file directory entry for an UTF-8 encoded name
  * Returns 1 if successful, 0 if not found or -1 on error
  */
@@ -292,7 +383,9 @@ int libfsfat_directory_get_file_entry_by_utf8_name(
      libcerror_error_t **error )
 {
 	libfsfat_directory_entry_t *safe_directory_entry = NULL;
+	uint8_t *case_folded_string                      = NULL;
 	static char *function                            = "libfsfat_directory_get_file_entry_by_utf8_name";
+	size_t case_folded_string_length                 = 0;
 	int entry_index                                  = 0;
 	int number_of_entries                            = 0;
 	int result                                       = 0;
@@ -308,6 +401,39 @@ int libfsfat_directory_get_file_entry_by_utf8_name(
 
 		return( -1 );
 	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     directory->file_entries_array,
 	     &number_of_entries,
@@ -322,6 +448,40 @@ int libfsfat_directory_get_file_entry_by_utf8_name(
 
 		return( -1 );
 	}
+	/* Case fold the UTF-8 string once so that every directory entry
+	 * comparison is a byte compare
+	 */
+	case_folded_string = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * ( ( utf8_string_length * 2 ) + 1 ) );
+
+	if( case_folded_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create case folded string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_name_copy_case_folded_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     case_folded_string,
+	     ( utf8_string_length * 2 ) + 1,
+	     &case_folded_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to case folded string.",
+		 function );
+
+		goto on_error;
+	}
 	for( entry_index = 0;
 	     entry_index < number_of_entries;
 	     entry_index++ )
@@ -340,12 +500,12 @@ int libfsfat_directory_get_file_entry_by_utf8_name(
 			 function,
 			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libfsfat_directory_entry_compare_with_utf8_string(
+		result = libfsfat_directory_entry_compare_with_case_folded_utf8_string(
 		          safe_directory_entry,
-		          utf8_string,
-		          utf8_string_length,
+		          case_folded_string,
+		          case_folded_string_length,
 		          error );
 
 		if( result == -1 )
@@ -358,18 +518,33 @@ int libfsfat_directory_get_file_entry_by_utf8_name(
 			 function,
 			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result == LIBUNA_COMPARE_EQUAL )
 		{
-			*directory_entry = safe_directory_entry;
-
-			return( 1 );
+			break;
 		}
 	}
-	*directory_entry = NULL;
+	memory_free(
+	 case_folded_string );
 
-	return( 0 );
+	if( entry_index >= number_of_entries )
+	{
+		*directory_entry = NULL;
+
+		return( 0 );
+	}
+	*directory_entry = safe_directory_entry;
+
+	return( 1 );
+
+on_error:
+	if( case_folded_string != NULL )
+	{
+		memory_free(
+		 case_folded_string );
+	}
+	return( -1 );
 }
 
 /* Retrieves the file directory entry for an UTF-16 encoded name
@@ -77,6 +77,10 @@ int libfsfat_directory_get_file_entry_by_index(
      libfsfat_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsfat_directory_determine_names(
+     libfsfat_directory_t *directory,
+     libcerror_error_t **error );
+
 int libfsfat_directory_get_file_entry_by_utf8_name(
      libfsfat_directory_t *directory,
      const uint8_t *utf8_string,
@@ -162,6 +162,11 @@ int libfsfat_directory_entry_free(
 				result = -1;
 			}
 		}
+		if( ( *directory_entry )->case_folded_name != NULL )
+		{
+			memory_free(
+			 ( *directory_entry )->case_folded_name );
+		}
 		if( ( *directory_entry )->name != NULL )
 		{
 			memory_free(
@@ -259,8 +264,10 @@ int libfsfat_directory_entry_clone(
 
 		goto on_error;
 	}
-	( *destination_directory_entry )->name               = NULL;
-	( *destination_directory_entry )->name_entries_array = NULL;
+	( *destination_directory_entry )->name                    = NULL;
+	( *destination_directory_entry )->case_folded_name        = NULL;
+	( *destination_directory_entry )->case_folded_name_length = 0;
+	( *destination_directory_entry )->name_entries_array      = NULL;
 
 	if( source_directory_entry->name != NULL )
 	{
@@ -322,12 +329,51 @@ int libfsfat_directory_entry_read_data(
      libcerror_error_t **error )
 {
 	static char *function = "libfsfat_directory_entry_read_data";
+	int result            = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit  = 0;
-	uint32_t value_32bit  = 0;
+	if( file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		result = libfsfat_directory_entry_read_exfat_data(
+		          directory_entry,
+		          data,
+		          data_size,
+		          error );
+	}
+	else
+	{
+		result = libfsfat_directory_entry_read_fat_data(
+		          directory_entry,
+		          data,
+		          data_size,
+		          file_system_format,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a FAT-12, FAT-16 or FAT-32 directory entry
+ * Returns 1 if successful, 0 if empty or -1 on error
+ */
+int libfsfat_directory_entry_read_fat_data(
+     libfsfat_directory_entry_t *directory_entry,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_system_format,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_directory_entry_read_fat_data";
 	uint16_t value_16bit  = 0;
-#endif
 
 	if( directory_entry == NULL )
 	{
@@ -374,47 +420,10 @@ int libfsfat_directory_entry_read_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	if( file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
-	{
-		switch( data[ 0 ] )
-		{
-			case 0:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_TERMINATOR;
-				break;
-
-			case 0x81:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_ALLOCATION_BITMAP;
-				break;
-
-			case 0x82:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_UPCASE_TABLE;
-				break;
-
-			case 0x83:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_VOLUME_LABEL;
-				break;
-
-			case 0x85:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY;
-				break;
-
-			case 0xc0:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_DATA_STREAM;
-				break;
-
-			case 0xc1:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY_NAME;
-				break;
-
-			default:
-				directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_UNKNOWN;
-				break;
-		}
-	}
-	else if( memory_compare(
-	          data,
-	          libfsfat_directory_entry_empty,
-	          sizeof( fsfat_directory_entry_t ) ) == 0 )
+	if( memory_compare(
+	     data,
+	     libfsfat_directory_entry_empty,
+	     sizeof( fsfat_directory_entry_t ) ) == 0 )
 	{
 		directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_TERMINATOR;
 	}
@@ -502,6 +511,14 @@ int libfsfat_directory_entry_read_data(
 		 ( (fsfat_directory_entry_t *) data )->data_start_cluster,
 		 directory_entry->data_start_cluster );
 
+		if( file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (fsfat_directory_entry_t *) data )->data_start_cluster_upper,
+			 value_16bit );
+
+			directory_entry->data_start_cluster |= (uint32_t) value_16bit << 16;
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (fsfat_directory_entry_t *) data )->data_size,
 		 directory_entry->data_size );
@@ -581,10 +598,10 @@ int libfsfat_directory_entry_read_data(
 				return( -1 );
 			}
 			byte_stream_copy_to_uint16_little_endian(
-			 ( (fsfat_directory_entry_t *) data )->unknown3,
+			 ( (fsfat_directory_entry_t *) data )->data_start_cluster_upper,
 			 value_16bit );
 			libcnotify_printf(
-			 "%s: unknown3\t\t\t\t: 0x%04" PRIx16 "\n",
+			 "%s: data start cluster upper\t\t: 0x%04" PRIx16 "\n",
 			 function,
 			 value_16bit );
 
@@ -726,6 +743,109 @@ int libfsfat_directory_entry_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
+	return( 1 );
+}
+
+/* Reads an exFAT directory entry
+ * Returns 1 if successful, 0 if empty or -1 on error
+ */
+int libfsfat_directory_entry_read_exfat_data(
+     libfsfat_directory_entry_t *directory_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_directory_entry_read_exfat_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	uint16_t value_16bit  = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != sizeof( fsfat_directory_entry_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: directory entry data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( fsfat_directory_entry_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	switch( data[ 0 ] )
+	{
+		case 0:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_TERMINATOR;
+			break;
+
+		case 0x81:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_ALLOCATION_BITMAP;
+			break;
+
+		case 0x82:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_UPCASE_TABLE;
+			break;
+
+		case 0x83:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_VOLUME_LABEL;
+			break;
+
+		case 0x85:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY;
+			break;
+
+		case 0xc0:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_DATA_STREAM;
+			break;
+
+		case 0xc1:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY_NAME;
+			break;
+
+		default:
+			directory_entry->entry_type = LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_UNKNOWN;
+			break;
+	}
+	if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_TERMINATOR )
+	{
+		return( 0 );
+	}
 	else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_ALLOCATION_BITMAP )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -2090,9 +2210,9 @@ int libfsfat_directory_entry_compare_with_utf8_string(
 
 		return( -1 );
 	}
-	if( directory_entry->name == NULL )
+	if( directory_entry->case_folded_name == NULL )
 	{
-		if( libfsfat_directory_entry_get_name(
+		if( libfsfat_directory_entry_get_case_folded_name(
 		     directory_entry,
 		     error ) != 1 )
 		{
@@ -2100,21 +2220,18 @@ int libfsfat_directory_entry_compare_with_utf8_string(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine name.",
+			 "%s: unable to determine case folded name.",
 			 function );
 
 			return( -1 );
 		}
 	}
 /* TODO add compare of both long and short name */
-/* TODO add codepage support */
-	result = libfsfat_name_compare_with_utf8_string(
-	          directory_entry->name,
-	          directory_entry->name_size,
-	          directory_entry->is_unicode,
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          directory_entry->case_folded_name,
+	          directory_entry->case_folded_name_length,
 	          utf8_string,
 	          utf8_string_length,
-	          1,
 	          error );
 
 	if( result == -1 )
@@ -2131,6 +2248,206 @@ int libfsfat_directory_entry_compare_with_utf8_string(
 	return( result );
 }
 
+/* Determines the case folded name
+ * The names of the entries of a directory are folded when the directory is read,
+ * see libfsfat_directory_determine_names
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_directory_entry_get_case_folded_name(
+     libfsfat_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_directory_entry_get_case_folded_name";
+	size_t name_size      = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->case_folded_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry - case folded name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->name == NULL )
+	{
+		if( libfsfat_directory_entry_get_name(
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Every byte of the name is stored as at most 3 UTF-8 encoded bytes
+	 * and an empty name still requires an allocation
+	 */
+	name_size = ( directory_entry->name_size * 3 ) + 1;
+
+	directory_entry->case_folded_name = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * name_size );
+
+	if( directory_entry->case_folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create case folded name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_name_copy_case_folded_utf8_string_from_name(
+	     directory_entry->name,
+	     directory_entry->name_size,
+	     directory_entry->is_unicode,
+	     directory_entry->case_folded_name,
+	     name_size,
+	     &( directory_entry->case_folded_name_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to case folded name.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry->case_folded_name != NULL )
+	{
+		memory_free(
+		 directory_entry->case_folded_name );
+
+		directory_entry->case_folded_name = NULL;
+	}
+	directory_entry->case_folded_name_length = 0;
+
+	return( -1 );
+}
+
+/* Compares a case folded UTF-8 string with the case folded name of the directory entry
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsfat_directory_entry_compare_with_case_folded_utf8_string(
+     libfsfat_directory_entry_t *directory_entry,
+     const uint8_t *case_folded_string,
+     size_t case_folded_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_directory_entry_compare_with_case_folded_utf8_string";
+	size_t compare_length = 0;
+	int result            = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded string.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid case folded string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->case_folded_name == NULL )
+	{
+		if( libfsfat_directory_entry_get_case_folded_name(
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine case folded name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* UTF-8 encoded strings sort in the same order as their Unicode characters
+	 * hence a byte compare of the common part is sufficient
+	 */
+	compare_length = directory_entry->case_folded_name_length;
+
+	if( case_folded_string_length < compare_length )
+	{
+		compare_length = case_folded_string_length;
+	}
+	if( compare_length > 0 )
+	{
+		result = memory_compare(
+		          case_folded_string,
+		          directory_entry->case_folded_name,
+		          compare_length );
+
+		if( result < 0 )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	if( case_folded_string_length > directory_entry->case_folded_name_length )
+	{
+		return( LIBUNA_COMPARE_GREATER );
+	}
+	else if( case_folded_string_length < directory_entry->case_folded_name_length )
+	{
+		return( LIBUNA_COMPARE_LESS );
+	}
+	return( LIBUNA_COMPARE_EQUAL );
+}
+
 /* Retrieves the size of the UTF-16 encoded name
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
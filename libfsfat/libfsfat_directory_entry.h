@@ -57,6 +57,14 @@ struct libfsfat_directory_entry
 	 */
 	size_t name_size;
 
+	/* The case folded UTF-8 encoded name
+	 */
+	uint8_t *case_folded_name;
+
+	/* The case folded name length
+	 */
+	size_t case_folded_name_length;
+
 	/* Value to indicate if the name is in Unicode (UTF-16 little-endian)
 	 */
 	uint8_t is_unicode;
@@ -150,6 +158,19 @@ int libfsfat_directory_entry_read_data(
      uint8_t file_system_format,
      libcerror_error_t **error );
 
+int libfsfat_directory_entry_read_fat_data(
+     libfsfat_directory_entry_t *directory_entry,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_system_format,
+     libcerror_error_t **error );
+
+int libfsfat_directory_entry_read_exfat_data(
+     libfsfat_directory_entry_t *directory_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsfat_directory_entry_read_file_io_handle(
      libfsfat_directory_entry_t *directory_entry,
      libbfio_handle_t *file_io_handle,
@@ -213,6 +234,16 @@ int libfsfat_directory_entry_compare_with_utf8_string(
      size_t utf8_string_length,
      libcerror_error_t **error );
 
+int libfsfat_directory_entry_get_case_folded_name(
+     libfsfat_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libfsfat_directory_entry_compare_with_case_folded_utf8_string(
+     libfsfat_directory_entry_t *directory_entry,
+     const uint8_t *case_folded_string,
+     size_t case_folded_string_length,
+     libcerror_error_t **error );
+
 int libfsfat_directory_entry_get_utf16_name_size(
      libfsfat_directory_entry_t *directory_entry,
      size_t *utf16_string_size,
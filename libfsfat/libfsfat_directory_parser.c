@@ -0,0 +1,991 @@
+/*
+ * The directory parser functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsfat_definitions.h"
+#include "libfsfat_directory.h"
+#include "libfsfat_directory_entry.h"
+#include "libfsfat_directory_parser.h"
+#include "libfsfat_libcdata.h"
+#include "libfsfat_libcerror.h"
+
+#include "fsfat_directory_entry.h"
+
+/* Creates a directory parser
+ * Make sure the value directory_parser is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_directory_parser_initialize(
+     libfsfat_directory_parser_t **directory_parser,
+     uint8_t file_system_format,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_directory_parser_initialize";
+
+	if( directory_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_parser = memory_allocate_structure(
+	                     libfsfat_directory_parser_t );
+
+	if( *directory_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *directory_parser,
+	     0,
+	     sizeof( libfsfat_directory_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory parser.",
+		 function );
+
+		memory_free(
+		 *directory_parser );
+
+		*directory_parser = NULL;
+
+		return( -1 );
+	}
+	( *directory_parser )->file_system_format = file_system_format;
+
+	return( 1 );
+}
+
+/* Frees a directory parser
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_directory_parser_free(
+     libfsfat_directory_parser_t **directory_parser,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_directory_parser_free";
+	int result            = 1;
+
+	if( directory_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_parser != NULL )
+	{
+		/* The current file entry and data stream entry are referenced
+		 * and freed by the directory
+		 */
+		if( ( *directory_parser )->name_entries_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *directory_parser )->name_entries_array ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free VFAT long file name entries array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *directory_parser );
+
+		*directory_parser = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the index of the first slot set in a slots bitmap
+ * The slots bitmap must not be 0
+ * Returns the slot index
+ */
+int libfsfat_directory_parser_get_first_slot_index(
+     uint64_t slots_bitmap )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+	return( (int) __builtin_ctzll( slots_bitmap ) );
+#else
+	int slot_index = 0;
+
+	if( ( slots_bitmap & 0x00000000ffffffffULL ) == 0 )
+	{
+		slots_bitmap >>= 32;
+		slot_index    += 32;
+	}
+	if( ( slots_bitmap & 0x000000000000ffffULL ) == 0 )
+	{
+		slots_bitmap >>= 16;
+		slot_index    += 16;
+	}
+	if( ( slots_bitmap & 0x00000000000000ffULL ) == 0 )
+	{
+		slots_bitmap >>= 8;
+		slot_index    += 8;
+	}
+	if( ( slots_bitmap & 0x000000000000000fULL ) == 0 )
+	{
+		slots_bitmap >>= 4;
+		slot_index    += 4;
+	}
+	if( ( slots_bitmap & 0x0000000000000003ULL ) == 0 )
+	{
+		slots_bitmap >>= 2;
+		slot_index    += 2;
+	}
+	if( ( slots_bitmap & 0x0000000000000001ULL ) == 0 )
+	{
+		slot_index += 1;
+	}
+	return( slot_index );
+#endif
+}
+
+/* Scans the first byte of the directory entry slots in a buffer
+ * The buffer contains up to 64 consecutive 32-byte directory entries
+ * The bit of a slot is set in the slots bitmap if the entry needs to be read,
+ * which is every slot except for unallocated entries. The end-of-directory
+ * entry is read to determine where the directory ends.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_directory_parser_scan_slots(
+     libfsfat_directory_parser_t *directory_parser,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *slots_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsfat_directory_parser_scan_slots";
+	size_t number_of_slots     = 0;
+	size_t slot_index          = 0;
+	uint64_t first_bytes       = 0;
+	uint64_t live_bytes        = 0;
+	uint64_t live_slots_bitmap = 0;
+	uint8_t byte_index         = 0;
+
+	if( directory_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > ( LIBFSFAT_DIRECTORY_PARSER_MAXIMUM_NUMBER_OF_SCAN_SLOTS * sizeof( fsfat_directory_entry_t ) ) )
+	 || ( ( data_size % sizeof( fsfat_directory_entry_t ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( slots_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slots bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_slots = data_size / sizeof( fsfat_directory_entry_t );
+
+	/* The first bytes of 8 slots are packed into a 64-bit value and tested
+	 * in parallel, the result of each test is stored in the upper bit of
+	 * the corresponding byte
+	 */
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index += 8 )
+	{
+		first_bytes = 0;
+
+		for( byte_index = 0;
+		     ( byte_index < 8 ) && ( ( slot_index + byte_index ) < number_of_slots );
+		     byte_index++ )
+		{
+			first_bytes |= (uint64_t) data[ ( slot_index + byte_index ) * sizeof( fsfat_directory_entry_t ) ] << ( byte_index * 8 );
+		}
+		if( directory_parser->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+		{
+			/* An exFAT entry is live if the in-use bit (0x80) is set
+			 * or if it is the end-of-directory entry (0x00)
+			 */
+			live_bytes = ( ( first_bytes & 0x7f7f7f7f7f7f7f7fULL ) + 0x7f7f7f7f7f7f7f7fULL ) | first_bytes;
+			live_bytes = ( first_bytes | ~live_bytes ) & 0x8080808080808080ULL;
+		}
+		else
+		{
+			/* A FAT entry is live if it is not unallocated (0xe5)
+			 */
+			first_bytes ^= 0xe5e5e5e5e5e5e5e5ULL;
+			live_bytes   = ( ( ( first_bytes & 0x7f7f7f7f7f7f7f7fULL ) + 0x7f7f7f7f7f7f7f7fULL ) | first_bytes ) & 0x8080808080808080ULL;
+		}
+		/* Gather the upper bits of the 8 bytes into the lower 8 bits
+		 */
+		live_slots_bitmap |= ( ( ( live_bytes >> 7 ) * 0x0102040810204080ULL ) >> 56 ) << slot_index;
+	}
+	if( number_of_slots < 64 )
+	{
+		live_slots_bitmap &= ( (uint64_t) 1 << number_of_slots ) - 1;
+	}
+	*slots_bitmap = live_slots_bitmap;
+
+	return( 1 );
+}
+
+/* Reads FAT-12, FAT-16 or FAT-32 directory entries from a buffer
+ * The buffer contains one or more consecutive 32-byte directory entries
+ * Returns 1 if successful, 0 if the end of the directory was reached or -1 on error
+ */
+int libfsfat_directory_parser_read_fat_data(
+     libfsfat_directory_parser_t *directory_parser,
+     libfsfat_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsfat_directory_parser_read_fat_data";
+	off64_t entry_offset                        = 0;
+	size_t data_offset                          = 0;
+	size_t scan_data_offset                     = 0;
+	size_t scan_data_size                       = 0;
+	uint64_t slots_bitmap                       = 0;
+	uint8_t vfat_sequence_number                = 0;
+	int entry_index                             = 0;
+	int slot_index                              = 0;
+	int result                                  = 0;
+
+	if( directory_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % sizeof( fsfat_directory_entry_t ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( scan_data_offset < data_size )
+	{
+		scan_data_size = data_size - scan_data_offset;
+
+		if( scan_data_size > ( LIBFSFAT_DIRECTORY_PARSER_MAXIMUM_NUMBER_OF_SCAN_SLOTS * sizeof( fsfat_directory_entry_t ) ) )
+		{
+			scan_data_size = LIBFSFAT_DIRECTORY_PARSER_MAXIMUM_NUMBER_OF_SCAN_SLOTS * sizeof( fsfat_directory_entry_t );
+		}
+		if( libfsfat_directory_parser_scan_slots(
+		     directory_parser,
+		     &( data[ scan_data_offset ] ),
+		     scan_data_size,
+		     &slots_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan directory entry slots.",
+			 function );
+
+			goto on_error;
+		}
+		while( slots_bitmap != 0 )
+		{
+			slot_index = libfsfat_directory_parser_get_first_slot_index(
+			              slots_bitmap );
+
+			/* Clear the lowest bit set
+			 */
+			slots_bitmap &= slots_bitmap - 1;
+
+			data_offset  = scan_data_offset + ( (size_t) slot_index * sizeof( fsfat_directory_entry_t ) );
+			entry_offset = file_offset + (off64_t) data_offset;
+
+			if( libfsfat_directory_entry_initialize(
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry->identifier = (uint64_t) entry_offset;
+
+			result = libfsfat_directory_entry_read_fat_data(
+			          directory_entry,
+			          &( data[ data_offset ] ),
+			          sizeof( fsfat_directory_entry_t ),
+			          directory_parser->file_system_format,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory entry at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 entry_offset,
+				 entry_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libfsfat_directory_entry_free(
+				     &directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry.",
+					 function );
+
+					goto on_error;
+				}
+				/* The entries before the end-of-directory entry, including
+				 * the unallocated entries that were skipped, have been read
+				 */
+				directory_parser->number_of_entries_read += data_offset / sizeof( fsfat_directory_entry_t );
+
+				return( 0 );
+			}
+			if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
+			{
+				if( memory_compare(
+				     directory_entry->name_data,
+				     ".          ",
+				     11 ) == 0 )
+				{
+					if( directory->self_entry != NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+						 "%s: invalid directory - self entry value already set.",
+						 function );
+
+						goto on_error;
+					}
+					directory->self_entry = directory_entry;
+				}
+				else if( memory_compare(
+				          directory_entry->name_data,
+				          "..         ",
+				          11 ) == 0 )
+				{
+					if( directory->parent_entry != NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+						 "%s: invalid directory - parent entry value already set.",
+						 function );
+
+						goto on_error;
+					}
+					directory->parent_entry = directory_entry;
+				}
+				else if( ( directory_entry->file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL ) != 0 )
+				{
+					/* A volume label can have other attribute flags set, such as archive,
+					 * hence the flag is tested instead of the attribute flags compared
+					 */
+					if( directory->volume_label_entry != NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+						 "%s: invalid directory - volume label entry value already set.",
+						 function );
+
+						goto on_error;
+					}
+					directory->volume_label_entry = directory_entry;
+				}
+				else
+				{
+					if( directory_parser->name_entries_array != NULL )
+					{
+						if( libfsfat_directory_entry_get_name_from_vfat_long_file_name_entries(
+						     directory_entry,
+						     directory_parser->name_entries_array,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to determine name from VFAT long file name entries.",
+							 function );
+
+							goto on_error;
+						}
+						if( libcdata_array_free(
+						     &( directory_parser->name_entries_array ),
+						     NULL,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+							 "%s: unable to free VFAT long file name entries array.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					if( libcdata_array_append_entry(
+					     directory->file_entries_array,
+					     &entry_index,
+					     (intptr_t *) directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append directory entry to file entries array.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_VFAT_LONG_NAME )
+			{
+				vfat_sequence_number = directory_entry->vfat_sequence_number & 0x1f;
+
+				if( ( directory_entry->vfat_sequence_number & 0x40 ) != 0 )
+				{
+					if( directory_parser->name_entries_array != NULL )
+					{
+						if( libcdata_array_free(
+						     &( directory_parser->name_entries_array ),
+						     NULL,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+							 "%s: unable to free VFAT long file name entries array.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					if( libcdata_array_initialize(
+					     &( directory_parser->name_entries_array ),
+					     0,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create VFAT long file name entries array.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else if( ( directory_parser->name_entries_array == NULL )
+				      || ( ( vfat_sequence_number + 1 ) != directory_parser->last_vfat_sequence_number ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid VFAT sequence number value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				if( libcdata_array_append_entry(
+				     directory_parser->name_entries_array,
+				     &entry_index,
+				     (intptr_t *) directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append directory entry to VFAT long file name entries array.",
+					 function );
+
+					goto on_error;
+				}
+				directory_parser->last_vfat_sequence_number = vfat_sequence_number;
+			}
+			if( libcdata_array_append_entry(
+			     directory->entries_array,
+			     &entry_index,
+			     (intptr_t *) directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory entry to array.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry = NULL;
+		}
+		scan_data_offset += scan_data_size;
+	}
+	directory_parser->number_of_entries_read += data_size / sizeof( fsfat_directory_entry_t );
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsfat_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads exFAT directory entries from a buffer
+ * The buffer contains one or more consecutive 32-byte directory entries
+ * Returns 1 if successful, 0 if the end of the directory was reached or -1 on error
+ */
+int libfsfat_directory_parser_read_exfat_data(
+     libfsfat_directory_parser_t *directory_parser,
+     libfsfat_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsfat_directory_parser_read_exfat_data";
+	off64_t entry_offset                        = 0;
+	size_t data_offset                          = 0;
+	size_t scan_data_offset                     = 0;
+	size_t scan_data_size                       = 0;
+	uint64_t slots_bitmap                       = 0;
+	int entry_index                             = 0;
+	int slot_index                              = 0;
+	int result                                  = 0;
+
+	if( directory_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % sizeof( fsfat_directory_entry_t ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( scan_data_offset < data_size )
+	{
+		scan_data_size = data_size - scan_data_offset;
+
+		if( scan_data_size > ( LIBFSFAT_DIRECTORY_PARSER_MAXIMUM_NUMBER_OF_SCAN_SLOTS * sizeof( fsfat_directory_entry_t ) ) )
+		{
+			scan_data_size = LIBFSFAT_DIRECTORY_PARSER_MAXIMUM_NUMBER_OF_SCAN_SLOTS * sizeof( fsfat_directory_entry_t );
+		}
+		if( libfsfat_directory_parser_scan_slots(
+		     directory_parser,
+		     &( data[ scan_data_offset ] ),
+		     scan_data_size,
+		     &slots_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan directory entry slots.",
+			 function );
+
+			goto on_error;
+		}
+		while( slots_bitmap != 0 )
+		{
+			slot_index = libfsfat_directory_parser_get_first_slot_index(
+			              slots_bitmap );
+
+			/* Clear the lowest bit set
+			 */
+			slots_bitmap &= slots_bitmap - 1;
+
+			data_offset  = scan_data_offset + ( (size_t) slot_index * sizeof( fsfat_directory_entry_t ) );
+			entry_offset = file_offset + (off64_t) data_offset;
+
+			if( libfsfat_directory_entry_initialize(
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry->identifier = (uint64_t) entry_offset;
+
+			result = libfsfat_directory_entry_read_exfat_data(
+			          directory_entry,
+			          &( data[ data_offset ] ),
+			          sizeof( fsfat_directory_entry_t ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory entry at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 entry_offset,
+				 entry_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libfsfat_directory_entry_free(
+				     &directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry.",
+					 function );
+
+					goto on_error;
+				}
+				/* The entries before the end-of-directory entry, including
+				 * the unallocated entries that were skipped, have been read
+				 */
+				directory_parser->number_of_entries_read += data_offset / sizeof( fsfat_directory_entry_t );
+
+				return( 0 );
+			}
+			switch( directory_entry->entry_type )
+			{
+				case LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_DATA_STREAM:
+					if( directory_parser->data_stream_entry != NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+						 "%s: invalid current file entry - data stream entry value already set.",
+						 function );
+
+						goto on_error;
+					}
+					if( directory_parser->current_file_entry == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing current file entry.",
+						 function );
+
+						goto on_error;
+					}
+					directory_parser->data_stream_entry = directory_entry;
+
+					directory_parser->current_file_entry->data_start_cluster = directory_entry->data_start_cluster;
+					directory_parser->current_file_entry->data_size          = directory_entry->data_size;
+					directory_parser->current_file_entry->valid_data_size    = directory_entry->valid_data_size;
+
+					break;
+
+				case LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY:
+					if( libcdata_array_append_entry(
+					     directory->file_entries_array,
+					     &entry_index,
+					     (intptr_t *) directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append directory entry to file entries array.",
+						 function );
+
+						goto on_error;
+					}
+					if( libcdata_array_initialize(
+					     &( directory_entry->name_entries_array ),
+					     0,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create name entries array.",
+						 function );
+
+						goto on_error;
+					}
+					directory_parser->current_file_entry = directory_entry;
+					directory_parser->data_stream_entry  = NULL;
+
+					break;
+
+				case LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY_NAME:
+					if( directory_parser->current_file_entry == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing current file entry.",
+						 function );
+
+						goto on_error;
+					}
+					if( libcdata_array_append_entry(
+					     directory_parser->current_file_entry->name_entries_array,
+					     &entry_index,
+					     (intptr_t *) directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append directory entry to name entries array.",
+						 function );
+
+						goto on_error;
+					}
+					break;
+
+				case LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_VOLUME_LABEL:
+					if( directory->volume_label_entry != NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+						 "%s: invalid directory - volume label entry value already set.",
+						 function );
+
+						goto on_error;
+					}
+					directory->volume_label_entry = directory_entry;
+
+					break;
+
+				default:
+					break;
+			}
+			if( libcdata_array_append_entry(
+			     directory->entries_array,
+			     &entry_index,
+			     (intptr_t *) directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory entry to array.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry = NULL;
+		}
+		scan_data_offset += scan_data_size;
+	}
+	directory_parser->number_of_entries_read += data_size / sizeof( fsfat_directory_entry_t );
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsfat_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
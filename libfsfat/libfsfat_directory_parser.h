@@ -0,0 +1,110 @@
+/*
+ * The directory parser functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSFAT_DIRECTORY_PARSER_H )
+#define _LIBFSFAT_DIRECTORY_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsfat_directory.h"
+#include "libfsfat_directory_entry.h"
+#include "libfsfat_libcdata.h"
+#include "libfsfat_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of directory entry slots scanned at once
+ */
+#define LIBFSFAT_DIRECTORY_PARSER_MAXIMUM_NUMBER_OF_SCAN_SLOTS	64
+
+typedef struct libfsfat_directory_parser libfsfat_directory_parser_t;
+
+struct libfsfat_directory_parser
+{
+	/* The file system format
+	 */
+	uint8_t file_system_format;
+
+	/* The VFAT long file name entries array
+	 */
+	libcdata_array_t *name_entries_array;
+
+	/* The last VFAT sequence number
+	 */
+	uint8_t last_vfat_sequence_number;
+
+	/* The current exFAT file entry
+	 */
+	libfsfat_directory_entry_t *current_file_entry;
+
+	/* The current exFAT data stream entry
+	 */
+	libfsfat_directory_entry_t *data_stream_entry;
+
+	/* The number of directory entries read
+	 */
+	uint64_t number_of_entries_read;
+};
+
+int libfsfat_directory_parser_initialize(
+     libfsfat_directory_parser_t **directory_parser,
+     uint8_t file_system_format,
+     libcerror_error_t **error );
+
+int libfsfat_directory_parser_free(
+     libfsfat_directory_parser_t **directory_parser,
+     libcerror_error_t **error );
+
+int libfsfat_directory_parser_get_first_slot_index(
+     uint64_t slots_bitmap );
+
+int libfsfat_directory_parser_scan_slots(
+     libfsfat_directory_parser_t *directory_parser,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *slots_bitmap,
+     libcerror_error_t **error );
+
+int libfsfat_directory_parser_read_fat_data(
+     libfsfat_directory_parser_t *directory_parser,
+     libfsfat_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libfsfat_directory_parser_read_exfat_data(
+     libfsfat_directory_parser_t *directory_parser,
+     libfsfat_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSFAT_DIRECTORY_PARSER_H ) */
+
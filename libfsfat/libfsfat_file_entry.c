@@ -35,6 +35,8 @@
 #include "libfsfat_libcerror.h"
 #include "libfsfat_libcthreads.h"
 #include "libfsfat_libfdata.h"
+#include "libfsfat_statistics.h"
+#include "libfsfat_trace.h"
 #include "libfsfat_types.h"
 
 /* Creates a file entry
@@ -466,7 +468,8 @@ int libfsfat_file_entry_get_identifier(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -528,7 +531,8 @@ int libfsfat_file_entry_get_access_time(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -607,7 +611,8 @@ int libfsfat_file_entry_get_creation_time(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -686,7 +691,8 @@ int libfsfat_file_entry_get_modification_time(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -764,7 +770,8 @@ int libfsfat_file_entry_get_file_attribute_flags(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -843,7 +850,8 @@ int libfsfat_file_entry_get_utf8_name_size(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -923,7 +931,8 @@ int libfsfat_file_entry_get_utf8_name(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1003,7 +1012,8 @@ int libfsfat_file_entry_get_utf16_name_size(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1083,7 +1093,8 @@ int libfsfat_file_entry_get_utf16_name(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1173,7 +1184,8 @@ int libfsfat_file_entry_get_number_of_sub_file_entries(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1431,7 +1443,8 @@ int libfsfat_file_entry_get_sub_file_entry_by_index(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1677,7 +1690,8 @@ int libfsfat_file_entry_get_sub_file_entry_by_utf8_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1923,7 +1937,8 @@ int libfsfat_file_entry_get_sub_file_entry_by_utf16_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1971,6 +1986,440 @@ int libfsfat_file_entry_get_sub_file_entry_by_utf16_name(
 	return( result );
 }
 
+/* Retrieves packed records of the sub file entries starting at a specific index
+ * The UTF-8 encoded names, including the end of string character, are stored in the name pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_internal_file_entry_get_sub_file_entries_packed(
+     libfsfat_internal_file_entry_t *internal_file_entry,
+     int first_sub_file_entry_index,
+     libfsfat_packed_file_entry_t *packed_file_entries,
+     int maximum_number_of_packed_file_entries,
+     uint8_t *name_pool,
+     size_t name_pool_size,
+     int *number_of_packed_file_entries,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_entry_t *sub_directory_entry = NULL;
+	libfsfat_packed_file_entry_t *packed_file_entry = NULL;
+	static char *function                           = "libfsfat_internal_file_entry_get_sub_file_entries_packed";
+	size_t name_pool_offset                         = 0;
+	size_t utf8_string_size                         = 0;
+	uint64_t valid_data_size                        = 0;
+	int number_of_sub_file_entries                  = 0;
+	int packed_file_entry_index                     = 0;
+	int sub_file_entry_index                        = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sub_file_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first sub file entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( packed_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid packed file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_packed_file_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of packed file entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_pool_size == 0 )
+	 || ( name_pool_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name pool size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_packed_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of packed file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->directory == NULL )
+	{
+		if( libfsfat_internal_file_entry_get_directory(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine directory.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file_entry->directory != NULL )
+	{
+		if( libfsfat_directory_get_number_of_file_entries(
+		     internal_file_entry->directory,
+		     &number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file entries from directory.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( sub_file_entry_index = first_sub_file_entry_index;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( packed_file_entry_index >= maximum_number_of_packed_file_entries )
+		{
+			break;
+		}
+		if( libfsfat_directory_get_file_entry_by_index(
+		     internal_file_entry->directory,
+		     sub_file_entry_index,
+		     &sub_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_utf8_name_size(
+		     sub_directory_entry,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( utf8_string_size > ( name_pool_size - name_pool_offset ) )
+		{
+			/* The name of the first packed file entry must fit in the name pool
+			 * otherwise the caller cannot make progress
+			 */
+			if( packed_file_entry_index == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid name pool size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		if( libfsfat_directory_entry_get_utf8_name(
+		     sub_directory_entry,
+		     &( name_pool[ name_pool_offset ] ),
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		packed_file_entry = &( packed_file_entries[ packed_file_entry_index ] );
+
+		packed_file_entry->name_offset = (uint32_t) name_pool_offset;
+		packed_file_entry->name_size   = (uint32_t) utf8_string_size;
+
+		name_pool_offset += utf8_string_size;
+
+		if( libfsfat_directory_entry_get_identifier(
+		     sub_directory_entry,
+		     &( packed_file_entry->identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_creation_time(
+		     sub_directory_entry,
+		     &( packed_file_entry->creation_time ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_access_time(
+		     sub_directory_entry,
+		     &( packed_file_entry->access_time ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access time from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_modification_time(
+		     sub_directory_entry,
+		     &( packed_file_entry->modification_time ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_file_attribute_flags(
+		     sub_directory_entry,
+		     &( packed_file_entry->file_attribute_flags ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file attribute flags from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_data_start_cluster(
+		     sub_directory_entry,
+		     &( packed_file_entry->data_start_cluster ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data start cluster from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_data_size(
+		     sub_directory_entry,
+		     &( packed_file_entry->size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		if( libfsfat_directory_entry_get_valid_data_size(
+		     sub_directory_entry,
+		     &valid_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve valid data size from sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		/* The same size as returned by libfsfat_file_entry_get_size
+		 */
+		if( valid_data_size > 0 )
+		{
+			packed_file_entry->size = valid_data_size;
+		}
+		packed_file_entry_index++;
+	}
+	*number_of_packed_file_entries = packed_file_entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves packed records of the sub file entries starting at a specific index
+ * The UTF-8 encoded names, including the end of string character, are stored in the name pool
+ * Fills as many records as fit in the packed file entries and name pool, call again with
+ * the first index increased by the number of packed file entries to continue
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_entry_get_sub_file_entries_packed(
+     libfsfat_file_entry_t *file_entry,
+     int first_sub_file_entry_index,
+     libfsfat_packed_file_entry_t *packed_file_entries,
+     int maximum_number_of_packed_file_entries,
+     uint8_t *name_pool,
+     size_t name_pool_size,
+     int *number_of_packed_file_entries,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsfat_file_entry_get_sub_file_entries_packed";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_file_entry->io_handle->statistics ),
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsfat_internal_file_entry_get_sub_file_entries_packed(
+	     internal_file_entry,
+	     first_sub_file_entry_index,
+	     packed_file_entries,
+	     maximum_number_of_packed_file_entries,
+	     name_pool,
+	     name_pool_size,
+	     number_of_packed_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve packed sub file entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Reads data at the current offset
  * Returns the number of bytes read or -1 on error
  */
@@ -2011,7 +2460,8 @@ ssize_t libfsfat_file_entry_read_buffer(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2025,6 +2475,12 @@ ssize_t libfsfat_file_entry_read_buffer(
 		return( -1 );
 	}
 #endif
+	LIBFSFAT_TRACE_PROBE3(
+	 file_entry__read__start,
+	 internal_file_entry->identifier,
+	 -1,
+	 buffer_size );
+
 	if( internal_file_entry->cluster_block_stream == NULL )
 	{
 		if( libfsfat_file_system_get_data_stream(
@@ -2068,6 +2524,12 @@ ssize_t libfsfat_file_entry_read_buffer(
 			read_count = -1;
 		}
 	}
+	LIBFSFAT_TRACE_PROBE3(
+	 file_entry__read__done,
+	 ( read_count == -1 ) ? -1 : 1,
+	 internal_file_entry->identifier,
+	 read_count );
+
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
@@ -2127,7 +2589,8 @@ ssize_t libfsfat_file_entry_read_buffer_at_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2141,6 +2604,12 @@ ssize_t libfsfat_file_entry_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
+	LIBFSFAT_TRACE_PROBE3(
+	 file_entry__read__start,
+	 internal_file_entry->identifier,
+	 offset,
+	 buffer_size );
+
 	if( internal_file_entry->cluster_block_stream == NULL )
 	{
 		if( libfsfat_file_system_get_data_stream(
@@ -2185,6 +2654,12 @@ ssize_t libfsfat_file_entry_read_buffer_at_offset(
 			read_count = -1;
 		}
 	}
+	LIBFSFAT_TRACE_PROBE3(
+	 file_entry__read__done,
+	 ( read_count == -1 ) ? -1 : 1,
+	 internal_file_entry->identifier,
+	 read_count );
+
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
@@ -2242,7 +2717,8 @@ off64_t libfsfat_file_entry_seek_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2354,7 +2830,8 @@ int libfsfat_file_entry_get_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2460,7 +2937,8 @@ int libfsfat_file_entry_get_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2520,7 +2998,8 @@ int libfsfat_file_entry_get_number_of_extents(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2620,7 +3099,8 @@ int libfsfat_file_entry_get_extent_by_index(
 	internal_file_entry = (libfsfat_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_file_entry->io_handle->statistics ),
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
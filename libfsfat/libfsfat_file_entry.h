@@ -216,6 +216,27 @@ int libfsfat_file_entry_get_sub_file_entry_by_utf16_name(
      libfsfat_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int libfsfat_internal_file_entry_get_sub_file_entries_packed(
+     libfsfat_internal_file_entry_t *internal_file_entry,
+     int first_sub_file_entry_index,
+     libfsfat_packed_file_entry_t *packed_file_entries,
+     int maximum_number_of_packed_file_entries,
+     uint8_t *name_pool,
+     size_t name_pool_size,
+     int *number_of_packed_file_entries,
+     libcerror_error_t **error );
+
+LIBFSFAT_EXTERN \
+int libfsfat_file_entry_get_sub_file_entries_packed(
+     libfsfat_file_entry_t *file_entry,
+     int first_sub_file_entry_index,
+     libfsfat_packed_file_entry_t *packed_file_entries,
+     int maximum_number_of_packed_file_entries,
+     uint8_t *name_pool,
+     size_t name_pool_size,
+     int *number_of_packed_file_entries,
+     libcerror_error_t **error );
+
 LIBFSFAT_EXTERN \
 ssize_t libfsfat_file_entry_read_buffer(
          libfsfat_file_entry_t *file_entry,
@@ -31,9 +31,12 @@
 #include "libfsfat_definitions.h"
 #include "libfsfat_directory.h"
 #include "libfsfat_directory_entry.h"
+#include "libfsfat_directory_parser.h"
 #include "libfsfat_extent.h"
 #include "libfsfat_file_entry.h"
 #include "libfsfat_file_system.h"
+#include "libfsfat_hash.h"
+#include "libfsfat_index.h"
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcdata.h"
 #include "libfsfat_libcerror.h"
@@ -42,6 +45,10 @@
 #include "libfsfat_libfcache.h"
 #include "libfsfat_libfdata.h"
 #include "libfsfat_libuna.h"
+#include "libfsfat_name.h"
+#include "libfsfat_path_hint.h"
+#include "libfsfat_statistics.h"
+#include "libfsfat_trace.h"
 #include "libfsfat_types.h"
 
 #include "fsfat_directory_entry.h"
@@ -150,6 +157,20 @@ int libfsfat_file_system_initialize(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize(
+	     &( ( *file_system )->path_hint_cache ),
+	     LIBFSFAT_MAXIMUM_CACHE_ENTRIES_PATH_HINTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path hint cache.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( ( *file_system )->read_write_lock ),
@@ -165,6 +186,17 @@ int libfsfat_file_system_initialize(
 		goto on_error;
 	}
 #endif
+	/* Select the directory entries parser once, since the file system format
+	 * does not change for the lifetime of the file system
+	 */
+	if( io_handle->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		( *file_system )->read_directory_data = &libfsfat_directory_parser_read_exfat_data;
+	}
+	else
+	{
+		( *file_system )->read_directory_data = &libfsfat_directory_parser_read_fat_data;
+	}
 	( *file_system )->io_handle = io_handle;
 
 	return( 1 );
@@ -172,6 +204,12 @@ int libfsfat_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->path_hint_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *file_system )->path_hint_cache ),
+			 NULL );
+		}
 		if( ( *file_system )->directory_cache != NULL )
 		{
 			libfcache_cache_free(
@@ -285,7 +323,36 @@ int libfsfat_file_system_free(
 
 			result = -1;
 		}
-		/* The io_handle reference is freed elsewhere
+		if( libfcache_cache_free(
+		     &( ( *file_system )->path_hint_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path hint cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *file_system )->index != NULL )
+		{
+			if( libfsfat_index_free(
+			     &( ( *file_system )->index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The io_handle and export_index references are freed elsewhere
 		 */
 		memory_free(
 		 *file_system );
@@ -384,6 +451,121 @@ on_error:
 	return( -1 );
 }
 
+/* Reads directory data at a specific offset
+ * The data is read from the metadata index if available, otherwise from the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_system_read_buffer_at_offset(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_file_system_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->index != NULL )
+	{
+		result = libfsfat_index_read_buffer_at_offset(
+		          file_system->index,
+		          file_offset,
+		          buffer,
+		          buffer_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_read_calls,
+		 1 );
+
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_bytes_read,
+		 buffer_size );
+	}
+	if( file_system->export_index != NULL )
+	{
+		if( libfsfat_index_append_block(
+		     file_system->export_index,
+		     file_offset,
+		     buffer,
+		     buffer_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data at offset: %" PRIi64 " (0x%08" PRIx64 ") to export index.",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads an allocation table
  * Returns 1 if successful or -1 on error
  */
@@ -429,6 +611,11 @@ int libfsfat_file_system_read_allocation_table(
 
 		return( -1 );
 	}
+	LIBFSFAT_TRACE_PROBE2(
+	 allocation_table__read__start,
+	 file_offset,
+	 size );
+
 	if( libfsfat_allocation_table_initialize(
 	     &( file_system->allocation_table ),
 	     file_system->io_handle->total_number_of_clusters,
@@ -480,9 +667,19 @@ int libfsfat_file_system_read_allocation_table(
 
 		goto on_error;
 	}
+	LIBFSFAT_TRACE_PROBE2(
+	 allocation_table__read__done,
+	 1,
+	 file_system->io_handle->total_number_of_clusters );
+
 	return( 1 );
 
 on_error:
+	LIBFSFAT_TRACE_PROBE2(
+	 allocation_table__read__done,
+	 -1,
+	 file_system->io_handle->total_number_of_clusters );
+
 	if( file_system->reversed_allocation_table != NULL )
 	{
 		libfsfat_allocation_table_free(
@@ -498,6 +695,91 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a directory entry
+ * Returns 1 if successful, 0 if empty or -1 on error
+ */
+int libfsfat_file_system_read_directory_entry(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libfsfat_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	uint8_t directory_entry_data[ sizeof( fsfat_directory_entry_t ) ];
+
+	static char *function = "libfsfat_file_system_read_directory_entry";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_file_system_read_buffer_at_offset(
+	     file_system,
+	     file_io_handle,
+	     directory_entry_data,
+	     sizeof( fsfat_directory_entry_t ),
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	result = libfsfat_directory_entry_read_data(
+	          directory_entry,
+	          directory_entry_data,
+	          sizeof( fsfat_directory_entry_t ),
+	          file_system->io_handle->file_system_format,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_directory_entries_read,
+		 1 );
+	}
+	return( result );
+}
+
 /* Reads a directory
  * Returns 1 if successful or -1 on error
  */
@@ -508,20 +790,15 @@ int libfsfat_file_system_read_directory(
      libfsfat_directory_t **directory,
      libcerror_error_t **error )
 {
-	libcdata_array_t *name_entries_array           = NULL;
-	libfsfat_block_tree_t *cluster_block_tree      = NULL;
-	libfsfat_directory_t *safe_directory           = NULL;
-	libfsfat_directory_entry_t *current_file_entry = NULL;
-	libfsfat_directory_entry_t *data_stream_entry  = NULL;
-	libfsfat_directory_entry_t *directory_entry    = NULL;
-	static char *function                          = "libfsfat_file_system_read_directory";
-	off64_t cluster_end_offset                     = 0;
-	off64_t cluster_offset                         = 0;
-	uint32_t last_cluster_number                   = 0;
-	uint8_t last_vfat_sequence_number              = 0;
-	uint8_t vfat_sequence_number                   = 0;
-	int entry_index                                = 0;
-	int result                                     = 0;
+	libfsfat_block_tree_t *cluster_block_tree     = NULL;
+	libfsfat_directory_t *safe_directory          = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	uint8_t *cluster_data                         = NULL;
+	static char *function                         = "libfsfat_file_system_read_directory";
+	off64_t cluster_offset                        = 0;
+	uint32_t first_cluster_number                 = 0;
+	uint32_t last_cluster_number                  = 0;
+	int result                                    = 0;
 
 	if( file_system == NULL )
 	{
@@ -545,6 +822,57 @@ int libfsfat_file_system_read_directory(
 
 		return( -1 );
 	}
+	if( ( file_system->io_handle->cluster_block_size == 0 )
+	 || ( file_system->io_handle->cluster_block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file system - invalid IO handle - cluster block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->read_directory_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing read directory data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	first_cluster_number = cluster_number;
+
+	LIBFSFAT_TRACE_PROBE1(
+	 directory__read__start,
+	 cluster_number );
+
 	switch( file_system->io_handle->file_system_format )
 	{
 		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
@@ -573,28 +901,6 @@ int libfsfat_file_system_read_directory(
 
 			goto on_error;
 	}
-	if( directory == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
-		 function );
-
-		return( -1 );
-	}
-	if( *directory != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid directory value already set.",
-		 function );
-
-		return( -1 );
-	}
 	if( libfsfat_block_tree_initialize(
 	     &cluster_block_tree,
 	     file_system->io_handle->volume_size,
@@ -623,431 +929,1241 @@ int libfsfat_file_system_read_directory(
 
 		goto on_error;
 	}
-	while( ( cluster_number >= 2 )
-	    && ( cluster_number < last_cluster_number ) )
+	if( libfsfat_directory_parser_initialize(
+	     &directory_parser,
+	     file_system->io_handle->file_system_format,
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: reading cluster number: %" PRIu32 "\n",
-			 function,
-			 cluster_number );
-		}
-#endif
-		cluster_offset     = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
-		cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory parser.",
+		 function );
+
+		goto on_error;
+	}
+	cluster_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * file_system->io_handle->cluster_block_size );
+
+	if( cluster_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cluster data.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( cluster_number >= 2 )
+	    && ( cluster_number < last_cluster_number ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading cluster number: %" PRIu32 "\n",
+			 function,
+			 cluster_number );
+		}
+#endif
+		cluster_offset = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
+
+		LIBFSFAT_TRACE_PROBE3(
+		 directory__read__cluster,
+		 cluster_number,
+		 cluster_offset,
+		 file_system->io_handle->cluster_block_size );
+
+		if( libfsfat_file_system_check_if_cluster_block_first_read(
+		     file_system,
+		     cluster_block_tree,
+		     cluster_number,
+		     cluster_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check if first read of cluster number: %" PRIu32 ".",
+			 function,
+			 cluster_number );
+
+			goto on_error;
+		}
+		if( libfsfat_file_system_read_buffer_at_offset(
+		     file_system,
+		     file_io_handle,
+		     cluster_data,
+		     file_system->io_handle->cluster_block_size,
+		     cluster_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read cluster: %" PRIu32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 cluster_number,
+			 cluster_offset,
+			 cluster_offset );
+
+			goto on_error;
+		}
+		result = file_system->read_directory_data(
+		          directory_parser,
+		          safe_directory,
+		          cluster_data,
+		          file_system->io_handle->cluster_block_size,
+		          cluster_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entries from cluster: %" PRIu32 ".",
+			 function,
+			 cluster_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsfat_allocation_table_get_cluster_number_by_index(
+		     file_system->allocation_table,
+		     (int) cluster_number,
+		     &cluster_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cluster number: %" PRIu32 ".",
+			 function,
+			 cluster_number );
+
+			goto on_error;
+		}
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_allocation_table_lookups,
+		 1 );
+	}
+	LIBFSFAT_STATISTICS_ADD(
+	 file_system->io_handle->statistics.number_of_directory_entries_read,
+	 directory_parser->number_of_entries_read );
+
+	memory_free(
+	 cluster_data );
+
+	cluster_data = NULL;
+
+	if( libfsfat_directory_parser_free(
+	     &directory_parser,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory parser.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_block_tree_free(
+	     &cluster_block_tree,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cluster block tree.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the names now so that the directory entries are not modified
+	 * when the directory is shared between file entries
+	 */
+	if( libfsfat_directory_determine_names(
+	     safe_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine names of directory entries.",
+		 function );
+
+		goto on_error;
+	}
+	LIBFSFAT_STATISTICS_ADD(
+	 file_system->io_handle->statistics.number_of_directories_read,
+	 1 );
+
+	LIBFSFAT_TRACE_PROBE3(
+	 directory__read__done,
+	 1,
+	 first_cluster_number,
+	 0 );
+
+	*directory = safe_directory;
+
+	return( 1 );
+
+on_error:
+	LIBFSFAT_TRACE_PROBE3(
+	 directory__read__done,
+	 -1,
+	 first_cluster_number,
+	 0 );
+
+	if( cluster_data != NULL )
+	{
+		memory_free(
+		 cluster_data );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( safe_directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &safe_directory,
+		 NULL );
+	}
+	if( cluster_block_tree != NULL )
+	{
+		libfsfat_block_tree_free(
+		 &cluster_block_tree,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_system_read_directory_by_range(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     libfsfat_directory_t **directory,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	libfsfat_directory_t *safe_directory          = NULL;
+	uint8_t *directory_data                       = NULL;
+	static char *function                         = "libfsfat_file_system_read_directory_by_range";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->read_directory_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing read directory data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	LIBFSFAT_TRACE_PROBE2(
+	 directory__read__range,
+	 file_offset,
+	 size );
+
+	if( libfsfat_directory_initialize(
+	     &safe_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_directory_parser_initialize(
+	     &directory_parser,
+	     file_system->io_handle->file_system_format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory parser.",
+		 function );
+
+		goto on_error;
+	}
+	directory_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * (size_t) size );
+
+	if( directory_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_file_system_read_buffer_at_offset(
+	     file_system,
+	     file_io_handle,
+	     directory_data,
+	     (size_t) size,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( file_system->read_directory_data(
+	     directory_parser,
+	     safe_directory,
+	     directory_data,
+	     (size_t) size,
+	     file_offset,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries.",
+		 function );
+
+		goto on_error;
+	}
+	LIBFSFAT_STATISTICS_ADD(
+	 file_system->io_handle->statistics.number_of_directory_entries_read,
+	 directory_parser->number_of_entries_read );
+
+	memory_free(
+	 directory_data );
+
+	directory_data = NULL;
+
+	if( libfsfat_directory_parser_free(
+	     &directory_parser,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory parser.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the names now so that the directory entries are not modified
+	 * when the directory is shared between file entries
+	 */
+	if( libfsfat_directory_determine_names(
+	     safe_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine names of directory entries.",
+		 function );
+
+		goto on_error;
+	}
+	LIBFSFAT_STATISTICS_ADD(
+	 file_system->io_handle->statistics.number_of_directories_read,
+	 1 );
+
+	LIBFSFAT_TRACE_PROBE3(
+	 directory__read__done,
+	 1,
+	 0,
+	 file_offset );
+
+	*directory = safe_directory;
+
+	return( 1 );
+
+on_error:
+	LIBFSFAT_TRACE_PROBE3(
+	 directory__read__done,
+	 -1,
+	 0,
+	 file_offset );
+
+	if( directory_data != NULL )
+	{
+		memory_free(
+		 directory_data );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( safe_directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &safe_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a directory entry for a specific identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsfat_file_system_read_directory_entry_by_identifier(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     uint64_t identifier,
+     libfsfat_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *name_entries_array             = NULL;
+	libfsfat_directory_entry_t *current_file_entry   = NULL;
+	libfsfat_directory_entry_t *data_stream_entry    = NULL;
+	libfsfat_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsfat_file_system_read_directory_entry_by_identifier";
+	off64_t cluster_end_offset                       = 0;
+	off64_t cluster_offset                           = 0;
+	uint32_t cluster_number                          = 0;
+	uint8_t last_vfat_sequence_number                = 0;
+	uint8_t vfat_sequence_number                     = 0;
+	int entry_index                                  = 0;
+	int result                                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
 
-		if( libfsfat_file_system_check_if_cluster_block_first_read(
-		     file_system,
-		     cluster_block_tree,
-		     cluster_number,
-		     cluster_offset,
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_directory_entry_initialize(
+	     &current_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsfat_file_system_read_directory_entry(
+	          file_system,
+	          file_io_handle,
+	          (off64_t) identifier,
+	          current_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfsfat_directory_entry_free(
+		     &current_file_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to check if first read of cluster number: %" PRIu32 ".",
-			 function,
-			 cluster_number );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
 
 			goto on_error;
 		}
-		while( cluster_offset < cluster_end_offset )
+		return( 0 );
+	}
+	if( ( current_file_entry->entry_type != LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
+	 && ( current_file_entry->entry_type != LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported directory entry type.",
+		 function );
+
+		goto on_error;
+	}
+	current_file_entry->identifier = identifier;
+
+	cluster_number     = ( identifier / file_system->io_handle->cluster_block_size );
+	cluster_offset     = (off64_t) cluster_number * file_system->io_handle->cluster_block_size;
+	cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
+	cluster_number    += 2;
+
+	if( libcdata_array_initialize(
+	     &name_entries_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name entries array.",
+		 function );
+
+		goto on_error;
+	}
+	if( current_file_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
+	{
+		cluster_offset = identifier - sizeof( fsfat_directory_entry_t );
+
+		while( cluster_number > 2 )
 		{
-			if( libfsfat_directory_entry_initialize(
-			     &directory_entry,
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading cluster number: %" PRIu32 "\n",
+				 function,
+				 cluster_number );
+			}
+#endif
+			while( cluster_offset <= cluster_end_offset )
+			{
+				if( libfsfat_directory_entry_initialize(
+				     &safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create directory entry.",
+					 function );
+
+					goto on_error;
+				}
+				result = libfsfat_file_system_read_directory_entry(
+				          file_system,
+				          file_io_handle,
+				          cluster_offset,
+				          safe_directory_entry,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read directory entry.",
+					 function );
+
+					goto on_error;
+				}
+				if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_VFAT_LONG_NAME )
+				{
+					vfat_sequence_number = safe_directory_entry->vfat_sequence_number & 0x1f;
+
+					if( ( safe_directory_entry->vfat_sequence_number & 0x40 ) != 0 )
+					{
+						result = 0;
+					}
+					if( ( last_vfat_sequence_number != 0 )
+					 && ( ( last_vfat_sequence_number + 1 ) != vfat_sequence_number ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid VFAT sequence number value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
+					if( libcdata_array_prepend_entry(
+					     name_entries_array,
+					     (intptr_t *) safe_directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to prepend directory entry to VFAT long file name entries array.",
+						 function );
+
+						goto on_error;
+					}
+					safe_directory_entry = NULL;
+
+					last_vfat_sequence_number = vfat_sequence_number;
+				}
+				else
+				{
+					if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
+					{
+						result = 0;
+					}
+					if( libfsfat_directory_entry_free(
+					     &safe_directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free directory entry.",
+						 function );
+
+						goto on_error;
+					}
+					break;
+				}
+				cluster_offset -= sizeof( fsfat_directory_entry_t );
+			}
+			if( result == 0 )
+			{
+				break;
+			}
+			if( libfsfat_allocation_table_get_cluster_number_by_index(
+			     file_system->reversed_allocation_table,
+			     (int) cluster_number,
+			     &cluster_number,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory entry.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cluster number: %" PRIu32 ".",
+				 function,
+				 cluster_number );
 
 				goto on_error;
 			}
-			result = libfsfat_directory_entry_read_file_io_handle(
-			          directory_entry,
-			          file_io_handle,
-			          cluster_offset,
-			          file_system->io_handle->file_system_format,
-			          error );
+			LIBFSFAT_STATISTICS_ADD(
+			 file_system->io_handle->statistics.number_of_allocation_table_lookups,
+			 1 );
 
-			if( result == -1 )
+			cluster_offset     = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
+			cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
+		}
+		if( last_vfat_sequence_number != 0 )
+		{
+			if( libfsfat_directory_entry_get_name_from_vfat_long_file_name_entries(
+			     current_file_entry,
+			     name_entries_array,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory entry.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine name from VFAT long file name entries.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result == 0 )
-			{
-				if( libfsfat_directory_entry_free(
-				     &directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
-					 function );
+		}
+	}
+	else if( current_file_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY )
+	{
+		cluster_offset = identifier + sizeof( fsfat_directory_entry_t );
 
-					goto on_error;
-				}
-				break;
+		do
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading cluster number: %" PRIu32 "\n",
+				 function,
+				 cluster_number );
 			}
-			if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_UNALLOCATED )
+#endif
+			while( cluster_offset < cluster_end_offset )
 			{
-				if( libfsfat_directory_entry_free(
-				     &directory_entry,
+				if( libfsfat_directory_entry_initialize(
+				     &safe_directory_entry,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create directory entry.",
 					 function );
 
 					goto on_error;
 				}
-				cluster_offset += sizeof( fsfat_directory_entry_t );
-
-				continue;
-			}
-			if( ( directory_entry->name_data[ 0 ] == '.' )
-			 && ( directory_entry->name_data[ 1 ] == ' ' )
-			 && ( directory_entry->name_data[ 2 ] == ' ' )
-			 && ( directory_entry->name_data[ 3 ] == ' ' )
-			 && ( directory_entry->name_data[ 4 ] == ' ' )
-			 && ( directory_entry->name_data[ 5 ] == ' ' )
-			 && ( directory_entry->name_data[ 6 ] == ' ' )
-			 && ( directory_entry->name_data[ 7 ] == ' ' )
-			 && ( directory_entry->name_data[ 8 ] == ' ' )
-			 && ( directory_entry->name_data[ 9 ] == ' ' )
-			 && ( directory_entry->name_data[ 10 ] == ' ' ) )
-			{
-				if( safe_directory->self_entry != NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-					 "%s: invalid directory - self entry value already set.",
-					 function );
+				result = libfsfat_file_system_read_directory_entry(
+				          file_system,
+				          file_io_handle,
+				          cluster_offset,
+				          safe_directory_entry,
+				          error );
 
-					goto on_error;
-				}
-				safe_directory->self_entry = directory_entry;
-			}
-			else if( ( directory_entry->name_data[ 0 ] == '.' )
-			      && ( directory_entry->name_data[ 1 ] == '.' )
-			      && ( directory_entry->name_data[ 2 ] == ' ' )
-			      && ( directory_entry->name_data[ 3 ] == ' ' )
-			      && ( directory_entry->name_data[ 4 ] == ' ' )
-			      && ( directory_entry->name_data[ 5 ] == ' ' )
-			      && ( directory_entry->name_data[ 6 ] == ' ' )
-			      && ( directory_entry->name_data[ 7 ] == ' ' )
-			      && ( directory_entry->name_data[ 8 ] == ' ' )
-			      && ( directory_entry->name_data[ 9 ] == ' ' )
-			      && ( directory_entry->name_data[ 10 ] == ' ' ) )
-			{
-				if( safe_directory->parent_entry != NULL )
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-					 "%s: invalid directory - parent entry value already set.",
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read directory entry.",
 					 function );
 
 					goto on_error;
 				}
-				safe_directory->parent_entry = directory_entry;
-			}
-			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
-			{
-				if( ( directory_entry->file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL ) != 0 )
+				if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_DATA_STREAM )
 				{
-					if( safe_directory->volume_label_entry != NULL )
+					if( data_stream_entry != NULL )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-						 "%s: invalid directory - volume label entry value already set.",
+						 "%s: invalid current file entry - data stream entry value already set.",
 						 function );
 
 						goto on_error;
 					}
-					safe_directory->volume_label_entry = directory_entry;
+					data_stream_entry = safe_directory_entry;
+
+					current_file_entry->data_start_cluster = safe_directory_entry->data_start_cluster;
+					current_file_entry->data_size          = safe_directory_entry->data_size;
+					current_file_entry->valid_data_size    = safe_directory_entry->valid_data_size;
 				}
-				else
+				else if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY_NAME )
 				{
-					directory_entry->identifier = (uint64_t) cluster_offset;
-
-					if( name_entries_array != NULL )
-					{
-						if( libfsfat_directory_entry_get_name_from_vfat_long_file_name_entries(
-						     directory_entry,
-						     name_entries_array,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to determine name from VFAT long file name entries.",
-							 function );
-
-							goto on_error;
-						}
-						if( libcdata_array_free(
-						     &name_entries_array,
-						     NULL,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-							 "%s: unable to free VFAT long file name entries array.",
-							 function );
-
-							goto on_error;
-						}
-					}
 					if( libcdata_array_append_entry(
-					     safe_directory->file_entries_array,
+					     name_entries_array,
 					     &entry_index,
-					     (intptr_t *) directory_entry,
+					     (intptr_t *) safe_directory_entry,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append directory entry to file entries array.",
+						 "%s: unable to append directory entry to name entries array.",
 						 function );
 
 						goto on_error;
 					}
+					safe_directory_entry = NULL;
 				}
-			}
-			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_VFAT_LONG_NAME )
-			{
-				vfat_sequence_number = directory_entry->vfat_sequence_number & 0x1f;
-
-				if( ( directory_entry->vfat_sequence_number & 0x40 ) != 0 )
+				else
 				{
-					if( name_entries_array != NULL )
+					if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY )
 					{
-						if( libcdata_array_free(
-						     &name_entries_array,
-						     NULL,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-							 "%s: unable to free VFAT long file name entries array.",
-							 function );
-
-							goto on_error;
-						}
+						result = 0;
 					}
-					if( libcdata_array_initialize(
-					     &name_entries_array,
-					     0,
+					if( libfsfat_directory_entry_free(
+					     &safe_directory_entry,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to create VFAT long file name entries array.",
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free directory entry.",
 						 function );
 
 						goto on_error;
 					}
+					break;
 				}
-				else
-				{
-					if( ( vfat_sequence_number + 1 ) != last_vfat_sequence_number )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid VFAT sequence number value out of bounds.",
-						 function );
+				cluster_offset += sizeof( fsfat_directory_entry_t );
+			}
+			if( result == 0 )
+			{
+				break;
+			}
+			if( libfsfat_allocation_table_get_cluster_number_by_index(
+			     file_system->allocation_table,
+			     (int) cluster_number,
+			     &cluster_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cluster number: %" PRIu32 ".",
+				 function,
+				 cluster_number );
+
+				goto on_error;
+			}
+			LIBFSFAT_STATISTICS_ADD(
+			 file_system->io_handle->statistics.number_of_allocation_table_lookups,
+			 1 );
+
+			cluster_offset     = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
+			cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
+		}
+		while( ( cluster_number >= 2 )
+		    && ( cluster_number < 0xfffffff0UL ) );
+
+		if( libfsfat_directory_entry_get_name_from_exfat_file_name_entries(
+		     current_file_entry,
+		     name_entries_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine name from exFAT file name entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &name_entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free name entries array.",
+		 function );
+
+		goto on_error;
+	}
+	*directory_entry = current_file_entry;
+
+	return( 1 );
+
+on_error:
+	if( name_entries_array != NULL )
+	{
+		libcdata_array_free(
+		 &name_entries_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_directory_entry_free,
+		 NULL );
+	}
+	if( safe_directory_entry != NULL )
+	{
+		libfsfat_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( current_file_entry != NULL )
+	{
+		libfsfat_directory_entry_free(
+		 &current_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the root directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_system_read_root_directory(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     uint32_t cluster_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_file_system_read_root_directory";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->root_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - root directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->root_directory_offset  = file_offset;
+	file_system->root_directory_size    = size;
+	file_system->root_directory_cluster = cluster_number;
+
+	if( size > 0 )
+	{
+		if( libfsfat_file_system_read_directory_by_range(
+		     file_system,
+		     file_io_handle,
+		     file_offset,
+		     size,
+		     &( file_system->root_directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read root directory by range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libfsfat_file_system_read_directory(
+		     file_system,
+		     file_io_handle,
+		     cluster_number,
+		     &( file_system->root_directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read root directory by cluster number.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the metadata index used to read directory data
+ * The index is only accepted if its boot record and allocation table checksums
+ * match those calculated when the volume was opened
+ * The file system takes over management of the index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_system_set_index(
+     libfsfat_file_system_t *file_system,
+     libfsfat_index_t *index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_file_system_set_index";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
 
-						goto on_error;
-					}
-				}
-				if( libcdata_array_append_entry(
-				     name_entries_array,
-				     &entry_index,
-				     (intptr_t *) directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory entry to VFAT long file name entries array.",
-					 function );
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
 
-					goto on_error;
-				}
-				last_vfat_sequence_number = vfat_sequence_number;
-			}
-			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_DATA_STREAM )
-			{
-				if( data_stream_entry != NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-					 "%s: invalid current file entry - data stream entry value already set.",
-					 function );
+		return( -1 );
+	}
+	if( file_system->allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing allocation table.",
+		 function );
 
-					goto on_error;
-				}
-				data_stream_entry = directory_entry;
+		return( -1 );
+	}
+	if( file_system->index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - index value already set.",
+		 function );
 
-				if( current_file_entry == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current file entry.",
-					 function );
+		return( -1 );
+	}
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
 
-					goto on_error;
-				}
-				current_file_entry->data_start_cluster = directory_entry->data_start_cluster;
-				current_file_entry->data_size          = directory_entry->data_size;
-				current_file_entry->valid_data_size    = directory_entry->valid_data_size;
-			}
-			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY )
-			{
-				directory_entry->identifier = (uint64_t) cluster_offset;
+		return( -1 );
+	}
+	if( index->boot_record_checksum != file_system->io_handle->boot_record_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch between index and volume boot record checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 index->boot_record_checksum,
+		 file_system->io_handle->boot_record_checksum );
 
-				if( libcdata_array_append_entry(
-				     safe_directory->file_entries_array,
-				     &entry_index,
-				     (intptr_t *) directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory entry to file entries array.",
-					 function );
+		return( -1 );
+	}
+	if( index->allocation_table_checksum != file_system->allocation_table->checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch between index and volume allocation table checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 index->allocation_table_checksum,
+		 file_system->allocation_table->checksum );
 
-					goto on_error;
-				}
-				if( libcdata_array_initialize(
-				     &( directory_entry->name_entries_array ),
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create name entries array.",
-					 function );
+		return( -1 );
+	}
+	file_system->index = index;
 
-					goto on_error;
-				}
-				current_file_entry = directory_entry;
-				data_stream_entry  = NULL;
-			}
-			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY_NAME )
-			{
-				if( current_file_entry == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current file entry.",
-					 function );
+	return( 1 );
+}
 
-					goto on_error;
-				}
-				if( libcdata_array_append_entry(
-				     current_file_entry->name_entries_array,
-				     &entry_index,
-				     (intptr_t *) directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory entry to name entries array.",
-					 function );
+/* Exports the directory data of the sub directories of a directory into a metadata index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_internal_file_system_export_sub_directories(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libfsfat_directory_t *directory,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_t *sub_directory         = NULL;
+	libfsfat_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsfat_internal_file_system_export_sub_directories";
+	uint32_t cluster_number                     = 0;
+	uint16_t file_attribute_flags               = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
 
-					goto on_error;
-				}
-			}
-			else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_VOLUME_LABEL )
-			{
-				if( safe_directory->volume_label_entry != NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-					 "%s: invalid directory - volume label entry value already set.",
-					 function );
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSFAT_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
 
-					goto on_error;
-				}
-				safe_directory->volume_label_entry = directory_entry;
-			}
-			if( libcdata_array_append_entry(
-			     safe_directory->entries_array,
-			     &entry_index,
-			     (intptr_t *) directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append directory entry to array.",
-				 function );
+		return( -1 );
+	}
+	if( libfsfat_directory_get_number_of_file_entries(
+	     directory,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
 
-				goto on_error;
-			}
-			directory_entry = NULL;
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfsfat_directory_get_file_entry_by_index(
+		     directory,
+		     entry_index,
+		     &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsfat_directory_entry_get_file_attribute_flags(
+		     directory_entry,
+		     &file_attribute_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file attribute flags of file entry: %d.",
+			 function,
+			 entry_index );
 
-			cluster_offset += sizeof( fsfat_directory_entry_t );
+			goto on_error;
 		}
-		if( result == 0 )
+		if( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
 		{
-			break;
+			continue;
 		}
-		if( libfsfat_allocation_table_get_cluster_number_by_index(
-		     file_system->allocation_table,
-		     (int) cluster_number,
+		if( libfsfat_directory_entry_get_data_start_cluster(
+		     directory_entry,
 		     &cluster_number,
 		     error ) != 1 )
 		{
@@ -1055,98 +2171,89 @@ int libfsfat_file_system_read_directory(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cluster number: %" PRIu32 ".",
+			 "%s: unable to retrieve data start cluster of file entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( cluster_number < 2 )
+		{
+			continue;
+		}
+		if( libfsfat_file_system_read_directory(
+		     file_system,
+		     file_io_handle,
+		     cluster_number,
+		     &sub_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory: %" PRIu32 ".",
 			 function,
 			 cluster_number );
 
 			goto on_error;
 		}
-	}
-	if( name_entries_array != NULL )
-	{
-		if( libcdata_array_free(
-		     &name_entries_array,
-		     NULL,
+		if( libfsfat_internal_file_system_export_sub_directories(
+		     file_system,
+		     file_io_handle,
+		     sub_directory,
+		     recursion_depth + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free name entries array.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export sub directories of directory: %" PRIu32 ".",
+			 function,
+			 cluster_number );
+
+			goto on_error;
+		}
+		if( libfsfat_directory_free(
+		     &sub_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory: %" PRIu32 ".",
+			 function,
+			 cluster_number );
 
 			goto on_error;
 		}
 	}
-	if( libfsfat_block_tree_free(
-	     &cluster_block_tree,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free cluster block tree.",
-		 function );
-
-		goto on_error;
-	}
-	*directory = safe_directory;
-
-	return( 1 );
-
-on_error:
-	if( name_entries_array != NULL )
-	{
-		libcdata_array_free(
-		 &name_entries_array,
-		 NULL,
-		 NULL );
-	}
-	if( directory_entry != NULL )
-	{
-		libfsfat_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-	if( safe_directory != NULL )
+	return( 1 );
+
+on_error:
+	if( sub_directory != NULL )
 	{
 		libfsfat_directory_free(
-		 &safe_directory,
-		 NULL );
-	}
-	if( cluster_block_tree != NULL )
-	{
-		libfsfat_block_tree_free(
-		 &cluster_block_tree,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
+		 &sub_directory,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads a directory
+/* Exports the directory data of the file system into a metadata index
+ * Every directory is read from the volume, the index does not take over management of the directories
  * Returns 1 if successful or -1 on error
  */
-int libfsfat_file_system_read_directory_by_range(
+int libfsfat_file_system_export_index(
      libfsfat_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     size64_t size,
-     libfsfat_directory_t **directory,
+     libfsfat_index_t *index,
      libcerror_error_t **error )
 {
-	libcdata_array_t *name_entries_array        = NULL;
-	libfsfat_directory_t *safe_directory        = NULL;
-	libfsfat_directory_entry_t *directory_entry = NULL;
-	static char *function                       = "libfsfat_file_system_read_directory_by_range";
-	off64_t file_end_offset                     = 0;
-	int entry_index                             = 0;
-	int result                                  = 0;
-	uint8_t last_vfat_sequence_number           = 0;
-	uint8_t vfat_sequence_number                = 0;
+	libfsfat_directory_t *root_directory = NULL;
+	static char *function                = "libfsfat_file_system_export_index";
 
 	if( file_system == NULL )
 	{
@@ -1159,348 +2266,177 @@ int libfsfat_file_system_read_directory_by_range(
 
 		return( -1 );
 	}
-	if( file_system->io_handle == NULL )
+	if( file_system->export_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - export index value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory == NULL )
+	if( index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
+		 "%s: invalid index.",
 		 function );
 
 		return( -1 );
 	}
-	if( *directory != NULL )
+	if( file_system->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid directory value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsfat_directory_initialize(
-	     &safe_directory,
-	     error ) != 1 )
+	if( file_system->allocation_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing allocation table.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	file_end_offset = file_offset + size;
+	index->boot_record_checksum      = file_system->io_handle->boot_record_checksum;
+	index->allocation_table_checksum = file_system->allocation_table->checksum;
+
+	file_system->export_index = index;
 
-	while( file_offset < file_end_offset )
+	if( file_system->root_directory_size > 0 )
 	{
-		if( libfsfat_directory_entry_initialize(
-		     &directory_entry,
+		if( libfsfat_file_system_read_directory_by_range(
+		     file_system,
+		     file_io_handle,
+		     file_system->root_directory_offset,
+		     file_system->root_directory_size,
+		     &root_directory,
 		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
-
-			goto on_error;
-		}
-		directory_entry->identifier = (uint64_t) file_offset;
-
-		result = libfsfat_directory_entry_read_file_io_handle(
-		          directory_entry,
-		          file_io_handle,
-		          file_offset,
-		          file_system->io_handle->file_system_format,
-		          error );
-
-		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entry.",
+			 "%s: unable to read root directory by range.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result == 0 )
-		{
-			if( libfsfat_directory_entry_free(
-			     &directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entry.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-		}
-		if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_UNALLOCATED )
-		{
-			if( libfsfat_directory_entry_free(
-			     &directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entry.",
-				 function );
-
-				goto on_error;
-			}
-			file_offset += sizeof( fsfat_directory_entry_t );
-
-			continue;
-		}
-		if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
-		{
-			if( directory_entry->file_attribute_flags == LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL )
-			{
-				if( safe_directory->volume_label_entry != NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-					 "%s: invalid directory - volume label entry value already set.",
-					 function );
-
-					goto on_error;
-				}
-				safe_directory->volume_label_entry = directory_entry;
-			}
-			else
-			{
-				directory_entry->identifier = (uint64_t) file_offset;
-
-				if( name_entries_array != NULL )
-				{
-					if( libfsfat_directory_entry_get_name_from_vfat_long_file_name_entries(
-					     directory_entry,
-					     name_entries_array,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to determine name from VFAT long file name entries.",
-						 function );
-
-						goto on_error;
-					}
-					if( libcdata_array_free(
-					     &name_entries_array,
-					     NULL,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free VFAT long file name entries array.",
-						 function );
-
-						goto on_error;
-					}
-				}
-				if( libcdata_array_append_entry(
-				     safe_directory->file_entries_array,
-				     &entry_index,
-				     (intptr_t *) directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory entry to file entries array.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
-		else if( directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_VFAT_LONG_NAME )
-		{
-			vfat_sequence_number = directory_entry->vfat_sequence_number & 0x1f;
-
-			if( ( directory_entry->vfat_sequence_number & 0x40 ) != 0 )
-			{
-				if( name_entries_array != NULL )
-				{
-					if( libcdata_array_free(
-					     &name_entries_array,
-					     NULL,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free VFAT long file name entries array.",
-						 function );
-
-						goto on_error;
-					}
-				}
-				if( libcdata_array_initialize(
-				     &name_entries_array,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create VFAT long file name entries array.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			else
-			{
-				if( ( vfat_sequence_number + 1 ) != last_vfat_sequence_number )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid VFAT sequence number value out of bounds.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			if( libcdata_array_append_entry(
-			     name_entries_array,
-			     &entry_index,
-			     (intptr_t *) directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append directory entry to VFAT long file name entries array.",
-				 function );
-
-				goto on_error;
-			}
-			last_vfat_sequence_number = vfat_sequence_number;
-		}
-		if( libcdata_array_append_entry(
-		     safe_directory->entries_array,
-		     &entry_index,
-		     (intptr_t *) directory_entry,
+	}
+	else
+	{
+		if( libfsfat_file_system_read_directory(
+		     file_system,
+		     file_io_handle,
+		     file_system->root_directory_cluster,
+		     &root_directory,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append directory entry to array.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read root directory by cluster number.",
 			 function );
 
 			goto on_error;
 		}
-		directory_entry = NULL;
+	}
+	if( libfsfat_internal_file_system_export_sub_directories(
+	     file_system,
+	     file_io_handle,
+	     root_directory,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export sub directories of root directory.",
+		 function );
 
-		file_offset += sizeof( fsfat_directory_entry_t );
+		goto on_error;
 	}
-	if( name_entries_array != NULL )
+	/* The blocks are recorded in the order the directories were read
+	 */
+	if( libfsfat_index_sort_blocks(
+	     index,
+	     error ) != 1 )
 	{
-		if( libcdata_array_free(
-		     &name_entries_array,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free name entries array.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort index blocks.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	*directory = safe_directory;
+	if( libfsfat_directory_free(
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->export_index = NULL;
 
 	return( 1 );
 
 on_error:
-	if( name_entries_array != NULL )
-	{
-		libcdata_array_free(
-		 &name_entries_array,
-		 NULL,
-		 NULL );
-	}
-	if( directory_entry != NULL )
-	{
-		libfsfat_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-	if( safe_directory != NULL )
+	if( root_directory != NULL )
 	{
 		libfsfat_directory_free(
-		 &safe_directory,
+		 &root_directory,
 		 NULL );
 	}
+	file_system->export_index = NULL;
+
 	return( -1 );
 }
 
-/* Reads a directory entry for a specific identifier
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves a data stream
+ * Returns 1 if successful or -1 on error
  */
-int libfsfat_file_system_read_directory_entry_by_identifier(
+int libfsfat_file_system_get_data_stream(
      libfsfat_file_system_t *file_system,
-     libbfio_handle_t *file_io_handle,
-     uint64_t identifier,
-     libfsfat_directory_entry_t **directory_entry,
+     uint32_t cluster_number,
+     size64_t size,
+     libcdata_array_t *data_extents_array,
+     libfdata_stream_t **data_stream,
      libcerror_error_t **error )
 {
-	libcdata_array_t *name_entries_array             = NULL;
-	libfsfat_directory_entry_t *current_file_entry   = NULL;
-	libfsfat_directory_entry_t *data_stream_entry    = NULL;
-	libfsfat_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfsfat_file_system_read_directory_entry_by_identifier";
-	off64_t cluster_end_offset                       = 0;
-	off64_t cluster_offset                           = 0;
-	uint32_t cluster_number                          = 0;
-	uint8_t last_vfat_sequence_number                = 0;
-	uint8_t vfat_sequence_number                     = 0;
-	int entry_index                                  = 0;
-	int result                                       = 0;
+	libfdata_stream_t *safe_data_stream               = NULL;
+	libfsfat_block_tree_t *cluster_block_tree         = NULL;
+	libfsfat_cluster_block_data_t *cluster_block_data = NULL;
+	libfsfat_extent_t *extent                         = NULL;
+	static char *function                             = "libfsfat_file_system_get_data_stream";
+	size64_t segment_size                             = 0;
+	off64_t cluster_offset                            = 0;
+	off64_t segment_end_offset                        = 0;
+	off64_t segment_start_offset                      = 0;
+	uint32_t last_cluster_number                      = 0;
+	int entry_index                                   = 0;
+	int segment_index                                 = 0;
 
 	if( file_system == NULL )
 	{
@@ -1524,451 +2460,388 @@ int libfsfat_file_system_read_directory_entry_by_identifier(
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	if( ( file_system->io_handle->total_number_of_clusters == 0 )
+	 || ( (size_t) file_system->io_handle->total_number_of_clusters > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - total number of clusters value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsfat_directory_entry_initialize(
-	     &current_file_entry,
-	     error ) != 1 )
+	if( data_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libfsfat_directory_entry_read_file_io_handle(
-	          current_file_entry,
-	          file_io_handle,
-	          (off64_t) identifier,
-	          file_system->io_handle->file_system_format,
-	          error );
-
-	if( result == -1 )
+	if( *data_stream != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data stream value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result == 0 )
+	LIBFSFAT_TRACE_PROBE2(
+	 data_stream__get__start,
+	 cluster_number,
+	 size );
+
+	switch( file_system->io_handle->file_system_format )
 	{
-		if( libfsfat_directory_entry_free(
-		     &current_file_entry,
-		     error ) != 1 )
-		{
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
+			last_cluster_number = 0x00000ff0UL;
+			break;
+
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16:
+			last_cluster_number = 0x0000fff0UL;
+			break;
+
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32:
+			last_cluster_number = 0x0ffffff0UL;
+			break;
+
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT:
+			last_cluster_number = 0xfffffff0UL;
+			break;
+
+		default:
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory entry.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported file system format.",
 			 function );
 
 			goto on_error;
-		}
-		return( 0 );
 	}
-	if( ( current_file_entry->entry_type != LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
-	 && ( current_file_entry->entry_type != LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY ) )
+	if( libfsfat_block_tree_initialize(
+	     &cluster_block_tree,
+	     file_system->io_handle->volume_size,
+	     file_system->io_handle->cluster_block_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported directory entry type.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cluster block tree.",
 		 function );
 
 		goto on_error;
 	}
-	current_file_entry->identifier = identifier;
-
-	cluster_number     = ( identifier / file_system->io_handle->cluster_block_size );
-	cluster_offset     = (off64_t) cluster_number * file_system->io_handle->cluster_block_size;
-	cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
-	cluster_number    += 2;
-
-	if( libcdata_array_initialize(
-	     &name_entries_array,
-	     0,
+	/* Every data stream tracks its own offset so that data streams
+	 * that share the file IO handle can be read concurrently
+	 */
+	if( libfsfat_cluster_block_data_initialize(
+	     &cluster_block_data,
+	     file_system->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create name entries array.",
+		 "%s: unable to create cluster block data.",
 		 function );
 
 		goto on_error;
 	}
-	if( current_file_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
+	if( libfdata_stream_initialize(
+	     &safe_data_stream,
+	     (intptr_t *) cluster_block_data,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_cluster_block_data_free,
+	     NULL,
+	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsfat_cluster_block_data_read_segment_data,
+	     NULL,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsfat_cluster_block_data_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
 	{
-		cluster_offset = identifier - sizeof( fsfat_directory_entry_t );
-
-		while( cluster_number > 2 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading cluster number: %" PRIu32 "\n",
-				 function,
-				 cluster_number );
-			}
-#endif
-			while( cluster_offset <= cluster_end_offset )
-			{
-				if( libfsfat_directory_entry_initialize(
-				     &safe_directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create directory entry.",
-					 function );
-
-					goto on_error;
-				}
-				result = libfsfat_directory_entry_read_file_io_handle(
-				          safe_directory_entry,
-				          file_io_handle,
-				          cluster_offset,
-				          file_system->io_handle->file_system_format,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read directory entry.",
-					 function );
-
-					goto on_error;
-				}
-				if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_VFAT_LONG_NAME )
-				{
-					vfat_sequence_number = safe_directory_entry->vfat_sequence_number & 0x1f;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data stream.",
+		 function );
 
-					if( ( safe_directory_entry->vfat_sequence_number & 0x40 ) != 0 )
-					{
-						result = 0;
-					}
-					if( ( last_vfat_sequence_number != 0 )
-					 && ( ( last_vfat_sequence_number + 1 ) != vfat_sequence_number ) )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid VFAT sequence number value out of bounds.",
-						 function );
+		goto on_error;
+	}
+	/* The cluster block data is managed by the data stream
+	 */
+	cluster_block_data = NULL;
 
-						goto on_error;
-					}
-					if( libcdata_array_prepend_entry(
-					     name_entries_array,
-					     (intptr_t *) safe_directory_entry,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to prepend directory entry to VFAT long file name entries array.",
-						 function );
+	while( ( cluster_number >= 2 )
+	    && ( cluster_number < last_cluster_number ) )
+	{
+		if( size == 0 )
+		{
+			break;
+		}
+		cluster_offset = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
 
-						goto on_error;
-					}
-					safe_directory_entry = NULL;
+		if( libfsfat_file_system_check_if_cluster_block_first_read(
+		     file_system,
+		     cluster_block_tree,
+		     cluster_number,
+		     cluster_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check if first read of cluster number: %" PRIu32 ".",
+			 function,
+			 cluster_number );
 
-					last_vfat_sequence_number = vfat_sequence_number;
-				}
-				else
-				{
-					if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_SHORT_NAME )
-					{
-						result = 0;
-					}
-					if( libfsfat_directory_entry_free(
-					     &safe_directory_entry,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free directory entry.",
-						 function );
+			goto on_error;
+		}
+		if( ( segment_start_offset != 0 )
+		 && ( cluster_offset > segment_end_offset ) )
+		{
+			segment_size = segment_end_offset - segment_start_offset;
 
-						goto on_error;
-					}
-					break;
-				}
-				cluster_offset -= sizeof( fsfat_directory_entry_t );
-			}
-			if( result == 0 )
-			{
-				break;
-			}
-			if( libfsfat_allocation_table_get_cluster_number_by_index(
-			     file_system->reversed_allocation_table,
-			     (int) cluster_number,
-			     &cluster_number,
+			if( libfsfat_extent_initialize(
+			     &extent,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cluster number: %" PRIu32 ".",
-				 function,
-				 cluster_number );
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create extent.",
+				 function );
 
 				goto on_error;
 			}
-			cluster_offset     = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
-			cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
-		}
-		if( last_vfat_sequence_number != 0 )
-		{
-			if( libfsfat_directory_entry_get_name_from_vfat_long_file_name_entries(
-			     current_file_entry,
-			     name_entries_array,
+			extent->offset = segment_start_offset;
+			extent->size   = segment_size;
+
+			if( libcdata_array_append_entry(
+			     data_extents_array,
+			     &entry_index,
+			     (intptr_t *) extent,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine name from VFAT long file name entries.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data extent to array.",
 				 function );
 
 				goto on_error;
 			}
-		}
-	}
-	else if( current_file_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY )
-	{
-		cluster_offset = identifier + sizeof( fsfat_directory_entry_t );
-
-		do
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading cluster number: %" PRIu32 "\n",
-				 function,
-				 cluster_number );
-			}
-#endif
-			while( cluster_offset < cluster_end_offset )
-			{
-				if( libfsfat_directory_entry_initialize(
-				     &safe_directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create directory entry.",
-					 function );
-
-					goto on_error;
-				}
-				result = libfsfat_directory_entry_read_file_io_handle(
-				          safe_directory_entry,
-				          file_io_handle,
-				          cluster_offset,
-				          file_system->io_handle->file_system_format,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read directory entry.",
-					 function );
-
-					goto on_error;
-				}
-				if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_DATA_STREAM )
-				{
-					if( data_stream_entry != NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-						 "%s: invalid current file entry - data stream entry value already set.",
-						 function );
-
-						goto on_error;
-					}
-					data_stream_entry = safe_directory_entry;
-
-					current_file_entry->data_start_cluster = safe_directory_entry->data_start_cluster;
-					current_file_entry->data_size          = safe_directory_entry->data_size;
-					current_file_entry->valid_data_size    = safe_directory_entry->valid_data_size;
-				}
-				else if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY_NAME )
-				{
-					if( libcdata_array_append_entry(
-					     name_entries_array,
-					     &entry_index,
-					     (intptr_t *) safe_directory_entry,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append directory entry to name entries array.",
-						 function );
-
-						goto on_error;
-					}
-					safe_directory_entry = NULL;
-				}
-				else
-				{
-					if( safe_directory_entry->entry_type == LIBFSFAT_DIRECTORY_ENTRY_TYPE_EXFAT_FILE_ENTRY )
-					{
-						result = 0;
-					}
-					if( libfsfat_directory_entry_free(
-					     &safe_directory_entry,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free directory entry.",
-						 function );
+			extent = NULL;
 
-						goto on_error;
-					}
-					break;
-				}
-				cluster_offset += sizeof( fsfat_directory_entry_t );
-			}
-			if( result == 0 )
+			if( segment_size > size )
 			{
-				break;
+				segment_size = size;
 			}
-			if( libfsfat_allocation_table_get_cluster_number_by_index(
-			     file_system->allocation_table,
-			     (int) cluster_number,
-			     &cluster_number,
+			if( libfdata_stream_append_segment(
+			     safe_data_stream,
+			     &segment_index,
+			     0,
+			     segment_start_offset,
+			     segment_size,
+			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cluster number: %" PRIu32 ".",
-				 function,
-				 cluster_number );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append stream segment.",
+				 function );
 
 				goto on_error;
 			}
-			cluster_offset     = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
-			cluster_end_offset = cluster_offset + file_system->io_handle->cluster_block_size;
+			LIBFSFAT_STATISTICS_ADD(
+			 file_system->io_handle->statistics.number_of_extents,
+			 1 );
+
+			size -= segment_size;
+
+			segment_start_offset = 0;
 		}
-		while( ( cluster_number >= 2 )
-		    && ( cluster_number < 0xfffffff0UL ) );
+		if( segment_start_offset == 0 )
+		{
+			segment_start_offset = cluster_offset;
+			segment_end_offset   = cluster_offset;
+		}
+		segment_end_offset += file_system->io_handle->cluster_block_size;
 
-		if( libfsfat_directory_entry_get_name_from_exfat_file_name_entries(
-		     current_file_entry,
-		     name_entries_array,
+		if( libfsfat_allocation_table_get_cluster_number_by_index(
+		     file_system->allocation_table,
+		     (int) cluster_number,
+		     &cluster_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine name from exFAT file name entries.",
+			 "%s: unable to retrieve cluster number: %" PRIu32 ".",
+			 function,
+			 cluster_number );
+
+			goto on_error;
+		}
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_allocation_table_lookups,
+		 1 );
+	}
+	if( ( size > 0 )
+	 && ( segment_start_offset != 0 ) )
+	{
+		segment_size = segment_end_offset - segment_start_offset;
+
+		if( libfsfat_extent_initialize(
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extent.",
+			 function );
+
+			goto on_error;
+		}
+		extent->offset = segment_start_offset;
+		extent->size   = segment_size;
+
+		if( libcdata_array_append_entry(
+		     data_extents_array,
+		     &entry_index,
+		     (intptr_t *) extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data extent to array.",
+			 function );
+
+			goto on_error;
+		}
+		extent = NULL;
+
+		if( segment_size > size )
+		{
+			segment_size = size;
+		}
+		if( libfdata_stream_append_segment(
+		     safe_data_stream,
+		     &segment_index,
+		     0,
+		     segment_start_offset,
+		     segment_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append stream segment.",
 			 function );
 
 			goto on_error;
 		}
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_extents,
+		 1 );
 	}
-	if( libcdata_array_free(
-	     &name_entries_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_directory_entry_free,
+	if( libfsfat_block_tree_free(
+	     &cluster_block_tree,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free name entries array.",
+		 "%s: unable to free cluster block tree.",
 		 function );
 
 		goto on_error;
 	}
-	*directory_entry = current_file_entry;
+	LIBFSFAT_TRACE_PROBE2(
+	 data_stream__get__done,
+	 1,
+	 size );
+
+	*data_stream = safe_data_stream;
 
 	return( 1 );
 
 on_error:
-	if( name_entries_array != NULL )
+	LIBFSFAT_TRACE_PROBE2(
+	 data_stream__get__done,
+	 -1,
+	 size );
+
+	if( extent != NULL )
 	{
-		libcdata_array_free(
-		 &name_entries_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_directory_entry_free,
+		libfsfat_extent_free(
+		 &extent,
 		 NULL );
 	}
-	if( safe_directory_entry != NULL )
+	if( safe_data_stream != NULL )
 	{
-		libfsfat_directory_entry_free(
-		 &safe_directory_entry,
+		libfdata_stream_free(
+		 &safe_data_stream,
 		 NULL );
 	}
-	if( current_file_entry != NULL )
+	if( cluster_block_data != NULL )
 	{
-		libfsfat_directory_entry_free(
-		 &current_file_entry,
+		libfsfat_cluster_block_data_free(
+		 &cluster_block_data,
+		 NULL );
+	}
+	if( cluster_block_tree != NULL )
+	{
+		libfsfat_block_tree_free(
+		 &cluster_block_tree,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads the root directory
+/* Retrieves a directory
  * Returns 1 if successful or -1 on error
  */
-int libfsfat_file_system_read_root_directory(
+int libfsfat_file_system_get_directory(
      libfsfat_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     size64_t size,
      uint32_t cluster_number,
+     libfsfat_directory_t **directory,
      libcerror_error_t **error )
 {
-	static char *function = "libfsfat_file_system_read_root_directory";
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsfat_directory_t *safe_directory = NULL;
+	static char *function                = "libfsfat_file_system_get_directory";
+	int number_of_cache_entries          = 0;
+	int number_of_cache_values           = 0;
+	int result                           = 0;
 
 	if( file_system == NULL )
 	{
@@ -1992,431 +2865,328 @@ int libfsfat_file_system_read_root_directory(
 
 		return( -1 );
 	}
-	if( file_system->root_directory != NULL )
+	result = libfcache_cache_get_value_by_identifier(
+	          file_system->directory_cache,
+	          0,
+	          (off64_t) cluster_number,
+	          file_system->cache_timestamp,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file system - root directory value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
 		 function );
 
-		return( -1 );
-	}
-	if( size > 0 )
-	{
-		if( libfsfat_file_system_read_directory_by_range(
-		     file_system,
-		     file_io_handle,
-		     file_offset,
-		     size,
-		     &( file_system->root_directory ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read root directory by range.",
-			 function );
-
-			return( -1 );
-		}
+		goto on_error;
 	}
-	else
+	else if( result != 0 )
 	{
-		if( libfsfat_file_system_read_directory(
-		     file_system,
-		     file_io_handle,
-		     cluster_number,
-		     &( file_system->root_directory ),
-		     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read root directory by cluster number.",
-			 function );
-
-			return( -1 );
+			libcnotify_printf(
+			 "%s: cache: 0x%08" PRIjx " hit for cluster number: %" PRIu32 "\n",
+			 function,
+			 (intptr_t) file_system->directory_cache,
+			 cluster_number );
 		}
-	}
-	return( 1 );
-}
-
-/* Retrieves a data stream
- * Returns 1 if successful or -1 on error
- */
-int libfsfat_file_system_get_data_stream(
-     libfsfat_file_system_t *file_system,
-     uint32_t cluster_number,
-     size64_t size,
-     libcdata_array_t *data_extents_array,
-     libfdata_stream_t **data_stream,
-     libcerror_error_t **error )
-{
-	libfdata_stream_t *safe_data_stream       = NULL;
-	libfsfat_block_tree_t *cluster_block_tree = NULL;
-	libfsfat_extent_t *extent                 = NULL;
-	static char *function                     = "libfsfat_file_system_get_data_stream";
-	size64_t segment_size                     = 0;
-	off64_t cluster_offset                    = 0;
-	off64_t segment_end_offset                = 0;
-	off64_t segment_start_offset              = 0;
-	uint32_t last_cluster_number              = 0;
-	int entry_index                           = 0;
-	int segment_index                         = 0;
-
-	if( file_system == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system.",
-		 function );
-
-		return( -1 );
-	}
-	if( file_system->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	switch( file_system->io_handle->file_system_format )
-	{
-		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
-			last_cluster_number = 0x00000ff0UL;
-			break;
-
-		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16:
-			last_cluster_number = 0x0000fff0UL;
-			break;
-
-		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32:
-			last_cluster_number = 0x0ffffff0UL;
-			break;
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		case LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT:
-			last_cluster_number = 0xfffffff0UL;
-			break;
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_directory_cache_hits,
+		 1 );
 
-		default:
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) directory,
+		     error ) != 1 )
+		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported file system format.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data from cache.",
 			 function );
 
 			goto on_error;
+		}
 	}
-	if( ( file_system->io_handle->total_number_of_clusters == 0 )
-	 || ( (size_t) file_system->io_handle->total_number_of_clusters > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - total number of clusters value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( data_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data stream.",
-		 function );
-
-		return( -1 );
-	}
-	if( *data_stream != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid data stream value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfsfat_block_tree_initialize(
-	     &cluster_block_tree,
-	     file_system->io_handle->volume_size,
-	     file_system->io_handle->cluster_block_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create cluster block tree.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_stream_initialize(
-	     &safe_data_stream,
-	     NULL,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsfat_cluster_block_data_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsfat_cluster_block_data_seek_segment_offset,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data stream.",
-		 function );
-
-		goto on_error;
-	}
-	while( ( cluster_number >= 2 )
-	    && ( cluster_number < last_cluster_number ) )
+	else
 	{
-		if( size == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			break;
+			libcnotify_printf(
+			 "%s: cache: 0x%08" PRIjx " miss for cluster number: %" PRIu32 "\n",
+			 function,
+			 (intptr_t) file_system->directory_cache,
+			 cluster_number );
 		}
-		cluster_offset = file_system->io_handle->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * file_system->io_handle->cluster_block_size );
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libfsfat_file_system_check_if_cluster_block_first_read(
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_directory_cache_misses,
+		 1 );
+
+		if( libfsfat_file_system_read_directory(
 		     file_system,
-		     cluster_block_tree,
+		     file_io_handle,
 		     cluster_number,
-		     cluster_offset,
+		     &safe_directory,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to check if first read of cluster number: %" PRIu32 ".",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory: %" PRIu32 ".",
 			 function,
 			 cluster_number );
 
 			goto on_error;
 		}
-		if( ( segment_start_offset != 0 )
-		 && ( cluster_offset > segment_end_offset ) )
-		{
-			segment_size = segment_end_offset - segment_start_offset;
-
-			if( libfsfat_extent_initialize(
-			     &extent,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extent.",
-				 function );
-
-				goto on_error;
-			}
-			extent->offset = segment_start_offset;
-			extent->size   = segment_size;
-
-			if( libcdata_array_append_entry(
-			     data_extents_array,
-			     &entry_index,
-			     (intptr_t *) extent,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append data extent to array.",
-				 function );
-
-				goto on_error;
-			}
-			extent = NULL;
-
-			if( segment_size > size )
-			{
-				segment_size = size;
-			}
-			if( libfdata_stream_append_segment(
-			     safe_data_stream,
-			     &segment_index,
-			     0,
-			     segment_start_offset,
-			     segment_size,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append stream segment.",
-				 function );
-
-				goto on_error;
-			}
-			size -= segment_size;
-
-			segment_start_offset = 0;
-		}
-		if( segment_start_offset == 0 )
-		{
-			segment_start_offset = cluster_offset;
-			segment_end_offset   = cluster_offset;
-		}
-		segment_end_offset += file_system->io_handle->cluster_block_size;
-
-		if( libfsfat_allocation_table_get_cluster_number_by_index(
-		     file_system->allocation_table,
-		     (int) cluster_number,
-		     &cluster_number,
+		if( libfcache_cache_get_number_of_entries(
+		     file_system->directory_cache,
+		     &number_of_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cluster number: %" PRIu32 ".",
-			 function,
-			 cluster_number );
+			 "%s: unable to retrieve number of cache entries.",
+			 function );
 
 			goto on_error;
 		}
-	}
-	if( ( size > 0 )
-	 && ( segment_start_offset != 0 ) )
-	{
-		segment_size = segment_end_offset - segment_start_offset;
-
-		if( libfsfat_extent_initialize(
-		     &extent,
+		if( libfcache_cache_get_number_of_cache_values(
+		     file_system->directory_cache,
+		     &number_of_cache_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extent.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache values.",
 			 function );
 
 			goto on_error;
 		}
-		extent->offset = segment_start_offset;
-		extent->size   = segment_size;
-
-		if( libcdata_array_append_entry(
-		     data_extents_array,
-		     &entry_index,
-		     (intptr_t *) extent,
+		/* When all cache entries are in use setting the directory evicts another directory
+		 */
+		if( number_of_cache_values >= number_of_cache_entries )
+		{
+			LIBFSFAT_STATISTICS_ADD(
+			 file_system->io_handle->statistics.number_of_directory_cache_evictions,
+			 1 );
+		}
+		if( libfcache_cache_set_value_by_identifier(
+		     file_system->directory_cache,
+		     0,
+		     (off64_t) cluster_number,
+		     file_system->cache_timestamp,
+		     (intptr_t *) safe_directory,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_directory_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append data extent to array.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set directory in cache.",
 			 function );
 
 			goto on_error;
 		}
-		extent = NULL;
+		*directory     = safe_directory;
+		safe_directory = NULL;
+	}
+	return( 1 );
 
-		if( segment_size > size )
-		{
-			segment_size = size;
-		}
-		if( libfdata_stream_append_segment(
-		     safe_data_stream,
-		     &segment_index,
-		     0,
-		     segment_start_offset,
-		     segment_size,
-		     0,
+on_error:
+	if( safe_directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &safe_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_system_get_root_directory(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libfsfat_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_file_system_get_root_directory";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_file_entry_initialize(
+	     file_entry,
+	     file_system->io_handle,
+	     file_io_handle,
+	     file_system,
+	     file_system->io_handle->root_directory_offset,
+	     NULL,
+	     file_system->root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file entry of a specific (virtual) identifier
+ * The identifier is the offset of the short name directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_file_system_get_file_entry_by_identifier(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     uint64_t identifier,
+     libfsfat_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsfat_directory_t *directory             = NULL;
+	libfsfat_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsfat_file_system_get_file_entry_by_identifier";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( (off64_t) identifier == file_system->io_handle->root_directory_offset )
+	{
+		directory = file_system->root_directory;
+	}
+	else
+	{
+		if( libfsfat_file_system_read_directory_entry_by_identifier(
+		     file_system,
+		     file_io_handle,
+		     identifier,
+		     &directory_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append stream segment.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry: %" PRIu64 ".",
+			 function,
+			 identifier );
 
 			goto on_error;
 		}
 	}
-	if( libfsfat_block_tree_free(
-	     &cluster_block_tree,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
+	/* libfsfat_file_entry_initialize takes over management of safe_directory_entry and directory
+	 */
+	if( libfsfat_file_entry_initialize(
+	     file_entry,
+	     file_system->io_handle,
+	     file_io_handle,
+	     file_system,
+	     identifier,
+	     directory_entry,
+	     directory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free cluster block tree.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
 		 function );
 
 		goto on_error;
 	}
-	*data_stream = safe_data_stream;
-
 	return( 1 );
 
 on_error:
-	if( extent != NULL )
-	{
-		libfsfat_extent_free(
-		 &extent,
-		 NULL );
-	}
-	if( safe_data_stream != NULL )
-	{
-		libfdata_stream_free(
-		 &safe_data_stream,
-		 NULL );
-	}
-	if( cluster_block_tree != NULL )
+	if( directory_entry != NULL )
 	{
-		libfsfat_block_tree_free(
-		 &cluster_block_tree,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_block_descriptor_free,
+		libfsfat_directory_entry_free(
+		 &directory_entry,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves a directory
- * Returns 1 if successful or -1 on error
+/* Retrieves a path hint for a case folded UTF-8 encoded path
+ * Path hints are cached by the 64-bit FNV-1a hash of the case folded path.
+ * Paths with colliding hashes share the same cache value, hence setting the path hint
+ * of one replaces the path hint of the other. The path hint is compared with the case
+ * folded path so that a path hint of a colliding path is never returned.
+ * Returns 1 if successful, 0 if no such path hint or -1 on error
  */
-int libfsfat_file_system_get_directory(
+int libfsfat_file_system_get_path_hint(
      libfsfat_file_system_t *file_system,
-     libbfio_handle_t *file_io_handle,
-     uint32_t cluster_number,
-     libfsfat_directory_t **directory,
+     const uint8_t *case_folded_path,
+     size_t case_folded_path_size,
+     libfsfat_path_hint_t **path_hint,
      libcerror_error_t **error )
 {
 	libfcache_cache_value_t *cache_value = NULL;
-	libfsfat_directory_t *safe_directory = NULL;
-	static char *function                = "libfsfat_file_system_get_directory";
+	libfsfat_path_hint_t *safe_path_hint = NULL;
+	static char *function                = "libfsfat_file_system_get_path_hint";
+	uint64_t path_hash                   = 0;
 	int result                           = 0;
 
 	if( file_system == NULL )
@@ -2430,10 +3200,48 @@ int libfsfat_file_system_get_directory(
 
 		return( -1 );
 	}
+	if( file_system->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsfat_hash_calculate_fnv1a_64bit(
+	     &path_hash,
+	     case_folded_path,
+	     case_folded_path_size,
+	     LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate path hash.",
+		 function );
+
+		return( -1 );
+	}
 	result = libfcache_cache_get_value_by_identifier(
-	          file_system->directory_cache,
+	          file_system->path_hint_cache,
 	          0,
-	          (off64_t) cluster_number,
+	          (off64_t) ( path_hash & 0x7fffffffffffffffULL ),
 	          file_system->cache_timestamp,
 	          &cache_value,
 	          error );
@@ -2447,169 +3255,370 @@ int libfsfat_file_system_get_directory(
 		 "%s: unable to retrieve value from cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result != 0 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: cache: 0x%08" PRIjx " hit for cluster number: %" PRIu32 "\n",
-			 function,
-			 (intptr_t) file_system->directory_cache,
-			 cluster_number );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
 		if( libfcache_cache_value_get_value(
 		     cache_value,
-		     (intptr_t **) directory,
+		     (intptr_t **) &safe_path_hint,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector data from cache.",
+			 "%s: unable to retrieve path hint from cache.",
 			 function );
 
-			goto on_error;
-		}
-	}
-	else
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: cache: 0x%08" PRIjx " miss for cluster number: %" PRIu32 "\n",
-			 function,
-			 (intptr_t) file_system->directory_cache,
-			 cluster_number );
+			return( -1 );
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		if( libfsfat_file_system_read_directory(
-		     file_system,
-		     file_io_handle,
-		     cluster_number,
-		     &safe_directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory: %" PRIu32 ".",
-			 function,
-			 cluster_number );
+		/* Different paths can have the same hash
+		 */
+		result = libfsfat_path_hint_compare_with_path(
+		          safe_path_hint,
+		          case_folded_path,
+		          case_folded_path_size,
+		          error );
 
-			goto on_error;
-		}
-		if( libfcache_cache_set_value_by_identifier(
-		     file_system->directory_cache,
-		     0,
-		     (off64_t) cluster_number,
-		     file_system->cache_timestamp,
-		     (intptr_t *) safe_directory,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_directory_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set directory in cache.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare path hint with case folded path.",
 			 function );
 
-			goto on_error;
-		}
-		*directory     = safe_directory;
-		safe_directory = NULL;
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_path_hint_cache_hits,
+		 1 );
+
+		*path_hint = safe_path_hint;
+	}
+	else
+	{
+		LIBFSFAT_STATISTICS_ADD(
+		 file_system->io_handle->statistics.number_of_path_hint_cache_misses,
+		 1 );
+	}
+	return( result );
+}
+
+/* Retrieves a path hint for an UTF-8 encoded path
+ * The case folded path is returned so it can be used to set a new path hint, it needs to be freed by the caller
+ * Returns 1 if successful, 0 if no such path hint or -1 on error
+ */
+int libfsfat_file_system_get_path_hint_by_utf8_path(
+     libfsfat_file_system_t *file_system,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t **case_folded_path,
+     size_t *case_folded_path_size,
+     libfsfat_path_hint_t **path_hint,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_case_folded_path    = NULL;
+	static char *function             = "libfsfat_file_system_get_path_hint_by_utf8_path";
+	size_t safe_case_folded_path_size = 0;
+	int result                        = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *case_folded_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid case folded path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hint.",
+		 function );
+
+		return( -1 );
+	}
+	/* The upper case of a character can require more bytes than the character itself
+	 */
+	safe_case_folded_path = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * utf8_string_length * 2 );
+
+	if( safe_case_folded_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create case folded path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_name_copy_case_folded_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     safe_case_folded_path,
+	     utf8_string_length * 2,
+	     &safe_case_folded_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to case folded path.",
+		 function );
+
+		goto on_error;
 	}
-	return( 1 );
+	result = libfsfat_file_system_get_path_hint(
+	          file_system,
+	          safe_case_folded_path,
+	          safe_case_folded_path_size,
+	          path_hint,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path hint.",
+		 function );
+
+		goto on_error;
+	}
+	*case_folded_path      = safe_case_folded_path;
+	*case_folded_path_size = safe_case_folded_path_size;
+
+	return( result );
 
 on_error:
-	if( safe_directory != NULL )
+	if( safe_case_folded_path != NULL )
 	{
-		libfsfat_directory_free(
-		 &safe_directory,
-		 NULL );
+		memory_free(
+		 safe_case_folded_path );
 	}
 	return( -1 );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful or -1 on error
+/* Retrieves a path hint for an UTF-16 encoded path
+ * The path is converted to UTF-8 so that UTF-8 and UTF-16 lookups share the same path hints
+ * The case folded UTF-8 path is returned so it can be used to set a new path hint, it needs to be freed by the caller
+ * Returns 1 if successful, 0 if no such path hint or -1 on error
  */
-int libfsfat_file_system_get_root_directory(
+int libfsfat_file_system_get_path_hint_by_utf16_path(
      libfsfat_file_system_t *file_system,
-     libbfio_handle_t *file_io_handle,
-     libfsfat_file_entry_t **file_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t **case_folded_path,
+     size_t *case_folded_path_size,
+     libfsfat_path_hint_t **path_hint,
      libcerror_error_t **error )
 {
-	static char *function = "libfsfat_file_system_get_root_directory";
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "libfsfat_file_system_get_path_hint_by_utf16_path";
+	size_t utf8_string_size = 0;
+	int result              = 0;
 
-	if( file_system == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system.",
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_system->io_handle == NULL )
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 8 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsfat_file_entry_initialize(
-	     file_entry,
-	     file_system->io_handle,
-	     file_io_handle,
-	     file_system,
-	     file_system->io_handle->root_directory_offset,
-	     NULL,
-	     file_system->root_directory,
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_length,
+	     &utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
+	if( ( utf8_string_size <= 1 )
+	 || ( utf8_string_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string to UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	/* The UTF-8 string size includes the end of string character
+	 */
+	result = libfsfat_file_system_get_path_hint_by_utf8_path(
+	          file_system,
+	          utf8_string,
+	          utf8_string_size - 1,
+	          case_folded_path,
+	          case_folded_path_size,
+	          path_hint,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path hint by UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( result );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
 }
 
-/* Retrieves the file entry of a specific (virtual) identifier
- * The identifier is the offset of the short name directory entry
+/* Sets a path hint for a case folded UTF-8 encoded path
  * Returns 1 if successful or -1 on error
  */
-int libfsfat_file_system_get_file_entry_by_identifier(
+int libfsfat_file_system_set_path_hint(
      libfsfat_file_system_t *file_system,
-     libbfio_handle_t *file_io_handle,
-     uint64_t identifier,
-     libfsfat_file_entry_t **file_entry,
+     const uint8_t *case_folded_path,
+     size_t case_folded_path_size,
+     libfsfat_directory_entry_t *directory_entry,
      libcerror_error_t **error )
 {
-	libfsfat_directory_t *directory             = NULL;
-	libfsfat_directory_entry_t *directory_entry = NULL;
-	static char *function                       = "libfsfat_file_system_get_file_entry_by_identifier";
+	libfsfat_path_hint_t *path_hint = NULL;
+	static char *function           = "libfsfat_file_system_set_path_hint";
+	uint64_t path_hash              = 0;
 
 	if( file_system == NULL )
 	{
@@ -2622,58 +3631,77 @@ int libfsfat_file_system_get_file_entry_by_identifier(
 
 		return( -1 );
 	}
-	if( file_system->io_handle == NULL )
+	if( case_folded_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded path.",
 		 function );
 
 		return( -1 );
 	}
-	if( (off64_t) identifier == file_system->io_handle->root_directory_offset )
-	{
-		directory = file_system->root_directory;
-	}
-	else
+	if( libfsfat_path_hint_initialize(
+	     &path_hint,
+	     case_folded_path,
+	     case_folded_path_size,
+	     error ) != 1 )
 	{
-		if( libfsfat_file_system_read_directory_entry_by_identifier(
-		     file_system,
-		     file_io_handle,
-		     identifier,
-		     &directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entry: %" PRIu64 ".",
-			 function,
-			 identifier );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path hint.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	/* libfsfat_file_entry_initialize takes over management of safe_directory_entry and directory
-	 */
-	if( libfsfat_file_entry_initialize(
-	     file_entry,
-	     file_system->io_handle,
-	     file_io_handle,
-	     file_system,
-	     identifier,
+	if( libfsfat_directory_entry_clone(
+	     &( path_hint->directory_entry ),
 	     directory_entry,
-	     directory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 "%s: unable to create path hint directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_hash_calculate_fnv1a_64bit(
+	     &path_hash,
+	     case_folded_path,
+	     case_folded_path_size,
+	     LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate path hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_identifier(
+	     file_system->path_hint_cache,
+	     0,
+	     (off64_t) ( path_hash & 0x7fffffffffffffffULL ),
+	     file_system->cache_timestamp,
+	     (intptr_t *) path_hint,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_path_hint_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path hint in cache.",
 		 function );
 
 		goto on_error;
@@ -2681,10 +3709,10 @@ int libfsfat_file_system_get_file_entry_by_identifier(
 	return( 1 );
 
 on_error:
-	if( directory_entry != NULL )
+	if( path_hint != NULL )
 	{
-		libfsfat_directory_entry_free(
-		 &directory_entry,
+		libfsfat_path_hint_free(
+		 &path_hint,
 		 NULL );
 	}
 	return( -1 );
@@ -2704,9 +3732,12 @@ int libfsfat_file_system_get_file_entry_by_utf8_path(
 	libfsfat_directory_t *directory                  = NULL;
 	libfsfat_directory_entry_t *directory_entry      = NULL;
 	libfsfat_directory_entry_t *safe_directory_entry = NULL;
+	libfsfat_path_hint_t *path_hint                  = NULL;
+	uint8_t *case_folded_path                        = NULL;
 	const uint8_t *utf8_string_segment               = NULL;
 	static char *function                            = "libfsfat_file_system_get_file_entry_by_utf8_path";
 	libuna_unicode_character_t unicode_character     = 0;
+	size_t case_folded_path_size                     = 0;
 	size_t utf8_string_index                         = 0;
 	size_t utf8_string_segment_length                = 0;
 	uint64_t identifier                              = 0;
@@ -2760,9 +3791,42 @@ int libfsfat_file_system_get_file_entry_by_utf8_path(
 	if( ( utf8_string_length == 0 )
 	 || ( utf8_string_length == 1 ) )
 	{
+		utf8_string_index = utf8_string_length;
+
 		result = 1;
 	}
-	else while( utf8_string_index < utf8_string_length )
+	else
+	{
+		path_hint = NULL;
+
+		result = libfsfat_file_system_get_path_hint_by_utf8_path(
+		          file_system,
+		          &( utf8_string[ utf8_string_index ] ),
+		          utf8_string_length - utf8_string_index,
+		          &case_folded_path,
+		          &case_folded_path_size,
+		          &path_hint,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path hint.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			directory_entry   = path_hint->directory_entry;
+			directory         = NULL;
+			utf8_string_index = utf8_string_length;
+		}
+	}
+	while( utf8_string_index < utf8_string_length )
 	{
 		if( directory != file_system->root_directory )
 		{
@@ -2882,6 +3946,27 @@ int libfsfat_file_system_get_file_entry_by_utf8_path(
 
 			goto on_error;
 		}
+		if( ( path_hint == NULL )
+		 && ( case_folded_path != NULL )
+		 && ( result == 1 ) )
+		{
+			if( libfsfat_file_system_set_path_hint(
+			     file_system,
+			     case_folded_path,
+			     case_folded_path_size,
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path hint.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libfsfat_directory_entry_clone(
 		     &safe_directory_entry,
 		     directory_entry,
@@ -2919,6 +4004,11 @@ int libfsfat_file_system_get_file_entry_by_utf8_path(
 
 		goto on_error;
 	}
+	if( case_folded_path != NULL )
+	{
+		memory_free(
+		 case_folded_path );
+	}
 	return( result );
 
 on_error:
@@ -2928,6 +4018,11 @@ on_error:
 		 &safe_directory_entry,
 		 NULL );
 	}
+	if( case_folded_path != NULL )
+	{
+		memory_free(
+		 case_folded_path );
+	}
 	return( -1 );
 }
 
@@ -2945,9 +4040,12 @@ int libfsfat_file_system_get_file_entry_by_utf16_path(
 	libfsfat_directory_t *directory                  = NULL;
 	libfsfat_directory_entry_t *directory_entry      = NULL;
 	libfsfat_directory_entry_t *safe_directory_entry = NULL;
+	libfsfat_path_hint_t *path_hint                  = NULL;
+	uint8_t *case_folded_path                        = NULL;
 	const uint16_t *utf16_string_segment             = NULL;
 	static char *function                            = "libfsfat_file_system_get_file_entry_by_utf16_path";
 	libuna_unicode_character_t unicode_character     = 0;
+	size_t case_folded_path_size                     = 0;
 	size_t utf16_string_index                        = 0;
 	size_t utf16_string_segment_length               = 0;
 	uint64_t identifier                              = 0;
@@ -3001,9 +4099,42 @@ int libfsfat_file_system_get_file_entry_by_utf16_path(
 	if( ( utf16_string_length == 0 )
 	 || ( utf16_string_length == 1 ) )
 	{
+		utf16_string_index = utf16_string_length;
+
 		result = 1;
 	}
-	else while( utf16_string_index < utf16_string_length )
+	else
+	{
+		path_hint = NULL;
+
+		result = libfsfat_file_system_get_path_hint_by_utf16_path(
+		          file_system,
+		          &( utf16_string[ utf16_string_index ] ),
+		          utf16_string_length - utf16_string_index,
+		          &case_folded_path,
+		          &case_folded_path_size,
+		          &path_hint,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path hint.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			directory_entry    = path_hint->directory_entry;
+			directory          = NULL;
+			utf16_string_index = utf16_string_length;
+		}
+	}
+	while( utf16_string_index < utf16_string_length )
 	{
 		if( directory != file_system->root_directory )
 		{
@@ -3123,6 +4254,27 @@ int libfsfat_file_system_get_file_entry_by_utf16_path(
 
 			goto on_error;
 		}
+		if( ( path_hint == NULL )
+		 && ( case_folded_path != NULL )
+		 && ( result == 1 ) )
+		{
+			if( libfsfat_file_system_set_path_hint(
+			     file_system,
+			     case_folded_path,
+			     case_folded_path_size,
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path hint.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libfsfat_directory_entry_clone(
 		     &safe_directory_entry,
 		     directory_entry,
@@ -3160,6 +4312,11 @@ int libfsfat_file_system_get_file_entry_by_utf16_path(
 
 		goto on_error;
 	}
+	if( case_folded_path != NULL )
+	{
+		memory_free(
+		 case_folded_path );
+	}
 	return( result );
 
 on_error:
@@ -3169,6 +4326,11 @@ on_error:
 		 &safe_directory_entry,
 		 NULL );
 	}
+	if( case_folded_path != NULL )
+	{
+		memory_free(
+		 case_folded_path );
+	}
 	return( -1 );
 }
 
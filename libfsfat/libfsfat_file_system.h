@@ -28,6 +28,9 @@
 #include "libfsfat_allocation_table.h"
 #include "libfsfat_block_tree.h"
 #include "libfsfat_directory.h"
+#include "libfsfat_directory_entry.h"
+#include "libfsfat_directory_parser.h"
+#include "libfsfat_index.h"
 #include "libfsfat_io_handle.h"
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcdata.h"
@@ -35,6 +38,7 @@
 #include "libfsfat_libcthreads.h"
 #include "libfsfat_libfcache.h"
 #include "libfsfat_libfdata.h"
+#include "libfsfat_path_hint.h"
 #include "libfsfat_types.h"
 
 #if defined( __cplusplus )
@@ -69,6 +73,40 @@ struct libfsfat_file_system
 	 */
 	libfsfat_directory_t *root_directory;
 
+	/* The path hint cache
+	 */
+	libfcache_cache_t *path_hint_cache;
+
+	/* The root directory offset
+	 */
+	off64_t root_directory_offset;
+
+	/* The root directory size
+	 */
+	size64_t root_directory_size;
+
+	/* The root directory cluster number
+	 */
+	uint32_t root_directory_cluster;
+
+	/* The metadata index used to read directory data
+	 */
+	libfsfat_index_t *index;
+
+	/* The metadata index directory data is recorded in when exporting an index
+	 */
+	libfsfat_index_t *export_index;
+
+	/* The function to read directory entries data, selected by the file system format
+	 */
+	int (*read_directory_data)(
+	       libfsfat_directory_parser_t *directory_parser,
+	       libfsfat_directory_t *directory,
+	       const uint8_t *data,
+	       size_t data_size,
+	       off64_t file_offset,
+	       libcerror_error_t **error );
+
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -92,6 +130,14 @@ int libfsfat_file_system_check_if_cluster_block_first_read(
      off64_t cluster_offset,
      libcerror_error_t **error );
 
+int libfsfat_file_system_read_buffer_at_offset(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libfsfat_file_system_read_allocation_table(
      libfsfat_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
@@ -99,6 +145,13 @@ int libfsfat_file_system_read_allocation_table(
      size64_t size,
      libcerror_error_t **error );
 
+int libfsfat_file_system_read_directory_entry(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libfsfat_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
 int libfsfat_file_system_read_directory(
      libfsfat_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
@@ -129,6 +182,24 @@ int libfsfat_file_system_read_root_directory(
      uint32_t cluster_number,
      libcerror_error_t **error );
 
+int libfsfat_file_system_set_index(
+     libfsfat_file_system_t *file_system,
+     libfsfat_index_t *index,
+     libcerror_error_t **error );
+
+int libfsfat_internal_file_system_export_sub_directories(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libfsfat_directory_t *directory,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsfat_file_system_export_index(
+     libfsfat_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libfsfat_index_t *index,
+     libcerror_error_t **error );
+
 int libfsfat_file_system_get_data_stream(
      libfsfat_file_system_t *file_system,
      uint32_t cluster_number,
@@ -157,6 +228,38 @@ int libfsfat_file_system_get_file_entry_by_identifier(
      libfsfat_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsfat_file_system_get_path_hint(
+     libfsfat_file_system_t *file_system,
+     const uint8_t *case_folded_path,
+     size_t case_folded_path_size,
+     libfsfat_path_hint_t **path_hint,
+     libcerror_error_t **error );
+
+int libfsfat_file_system_get_path_hint_by_utf8_path(
+     libfsfat_file_system_t *file_system,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t **case_folded_path,
+     size_t *case_folded_path_size,
+     libfsfat_path_hint_t **path_hint,
+     libcerror_error_t **error );
+
+int libfsfat_file_system_get_path_hint_by_utf16_path(
+     libfsfat_file_system_t *file_system,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t **case_folded_path,
+     size_t *case_folded_path_size,
+     libfsfat_path_hint_t **path_hint,
+     libcerror_error_t **error );
+
+int libfsfat_file_system_set_path_hint(
+     libfsfat_file_system_t *file_system,
+     const uint8_t *case_folded_path,
+     size_t case_folded_path_size,
+     libfsfat_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
 int libfsfat_file_system_get_file_entry_by_utf8_path(
      libfsfat_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
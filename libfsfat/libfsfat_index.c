@@ -0,0 +1,1248 @@
+/*
+ * Metadata index functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsfat_definitions.h"
+#include "libfsfat_index.h"
+#include "libfsfat_libbfio.h"
+#include "libfsfat_libcdata.h"
+#include "libfsfat_libcerror.h"
+#include "libfsfat_libcnotify.h"
+
+#include "fsfat_index.h"
+
+const uint8_t fsfat_index_signature[ 8 ] = {
+	'F', 'S', 'F', 'A', 'T', 'I', 'D', 'X' };
+
+/* Frees an index block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_block_free(
+     libfsfat_index_block_t **index_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_index_block_free";
+
+	if( index_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_block != NULL )
+	{
+		if( ( *index_block )->data != NULL )
+		{
+			memory_free(
+			 ( *index_block )->data );
+		}
+		memory_free(
+		 *index_block );
+
+		*index_block = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an index
+ * Make sure the value index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_initialize(
+     libfsfat_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_index_initialize";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index = memory_allocate_structure(
+	          libfsfat_index_t );
+
+	if( *index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index,
+	     0,
+	     sizeof( libfsfat_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		memory_free(
+		 *index );
+
+		*index = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *index )->blocks_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blocks array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index != NULL )
+	{
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_free(
+     libfsfat_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_index_free";
+	int result            = 1;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *index )->blocks_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_index_block_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( result );
+}
+
+/* Appends a block of metadata read from the volume
+ * The data is copied, the blocks are not kept sorted by file offset,
+ * use libfsfat_index_sort_blocks after the last block was appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_append_block(
+     libfsfat_index_t *index,
+     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsfat_index_block_t *index_block = NULL;
+	static char *function               = "libfsfat_index_append_block";
+	int entry_index                     = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) LIBFSFAT_INDEX_MAXIMUM_BLOCK_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	index_block = memory_allocate_structure(
+	               libfsfat_index_block_t );
+
+	if( index_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index block.",
+		 function );
+
+		goto on_error;
+	}
+	index_block->file_offset = file_offset;
+	index_block->data_size   = data_size;
+
+	index_block->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * data_size );
+
+	if( index_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     index_block->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy index block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     index->blocks_array,
+	     &entry_index,
+	     (intptr_t *) index_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append index block to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_block != NULL )
+	{
+		libfsfat_index_block_free(
+		 &index_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sorts the blocks by file offset
+ * The blocks are sorted with a bottom-up merge sort, of blocks with the same file offset
+ * only the first appended block is kept
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_sort_blocks(
+     libfsfat_index_t *index,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *sorted_blocks_array  = NULL;
+	libfsfat_index_block_t **blocks        = NULL;
+	libfsfat_index_block_t **merged_blocks = NULL;
+	libfsfat_index_block_t **swap_blocks   = NULL;
+	static char *function                  = "libfsfat_index_sort_blocks";
+	size_t blocks_size                     = 0;
+	int block_index                        = 0;
+	int entry_index                        = 0;
+	int left_block_index                   = 0;
+	int left_end_block_index               = 0;
+	int merged_block_index                 = 0;
+	int number_of_blocks                   = 0;
+	int right_block_index                  = 0;
+	int right_end_block_index              = 0;
+	int run_size                           = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index->blocks_array,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks <= 1 )
+	{
+		return( 1 );
+	}
+	blocks_size = sizeof( libfsfat_index_block_t * ) * (size_t) number_of_blocks;
+
+	blocks = (libfsfat_index_block_t **) memory_allocate(
+	                                      blocks_size );
+
+	if( blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	merged_blocks = (libfsfat_index_block_t **) memory_allocate(
+	                                             blocks_size );
+
+	if( merged_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merged blocks.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     index->blocks_array,
+		     block_index,
+		     (intptr_t **) &( blocks[ block_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block: %d.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		if( blocks[ block_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing block: %d.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+	}
+	/* Merge runs of run size blocks, a block of the left run is taken first
+	 * when the file offsets are equal so that the sort is stable
+	 */
+	for( run_size = 1;
+	     run_size < number_of_blocks;
+	     run_size *= 2 )
+	{
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index = right_end_block_index )
+		{
+			left_block_index     = block_index;
+			left_end_block_index = number_of_blocks;
+
+			if( run_size < ( number_of_blocks - block_index ) )
+			{
+				left_end_block_index = block_index + run_size;
+			}
+			right_block_index     = left_end_block_index;
+			right_end_block_index = number_of_blocks;
+
+			if( run_size < ( number_of_blocks - left_end_block_index ) )
+			{
+				right_end_block_index = left_end_block_index + run_size;
+			}
+			merged_block_index = block_index;
+
+			while( ( left_block_index < left_end_block_index )
+			    || ( right_block_index < right_end_block_index ) )
+			{
+				if( ( right_block_index >= right_end_block_index )
+				 || ( ( left_block_index < left_end_block_index )
+				  && ( blocks[ left_block_index ]->file_offset <= blocks[ right_block_index ]->file_offset ) ) )
+				{
+					merged_blocks[ merged_block_index++ ] = blocks[ left_block_index++ ];
+				}
+				else
+				{
+					merged_blocks[ merged_block_index++ ] = blocks[ right_block_index++ ];
+				}
+			}
+		}
+		swap_blocks   = blocks;
+		blocks        = merged_blocks;
+		merged_blocks = swap_blocks;
+	}
+	if( libcdata_array_initialize(
+	     &sorted_blocks_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sorted blocks array.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( ( block_index > 0 )
+		 && ( blocks[ block_index ]->file_offset == blocks[ block_index - 1 ]->file_offset ) )
+		{
+			continue;
+		}
+		if( libcdata_array_append_entry(
+		     sorted_blocks_array,
+		     &entry_index,
+		     (intptr_t *) blocks[ block_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block: %d to sorted blocks array.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+	}
+	/* The sorted blocks array has taken over management of the blocks
+	 * except for the duplicates
+	 */
+	for( block_index = number_of_blocks - 1;
+	     block_index > 0;
+	     block_index-- )
+	{
+		if( blocks[ block_index ]->file_offset == blocks[ block_index - 1 ]->file_offset )
+		{
+			libfsfat_index_block_free(
+			 &( blocks[ block_index ] ),
+			 NULL );
+		}
+	}
+	if( libcdata_array_free(
+	     &( index->blocks_array ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free blocks array.",
+		 function );
+
+		index->blocks_array = sorted_blocks_array;
+
+		sorted_blocks_array = NULL;
+
+		goto on_error;
+	}
+	index->blocks_array = sorted_blocks_array;
+
+	memory_free(
+	 merged_blocks );
+
+	memory_free(
+	 blocks );
+
+	return( 1 );
+
+on_error:
+	if( sorted_blocks_array != NULL )
+	{
+		libcdata_array_free(
+		 &sorted_blocks_array,
+		 NULL,
+		 NULL );
+	}
+	if( merged_blocks != NULL )
+	{
+		memory_free(
+		 merged_blocks );
+	}
+	if( blocks != NULL )
+	{
+		memory_free(
+		 blocks );
+	}
+	return( -1 );
+}
+
+/* Reads data from the index at a specific volume offset
+ * The data must be contained in a single block
+ * Returns 1 if successful, 0 if the data is not in the index or -1 on error
+ */
+int libfsfat_index_read_buffer_at_offset(
+     libfsfat_index_t *index,
+     off64_t file_offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libfsfat_index_block_t *index_block    = NULL;
+	libfsfat_index_block_t *matching_block = NULL;
+	static char *function                  = "libfsfat_index_read_buffer_at_offset";
+	size64_t block_offset                  = 0;
+	int lower_entry_index                  = 0;
+	int middle_entry_index                 = 0;
+	int number_of_blocks                   = 0;
+	int upper_entry_index                  = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index->blocks_array,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last block that starts at or before the file offset
+	 */
+	upper_entry_index = number_of_blocks;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     index->blocks_array,
+		     middle_entry_index,
+		     (intptr_t **) &index_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( index_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing block: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( index_block->file_offset <= file_offset )
+		{
+			matching_block    = index_block;
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	if( matching_block == NULL )
+	{
+		return( 0 );
+	}
+	block_offset = (size64_t) ( file_offset - matching_block->file_offset );
+
+	if( ( block_offset > (size64_t) matching_block->data_size )
+	 || ( (size64_t) buffer_size > ( (size64_t) matching_block->data_size - block_offset ) ) )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( matching_block->data[ block_offset ] ),
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads an index file
+ * The blocks are read into memory, they must be stored sorted by file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_read_file_io_handle(
+     libfsfat_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	fsfat_index_block_header_t block_header;
+	fsfat_index_file_header_t file_header;
+
+	libfsfat_index_block_t *index_block = NULL;
+	static char *function               = "libfsfat_index_read_file_io_handle";
+	size64_t file_size                  = 0;
+	ssize_t read_count                  = 0;
+	off64_t file_offset                 = 0;
+	uint64_t previous_end_offset        = 0;
+	uint64_t value_64bit                = 0;
+	uint32_t block_index                = 0;
+	uint32_t format_version             = 0;
+	uint32_t number_of_blocks           = 0;
+	uint32_t value_32bit                = 0;
+	int entry_index                     = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( fsfat_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( fsfat_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     fsfat_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid index file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_blocks,
+	 number_of_blocks );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.boot_record_checksum,
+	 index->boot_record_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.allocation_table_checksum,
+	 index->allocation_table_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: number of blocks\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_blocks );
+
+		libcnotify_printf(
+		 "%s: boot record checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 index->boot_record_checksum );
+
+		libcnotify_printf(
+		 "%s: allocation table checksum\t: 0x%08" PRIx32 "\n",
+		 function,
+		 index->allocation_table_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( format_version != LIBFSFAT_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index file format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	/* Every block consists of at least a block header and 1 byte of data
+	 */
+	if( (size64_t) number_of_blocks > ( file_size / ( sizeof( fsfat_index_block_header_t ) + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) sizeof( fsfat_index_file_header_t );
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              (uint8_t *) &block_header,
+		              sizeof( fsfat_index_block_header_t ),
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) sizeof( fsfat_index_block_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu32 " header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		file_offset += sizeof( fsfat_index_block_header_t );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 block_header.file_offset,
+		 value_64bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 block_header.data_size,
+		 value_32bit );
+
+		if( value_64bit > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block: %" PRIu32 " file offset value out of bounds.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		/* The blocks are appended as read, which requires them to be sorted and not overlap
+		 */
+		if( value_64bit < previous_end_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block: %" PRIu32 " file offset value out of bounds - overlaps previous block.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		if( ( value_32bit == 0 )
+		 || ( value_32bit > (uint32_t) LIBFSFAT_INDEX_MAXIMUM_BLOCK_DATA_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block: %" PRIu32 " data size value out of bounds.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		index_block = memory_allocate_structure(
+		               libfsfat_index_block_t );
+
+		if( index_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index block.",
+			 function );
+
+			goto on_error;
+		}
+		index_block->file_offset = (off64_t) value_64bit;
+		index_block->data_size   = (size_t) value_32bit;
+
+		index_block->data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * index_block->data_size );
+
+		if( index_block->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index block data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              index_block->data,
+		              index_block->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) index_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		file_offset += index_block->data_size;
+
+		previous_end_offset = value_64bit + value_32bit;
+
+		if( libcdata_array_append_entry(
+		     index->blocks_array,
+		     &entry_index,
+		     (intptr_t *) index_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block: %" PRIu32 " to array.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		index_block = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( index_block != NULL )
+	{
+		libfsfat_index_block_free(
+		 &index_block,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 index->blocks_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsfat_index_block_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes an index file
+ * The blocks must have been sorted by file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_index_write_file_io_handle(
+     libfsfat_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	fsfat_index_block_header_t block_header;
+	fsfat_index_file_header_t file_header;
+
+	libfsfat_index_block_t *index_block = NULL;
+	static char *function               = "libfsfat_index_write_file_io_handle";
+	ssize_t write_count                 = 0;
+	int block_index                     = 0;
+	int number_of_blocks                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index->blocks_array,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     fsfat_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 LIBFSFAT_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_blocks,
+	 (uint32_t) number_of_blocks );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.boot_record_checksum,
+	 index->boot_record_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.allocation_table_checksum,
+	 index->allocation_table_checksum );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( fsfat_index_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( fsfat_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     index->blocks_array,
+		     block_index,
+		     (intptr_t **) &index_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		if( index_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 block_header.file_offset,
+		 (uint64_t) index_block->file_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 block_header.data_size,
+		 (uint32_t) index_block->data_size );
+
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               (uint8_t *) &block_header,
+		               sizeof( fsfat_index_block_header_t ),
+		               error );
+
+		if( write_count != (ssize_t) sizeof( fsfat_index_block_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block: %d header.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               index_block->data,
+		               index_block->data_size,
+		               error );
+
+		if( write_count != (ssize_t) index_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block: %d data.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
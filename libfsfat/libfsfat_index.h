@@ -0,0 +1,115 @@
+/*
+ * Metadata index functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSFAT_INDEX_H )
+#define _LIBFSFAT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsfat_libbfio.h"
+#include "libfsfat_libcdata.h"
+#include "libfsfat_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsfat_index_block libfsfat_index_block_t;
+
+struct libfsfat_index_block
+{
+	/* The offset of the block data in the volume
+	 */
+	off64_t file_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libfsfat_index libfsfat_index_t;
+
+struct libfsfat_index
+{
+	/* The CRC-32 of the boot record data of the volume
+	 */
+	uint32_t boot_record_checksum;
+
+	/* The CRC-32 of the allocation table data of the volume
+	 */
+	uint32_t allocation_table_checksum;
+
+	/* The blocks array, sorted by file offset when read or after sorting
+	 */
+	libcdata_array_t *blocks_array;
+};
+
+int libfsfat_index_block_free(
+     libfsfat_index_block_t **index_block,
+     libcerror_error_t **error );
+
+int libfsfat_index_initialize(
+     libfsfat_index_t **index,
+     libcerror_error_t **error );
+
+int libfsfat_index_free(
+     libfsfat_index_t **index,
+     libcerror_error_t **error );
+
+int libfsfat_index_append_block(
+     libfsfat_index_t *index,
+     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsfat_index_sort_blocks(
+     libfsfat_index_t *index,
+     libcerror_error_t **error );
+
+int libfsfat_index_read_buffer_at_offset(
+     libfsfat_index_t *index,
+     off64_t file_offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libfsfat_index_read_file_io_handle(
+     libfsfat_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsfat_index_write_file_io_handle(
+     libfsfat_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSFAT_INDEX_H ) */
+
@@ -142,7 +142,8 @@ int libfsfat_io_handle_clear(
      libfsfat_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsfat_io_handle_clear";
+	static char *function     = "libfsfat_io_handle_clear";
+	uint32_t statistics_flags = 0;
 
 	if( io_handle == NULL )
 	{
@@ -155,6 +156,10 @@ int libfsfat_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The statistics flags are a setting of the volume and are retained
+	 */
+	statistics_flags = io_handle->statistics.flags;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -169,6 +174,8 @@ int libfsfat_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->statistics.flags = statistics_flags;
+
 	return( 1 );
 }
 
@@ -27,6 +27,7 @@
 
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcerror.h"
+#include "libfsfat_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -64,9 +65,17 @@ struct libfsfat_io_handle
 	 */
 	off64_t first_cluster_offset;
 
+	/* The CRC-32 of the boot record data
+	 */
+	uint32_t boot_record_checksum;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The statistics
+	 */
+	libfsfat_statistics_t statistics;
 };
 
 int libfsfat_io_handle_initialize(
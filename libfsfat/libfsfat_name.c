@@ -398,3 +398,400 @@ int libfsfat_name_compare_with_utf16_string(
 	return( LIBUNA_COMPARE_EQUAL );
 }
 
+/* Compares an UTF-8 string with a case folded UTF-8 encoded name
+ * The UTF-8 string is case folded one character at a time, no case folded copy is created
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsfat_name_compare_case_folded_name_with_utf8_string(
+     const uint8_t *case_folded_name,
+     size_t case_folded_name_length,
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t case_folded_character[ 8 ];
+
+	static char *function                        = "libfsfat_name_compare_case_folded_name_with_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t case_folded_character_index           = 0;
+	size_t case_folded_character_size            = 0;
+	size_t name_index                            = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( case_folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid case folded name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		case_folded_character_size = 0;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     case_folded_character,
+		     8,
+		     &case_folded_character_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Unicode character to case folded character.",
+			 function );
+
+			return( -1 );
+		}
+		/* UTF-8 encoded strings sort in the same order as their Unicode characters
+		 * hence a byte compare is sufficient
+		 */
+		for( case_folded_character_index = 0;
+		     case_folded_character_index < case_folded_character_size;
+		     case_folded_character_index++ )
+		{
+			if( name_index >= case_folded_name_length )
+			{
+				return( LIBUNA_COMPARE_GREATER );
+			}
+			if( case_folded_character[ case_folded_character_index ] < case_folded_name[ name_index ] )
+			{
+				return( LIBUNA_COMPARE_LESS );
+			}
+			else if( case_folded_character[ case_folded_character_index ] > case_folded_name[ name_index ] )
+			{
+				return( LIBUNA_COMPARE_GREATER );
+			}
+			name_index++;
+		}
+	}
+	if( name_index < case_folded_name_length )
+	{
+		return( LIBUNA_COMPARE_LESS );
+	}
+	return( LIBUNA_COMPARE_EQUAL );
+}
+
+/* Copies an UTF-8 string to a case folded UTF-8 string
+ * The copy stops at the first end of string character, which is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_name_copy_case_folded_utf8_string(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *case_folded_string,
+     size_t case_folded_string_size,
+     size_t *case_folded_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsfat_name_copy_case_folded_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t case_folded_string_index              = 0;
+	size_t utf8_string_index                     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded string.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid case folded string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded string length.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     case_folded_string,
+		     case_folded_string_size,
+		     &case_folded_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Unicode character to case folded string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*case_folded_string_length = case_folded_string_index;
+
+	return( 1 );
+}
+
+/* Copies an UTF-16 or byte stream encoded name to a case folded UTF-8 string
+ * The copy stops at the first end of string character, which is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_name_copy_case_folded_utf8_string_from_name(
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t is_unicode,
+     uint8_t *case_folded_string,
+     size_t case_folded_string_size,
+     size_t *case_folded_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsfat_name_copy_case_folded_utf8_string_from_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t case_folded_string_index              = 0;
+	size_t name_index                            = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded string.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid case folded string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded string length.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < name_size )
+	{
+		if( is_unicode != 0 )
+		{
+			if( libuna_unicode_character_copy_from_utf16_stream(
+			     &unicode_character,
+			     name,
+			     name_size,
+			     &name_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 encoded name to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+/* TODO add codepage support */
+			if( libuna_unicode_character_copy_from_byte_stream(
+			     &unicode_character,
+			     name,
+			     name_size,
+			     &name_index,
+			     LIBUNA_CODEPAGE_ASCII,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte encoded name to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     case_folded_string,
+		     case_folded_string_size,
+		     &case_folded_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Unicode character to case folded string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*case_folded_string_length = case_folded_string_index;
+
+	return( 1 );
+}
+
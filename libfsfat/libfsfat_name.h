@@ -50,6 +50,30 @@ int libfsfat_name_compare_with_utf16_string(
      uint8_t use_case_folding,
      libcerror_error_t **error );
 
+int libfsfat_name_compare_case_folded_name_with_utf8_string(
+     const uint8_t *case_folded_name,
+     size_t case_folded_name_length,
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libfsfat_name_copy_case_folded_utf8_string(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *case_folded_string,
+     size_t case_folded_string_size,
+     size_t *case_folded_string_length,
+     libcerror_error_t **error );
+
+int libfsfat_name_copy_case_folded_utf8_string_from_name(
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t is_unicode,
+     uint8_t *case_folded_string,
+     size_t case_folded_string_size,
+     size_t *case_folded_string_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,266 @@
+/*
+ * Path hint functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsfat_directory_entry.h"
+#include "libfsfat_libcerror.h"
+#include "libfsfat_path_hint.h"
+
+/* Creates a path hint
+ * Make sure the value path_hint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_path_hint_initialize(
+     libfsfat_path_hint_t **path_hint,
+     const uint8_t *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_path_hint_initialize";
+
+	if( path_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_hint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path hint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_size == 0 )
+	 || ( path_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*path_hint = memory_allocate_structure(
+	              libfsfat_path_hint_t );
+
+	if( *path_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path hint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_hint,
+	     0,
+	     sizeof( libfsfat_path_hint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path hint.",
+		 function );
+
+		memory_free(
+		 *path_hint );
+
+		*path_hint = NULL;
+
+		return( -1 );
+	}
+	( *path_hint )->path = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * path_size );
+
+	if( ( *path_hint )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *path_hint )->path,
+	     path,
+	     path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_hint )->path_size = path_size;
+
+	return( 1 );
+
+on_error:
+	if( *path_hint != NULL )
+	{
+		if( ( *path_hint )->path != NULL )
+		{
+			memory_free(
+			 ( *path_hint )->path );
+		}
+		memory_free(
+		 *path_hint );
+
+		*path_hint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path hint
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_path_hint_free(
+     libfsfat_path_hint_t **path_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_path_hint_free";
+	int result            = 1;
+
+	if( path_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_hint != NULL )
+	{
+		if( ( *path_hint )->directory_entry != NULL )
+		{
+			if( libfsfat_directory_entry_free(
+			     &( ( *path_hint )->directory_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *path_hint )->path != NULL )
+		{
+			memory_free(
+			 ( *path_hint )->path );
+		}
+		memory_free(
+		 *path_hint );
+
+		*path_hint = NULL;
+	}
+	return( result );
+}
+
+/* Compares a case folded UTF-8 encoded path with the path hint
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libfsfat_path_hint_compare_with_path(
+     libfsfat_path_hint_t *path_hint,
+     const uint8_t *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_path_hint_compare_with_path";
+
+	if( path_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hint->path_size != path_size )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     path_hint->path,
+	     path,
+	     path_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,73 @@
+/*
+ * Path hint functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSFAT_PATH_HINT_H )
+#define _LIBFSFAT_PATH_HINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsfat_directory_entry.h"
+#include "libfsfat_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsfat_path_hint libfsfat_path_hint_t;
+
+struct libfsfat_path_hint
+{
+	/* The case folded UTF-8 encoded path
+	 */
+	uint8_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The directory entry
+	 */
+	libfsfat_directory_entry_t *directory_entry;
+};
+
+int libfsfat_path_hint_initialize(
+     libfsfat_path_hint_t **path_hint,
+     const uint8_t *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+int libfsfat_path_hint_free(
+     libfsfat_path_hint_t **path_hint,
+     libcerror_error_t **error );
+
+int libfsfat_path_hint_compare_with_path(
+     libfsfat_path_hint_t *path_hint,
+     const uint8_t *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSFAT_PATH_HINT_H ) */
+
@@ -0,0 +1,243 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "libfsfat_definitions.h"
+#include "libfsfat_libcerror.h"
+#include "libfsfat_libcthreads.h"
+#include "libfsfat_statistics.h"
+#include "libfsfat_types.h"
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ * Returns the timestamp or 0 if not available
+ */
+uint64_t libfsfat_statistics_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_structure;
+#elif defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_structure;
+#endif
+
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_structure.tv_sec * 1000000000 ) + (uint64_t) time_structure.tv_nsec );
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	if( gettimeofday(
+	     &time_structure,
+	     NULL ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_structure.tv_sec * 1000000000 ) + ( (uint64_t) time_structure.tv_usec * 1000 ) );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Copies the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_statistics_copy(
+     libfsfat_statistics_t *destination_statistics,
+     libfsfat_statistics_t *source_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_statistics_copy";
+
+	if( destination_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The counters are copied individually since they can be updated concurrently
+	 * The size of the destination statistics is set by the caller and is not copied
+	 */
+	destination_statistics->flags                               = source_statistics->flags;
+	destination_statistics->number_of_read_calls                = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_read_calls );
+	destination_statistics->number_of_bytes_read                = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_bytes_read );
+	destination_statistics->number_of_directory_cache_hits      = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_directory_cache_hits );
+	destination_statistics->number_of_directory_cache_misses    = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_directory_cache_misses );
+	destination_statistics->number_of_directory_cache_evictions = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_directory_cache_evictions );
+	destination_statistics->number_of_path_hint_cache_hits      = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_path_hint_cache_hits );
+	destination_statistics->number_of_path_hint_cache_misses    = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_path_hint_cache_misses );
+	destination_statistics->number_of_directories_read          = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_directories_read );
+	destination_statistics->number_of_directory_entries_read    = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_directory_entries_read );
+	destination_statistics->number_of_allocation_table_lookups  = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_allocation_table_lookups );
+	destination_statistics->number_of_extents                   = LIBFSFAT_STATISTICS_GET( source_statistics->number_of_extents );
+	destination_statistics->lock_wait_time                      = LIBFSFAT_STATISTICS_GET( source_statistics->lock_wait_time );
+	destination_statistics->allocation_table_decode_time        = LIBFSFAT_STATISTICS_GET( source_statistics->allocation_table_decode_time );
+
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+
+/* Grabs a read/write lock for reading
+ * The wait time is added to the statistics when LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_statistics_read_write_lock_grab_for_read(
+     libfsfat_statistics_t *statistics,
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_statistics_read_write_lock_grab_for_read";
+	uint64_t start_time   = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The flags are only changed while the volume is not open
+	 */
+	if( ( statistics->flags & LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) != 0 )
+	{
+		start_time = libfsfat_statistics_get_timestamp();
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( statistics->flags & LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) != 0 )
+	{
+		LIBFSFAT_STATISTICS_ADD(
+		 statistics->lock_wait_time,
+		 libfsfat_statistics_get_timestamp() - start_time );
+	}
+	return( 1 );
+}
+
+/* Grabs a read/write lock for writing
+ * The wait time is added to the statistics when LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_statistics_read_write_lock_grab_for_write(
+     libfsfat_statistics_t *statistics,
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsfat_statistics_read_write_lock_grab_for_write";
+	uint64_t start_time   = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The flags are only changed while the volume is not open
+	 */
+	if( ( statistics->flags & LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) != 0 )
+	{
+		start_time = libfsfat_statistics_get_timestamp();
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( statistics->flags & LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) != 0 )
+	{
+		LIBFSFAT_STATISTICS_ADD(
+		 statistics->lock_wait_time,
+		 libfsfat_statistics_get_timestamp() - start_time );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,89 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSFAT_STATISTICS_H )
+#define _LIBFSFAT_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsfat_libcerror.h"
+#include "libfsfat_libcthreads.h"
+#include "libfsfat_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The counters can be updated by multiple threads that share the read lock
+ * hence they are updated with relaxed atomic operations when available
+ */
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define LIBFSFAT_STATISTICS_ADD( counter, value ) \
+	(void) __atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define LIBFSFAT_STATISTICS_GET( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#elif defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT ) && defined( _MSC_VER )
+#define LIBFSFAT_STATISTICS_ADD( counter, value ) \
+	(void) InterlockedExchangeAdd64( (volatile LONG64 *) &( counter ), (LONG64) ( value ) )
+
+#define LIBFSFAT_STATISTICS_GET( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (volatile LONG64 *) &( counter ), 0, 0 )
+
+#else
+#define LIBFSFAT_STATISTICS_ADD( counter, value ) \
+	( counter ) += (uint64_t) ( value )
+
+#define LIBFSFAT_STATISTICS_GET( counter ) \
+	( counter )
+
+#endif
+
+uint64_t libfsfat_statistics_get_timestamp(
+          void );
+
+int libfsfat_statistics_copy(
+     libfsfat_statistics_t *destination_statistics,
+     libfsfat_statistics_t *source_statistics,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+
+int libfsfat_statistics_read_write_lock_grab_for_read(
+     libfsfat_statistics_t *statistics,
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
+int libfsfat_statistics_read_write_lock_grab_for_write(
+     libfsfat_statistics_t *statistics,
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSFAT_STATISTICS_H ) */
+
@@ -0,0 +1,105 @@
+/*
+ * Tracing probes
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSFAT_TRACE_H )
+#define _LIBFSFAT_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LIBFSFAT_USDT )
+#include <sys/sdt.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The probes are user-level statically defined tracing (USDT) probes
+ * of the libfsfat provider, for example usdt:libfsfat.so:libfsfat:directory__read__cluster
+ * can be attached to with bpftrace. A probe that is not attached to is a single nop
+ * instruction, hence the probes are available in non-debug builds.
+ *
+ * Every __done probe is fired on both the success and the error path and
+ * has the result, 1 if successful or -1 on error, as its first argument.
+ *
+ * The following probes are defined:
+ *   volume__open__start            volume size
+ *   volume__open__done             result, file system format, cluster block size, total number of clusters
+ *   allocation_table__read__start  allocation table offset, allocation table size
+ *   allocation_table__read__done   result, total number of clusters
+ *   directory__read__start         first cluster number
+ *   directory__read__cluster       cluster number, cluster offset, cluster block size
+ *   directory__read__range         directory offset, directory size
+ *   directory__read__done          result, first cluster number or 0, directory offset or 0
+ *   data_stream__get__start        first cluster number, data size
+ *   data_stream__get__done         result, data size
+ *   file_entry__read__start        identifier, offset or -1 for the current offset, buffer size
+ *   file_entry__read__done         result, identifier, read count or -1 on error
+ */
+#if defined( HAVE_LIBFSFAT_USDT )
+#define LIBFSFAT_TRACE_PROBE0( name ) \
+	DTRACE_PROBE( libfsfat, name )
+
+#define LIBFSFAT_TRACE_PROBE1( name, argument1 ) \
+	DTRACE_PROBE1( libfsfat, name, argument1 )
+
+#define LIBFSFAT_TRACE_PROBE2( name, argument1, argument2 ) \
+	DTRACE_PROBE2( libfsfat, name, argument1, argument2 )
+
+#define LIBFSFAT_TRACE_PROBE3( name, argument1, argument2, argument3 ) \
+	DTRACE_PROBE3( libfsfat, name, argument1, argument2, argument3 )
+
+#define LIBFSFAT_TRACE_PROBE4( name, argument1, argument2, argument3, argument4 ) \
+	DTRACE_PROBE4( libfsfat, name, argument1, argument2, argument3, argument4 )
+
+#else
+/* The arguments are cast to void so that values that are only passed
+ * to a probe do not trigger unused variable warnings
+ */
+#define LIBFSFAT_TRACE_PROBE0( name )
+
+#define LIBFSFAT_TRACE_PROBE1( name, argument1 ) \
+	(void) ( argument1 )
+
+#define LIBFSFAT_TRACE_PROBE2( name, argument1, argument2 ) \
+	(void) ( argument1 ); \
+	(void) ( argument2 )
+
+#define LIBFSFAT_TRACE_PROBE3( name, argument1, argument2, argument3 ) \
+	(void) ( argument1 ); \
+	(void) ( argument2 ); \
+	(void) ( argument3 )
+
+#define LIBFSFAT_TRACE_PROBE4( name, argument1, argument2, argument3, argument4 ) \
+	(void) ( argument1 ); \
+	(void) ( argument2 ); \
+	(void) ( argument3 ); \
+	(void) ( argument4 )
+
+#endif /* defined( HAVE_LIBFSFAT_USDT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSFAT_TRACE_H ) */
+
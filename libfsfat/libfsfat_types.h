@@ -43,6 +43,106 @@ typedef intptr_t libfsfat_volume_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The packed file entry record
+ * Used to retrieve the values of multiple sub file entries in one call
+ */
+typedef struct libfsfat_packed_file_entry libfsfat_packed_file_entry_t;
+
+struct libfsfat_packed_file_entry
+{
+	/* The (virtual) identifier
+	 */
+	uint64_t identifier;
+
+	/* The data size
+	 */
+	uint64_t size;
+
+	/* The creation, access and modification FAT timestamps
+	 */
+	uint64_t creation_time;
+	uint64_t access_time;
+	uint64_t modification_time;
+
+	/* The offset of the UTF-8 encoded name in the name pool
+	 */
+	uint32_t name_offset;
+
+	/* The size of the UTF-8 encoded name including the end of string character
+	 */
+	uint32_t name_size;
+
+	/* The data start cluster
+	 */
+	uint32_t data_start_cluster;
+
+	/* The file attribute flags
+	 */
+	uint16_t file_attribute_flags;
+};
+
+/* The volume statistics
+ * Used to retrieve the runtime counters of a volume
+ */
+typedef struct libfsfat_statistics libfsfat_statistics_t;
+
+struct libfsfat_statistics
+{
+	/* The size of the structure, which must be set by the caller
+	 * to sizeof( libfsfat_statistics_t )
+	 */
+	uint32_t size;
+
+	/* The statistics flags
+	 */
+	uint32_t flags;
+
+	/* The number of read calls issued to the file IO handle
+	 */
+	uint64_t number_of_read_calls;
+
+	/* The number of bytes read from the file IO handle
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of directory cache hits, misses and evictions
+	 */
+	uint64_t number_of_directory_cache_hits;
+	uint64_t number_of_directory_cache_misses;
+	uint64_t number_of_directory_cache_evictions;
+
+	/* The number of path hint cache hits and misses
+	 */
+	uint64_t number_of_path_hint_cache_hits;
+	uint64_t number_of_path_hint_cache_misses;
+
+	/* The number of directories read
+	 */
+	uint64_t number_of_directories_read;
+
+	/* The number of directory entries read
+	 */
+	uint64_t number_of_directory_entries_read;
+
+	/* The number of allocation table (FAT) lookups
+	 */
+	uint64_t number_of_allocation_table_lookups;
+
+	/* The number of data stream extents built
+	 */
+	uint64_t number_of_extents;
+
+	/* The time spent waiting for the read/write locks in nanoseconds
+	 * This value is only measured when LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME is set
+	 */
+	uint64_t lock_wait_time;
+
+	/* The time spent decoding the allocation table in nanoseconds
+	 * This value is only measured when LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME is set
+	 */
+	uint64_t allocation_table_decode_time;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFSFAT ) */
 
 /* The largest primary (or scalar) available
@@ -29,12 +29,17 @@
 #include "libfsfat_debug.h"
 #include "libfsfat_definitions.h"
 #include "libfsfat_file_entry.h"
+#include "libfsfat_index.h"
 #include "libfsfat_io_handle.h"
 #include "libfsfat_libcerror.h"
 #include "libfsfat_libcnotify.h"
 #include "libfsfat_libcthreads.h"
+#include "libfsfat_statistics.h"
+#include "libfsfat_trace.h"
 #include "libfsfat_volume.h"
 
+#include "fsfat_boot_record.h"
+
 /* Creates a volume
  * Make sure the value volume is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -205,6 +210,22 @@ int libfsfat_volume_free(
 			result = -1;
 		}
 #endif
+		if( internal_volume->index != NULL )
+		{
+			if( libfsfat_index_free(
+			     &( internal_volume->index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfsfat_io_handle_free(
 		     &( internal_volume->io_handle ),
 		     error ) != 1 )
@@ -385,7 +406,8 @@ int libfsfat_volume_open(
 		goto on_error;
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -554,7 +576,8 @@ int libfsfat_volume_open_wide(
 		goto on_error;
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -601,132 +624,101 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a volume using a Basic File IO (bfio) handle
+/* Reads a metadata index to be used by the next open
  * Returns 1 if successful or -1 on error
  */
-int libfsfat_volume_open_file_io_handle(
-     libfsfat_volume_t *volume,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+int libfsfat_internal_volume_read_index_file_io_handle(
+     libfsfat_internal_volume_t *internal_volume,
+     libbfio_handle_t *index_file_io_handle,
      libcerror_error_t **error )
 {
-	libfsfat_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsfat_volume_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library    = 0;
-	int bfio_access_flags                       = 0;
-	int file_io_handle_is_open                  = 0;
+	libfsfat_index_t *index    = NULL;
+	static char *function      = "libfsfat_internal_volume_read_index_file_io_handle";
+	int file_io_handle_is_open = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid internal volume.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsfat_internal_volume_t *) volume;
-
-	if( internal_volume->file_io_handle != NULL )
+	if( internal_volume->index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file IO handle already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( file_io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid internal volume - index value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSFAT_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSFAT_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( libfsfat_index_initialize(
+	     &index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( access_flags & LIBFSFAT_ACCESS_FLAG_WRITE ) != 0 )
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file IO handle.",
 		 function );
 
-		return( -1 );
-	}
-	if( ( access_flags & LIBFSFAT_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		goto on_error;
 	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+	file_io_handle_is_open = 1;
 
-	if( file_io_handle_is_open == -1 )
+	if( libfsfat_index_read_file_io_handle(
+	     index,
+	     index_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
-	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+	file_io_handle_is_open = 0;
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
-	}
-	if( libfsfat_internal_volume_open_read(
-	     internal_volume,
-	     file_io_handle,
-	     error ) != 1 )
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -740,8 +732,7 @@ int libfsfat_volume_open_file_io_handle(
 		goto on_error;
 	}
 #endif
-	internal_volume->file_io_handle                   = file_io_handle;
-	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_volume->index = index;
 
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -755,8 +746,7 @@ int libfsfat_volume_open_file_io_handle(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_volume->file_io_handle                   = NULL;
-		internal_volume->file_io_handle_opened_in_library = 0;
+		internal_volume->index = NULL;
 
 		goto on_error;
 	}
@@ -764,52 +754,72 @@ int libfsfat_volume_open_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	if( file_io_handle_is_open != 0 )
 	{
 		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		 index_file_io_handle,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		libfsfat_index_free(
+		 &index,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+/* Exports a metadata index of the directory data of the volume
+ * Returns 1 if successful or -1 on error
  */
-int libfsfat_volume_close(
-     libfsfat_volume_t *volume,
+int libfsfat_internal_volume_write_index_file_io_handle(
+     libfsfat_internal_volume_t *internal_volume,
+     libbfio_handle_t *index_file_io_handle,
      libcerror_error_t **error )
 {
-	libfsfat_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsfat_volume_close";
-	int result                                  = 0;
+	libfsfat_index_t *index    = NULL;
+	static char *function      = "libfsfat_internal_volume_write_index_file_io_handle";
+	int file_io_handle_is_open = 0;
+	int result                 = 1;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid internal volume.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsfat_internal_volume_t *) volume;
-
-	if( internal_volume->file_io_handle == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing file IO handle.",
+		 "%s: invalid internal volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
+	if( libfsfat_index_initialize(
+	     &index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -820,94 +830,34 @@ int libfsfat_volume_close(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
-	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_volume->file_io_handle_created_in_library != 0 )
-		{
-			if( libfsfat_debug_print_read_offsets(
-			     internal_volume->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-
-				result = -1;
-			}
-		}
+		goto on_error;
 	}
 #endif
-	if( internal_volume->file_io_handle_opened_in_library != 0 )
-	{
-		if( libbfio_handle_close(
-		     internal_volume->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_volume->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_volume->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_volume->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_volume->file_io_handle_created_in_library = 0;
-	}
-	internal_volume->file_io_handle = NULL;
-
-	if( libfsfat_io_handle_clear(
-	     internal_volume->io_handle,
-	     error ) != 1 )
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing file system.",
 		 function );
 
 		result = -1;
 	}
-	if( internal_volume->file_system != NULL )
+	else if( libfsfat_file_system_export_index(
+	          internal_volume->file_system,
+	          internal_volume->file_io_handle,
+	          index,
+	          error ) != 1 )
 	{
-		if( libfsfat_file_system_free(
-		     &( internal_volume->file_system ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file system.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to export index.",
+		 function );
 
-			result = -1;
-		}
+		result = -1;
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -921,39 +871,920 @@ int libfsfat_volume_close(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	return( result );
-}
-
-/* Opens a volume for reading
- * Returns 1 if successful or -1 on error
- */
-int libfsfat_internal_volume_open_read(
-     libfsfat_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	libfsfat_boot_record_t *boot_record = NULL;
-	static char *function               = "libfsfat_internal_volume_open_read";
-
-	if( internal_volume == NULL )
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->io_handle == NULL )
+	file_io_handle_is_open = 1;
+
+	if( libfsfat_index_write_file_io_handle(
+	     index,
+	     index_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_index_free(
+	     &index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		libfsfat_index_free(
+		 &index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a volume using a metadata index
+ * The index must have been exported from the same volume, this is checked
+ * with checksums of the boot record and the allocation table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_open_with_index(
+     libfsfat_volume_t *volume,
+     const char *filename,
+     const char *index_filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle      = NULL;
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_open_with_index";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     narrow_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_internal_volume_read_index_file_io_handle(
+	     internal_volume,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_volume_open(
+	     volume,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->index != NULL )
+	{
+		libfsfat_index_free(
+		 &( internal_volume->index ),
+		 NULL );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a metadata index of the directory data of the volume
+ * The index contains the cluster data of the directories, not decoded directory entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_export_index(
+     libfsfat_volume_t *volume,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle      = NULL;
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_export_index";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     narrow_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_internal_volume_write_index_file_io_handle(
+	     internal_volume,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a volume using a metadata index
+ * The index must have been exported from the same volume, this is checked
+ * with checksums of the boot record and the allocation table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_open_with_index_wide(
+     libfsfat_volume_t *volume,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle      = NULL;
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_open_with_index_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     wide_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_internal_volume_read_index_file_io_handle(
+	     internal_volume,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index: %ls.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_volume_open_wide(
+	     volume,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->index != NULL )
+	{
+		libfsfat_index_free(
+		 &( internal_volume->index ),
+		 NULL );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a metadata index of the directory data of the volume
+ * The index contains the cluster data of the directories, not decoded directory entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_export_index_wide(
+     libfsfat_volume_t *volume,
+     const wchar_t *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle      = NULL;
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_export_index_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     wide_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_internal_volume_write_index_file_io_handle(
+	     internal_volume,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index: %ls.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a volume using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_open_file_io_handle(
+     libfsfat_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library    = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_handle_is_open                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSFAT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSFAT_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSFAT_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSFAT_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfsfat_internal_volume_open_read(
+	     internal_volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_volume->file_io_handle                   = file_io_handle;
+	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_volume->file_io_handle                   = NULL;
+		internal_volume->file_io_handle_opened_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
+ */
+int libfsfat_volume_close(
+     libfsfat_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_close";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_volume->file_io_handle_created_in_library != 0 )
+		{
+			if( libfsfat_debug_print_read_offsets(
+			     internal_volume->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
+	}
+	internal_volume->file_io_handle = NULL;
+
+	if( libfsfat_io_handle_clear(
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsfat_file_system_free(
+		     &( internal_volume->file_system ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_internal_volume_open_read(
+     libfsfat_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsfat_boot_record_t *boot_record = NULL;
+	static char *function               = "libfsfat_internal_volume_open_read";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: invalid internal volume - missing IO handle.",
 		 function );
@@ -983,8 +1814,12 @@ int libfsfat_internal_volume_open_read(
 		 "%s: unable to retrieve file size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	LIBFSFAT_TRACE_PROBE1(
+	 volume__open__start,
+	 internal_volume->io_handle->volume_size );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1021,11 +1856,20 @@ int libfsfat_internal_volume_open_read(
 
 		goto on_error;
 	}
+	LIBFSFAT_STATISTICS_ADD(
+	 internal_volume->io_handle->statistics.number_of_read_calls,
+	 1 );
+
+	LIBFSFAT_STATISTICS_ADD(
+	 internal_volume->io_handle->statistics.number_of_bytes_read,
+	 sizeof( fsfat_boot_record_fat12_t ) );
+
 	internal_volume->io_handle->file_system_format       = boot_record->file_system_format;
 	internal_volume->io_handle->bytes_per_sector         = boot_record->bytes_per_sector;
 	internal_volume->io_handle->cluster_block_size       = boot_record->cluster_block_size;
 	internal_volume->io_handle->total_number_of_clusters = boot_record->total_number_of_clusters;
 	internal_volume->io_handle->first_cluster_offset     = boot_record->first_cluster_offset;
+	internal_volume->io_handle->boot_record_checksum     = boot_record->checksum;
 
 	if( boot_record->root_directory_size > 0 )
 	{
@@ -1073,6 +1917,24 @@ int libfsfat_internal_volume_open_read(
 
 		goto on_error;
 	}
+	if( internal_volume->index != NULL )
+	{
+		if( libfsfat_file_system_set_index(
+		     internal_volume->file_system,
+		     internal_volume->index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->index = NULL;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1111,34 +1973,233 @@ int libfsfat_internal_volume_open_read(
 
 		goto on_error;
 	}
+	LIBFSFAT_TRACE_PROBE4(
+	 volume__open__done,
+	 1,
+	 internal_volume->io_handle->file_system_format,
+	 internal_volume->io_handle->cluster_block_size,
+	 internal_volume->io_handle->total_number_of_clusters );
+
 	return( 1 );
 
 on_error:
+	LIBFSFAT_TRACE_PROBE4(
+	 volume__open__done,
+	 -1,
+	 internal_volume->io_handle->file_system_format,
+	 internal_volume->io_handle->cluster_block_size,
+	 internal_volume->io_handle->total_number_of_clusters );
+
 	if( internal_volume->file_system != NULL )
 	{
-		libfsfat_file_system_free(
-		 &( internal_volume->file_system ),
-		 NULL );
+		libfsfat_file_system_free(
+		 &( internal_volume->file_system ),
+		 NULL );
+	}
+	if( boot_record != NULL )
+	{
+		libfsfat_boot_record_free(
+		 &boot_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file system format
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_get_file_system_format(
+     libfsfat_volume_t *volume,
+     uint8_t *file_system_format,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_get_file_system_format";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system format.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_volume->io_handle->statistics ),
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_system_format = internal_volume->io_handle->file_system_format;
+
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the statistics flags
+ * The flags can only be set while the volume is not open and are retained when the volume is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsfat_volume_set_statistics_flags(
+     libfsfat_volume_t *volume,
+     uint32_t statistics_flags,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_set_statistics_flags";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( statistics_flags & ~( LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics flags: 0x%08" PRIx32 ".",
+		 function,
+		 statistics_flags );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The flags are read without the lock while the volume is open
+	 */
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_volume->io_handle->statistics.flags = statistics_flags;
 	}
-	if( boot_record != NULL )
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		libfsfat_boot_record_free(
-		 &boot_record,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the file system format
+/* Retrieves the statistics
+ * The size value of the statistics must be set to sizeof( libfsfat_statistics_t )
+ * The statistics are reset when the volume is closed
  * Returns 1 if successful or -1 on error
  */
-int libfsfat_volume_get_file_system_format(
+int libfsfat_volume_get_statistics(
      libfsfat_volume_t *volume,
-     uint8_t *file_system_format,
+     libfsfat_statistics_t *statistics,
      libcerror_error_t **error )
 {
 	libfsfat_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsfat_volume_get_file_system_format";
+	static char *function                       = "libfsfat_volume_get_statistics";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -1164,19 +2225,35 @@ int libfsfat_volume_get_file_system_format(
 
 		return( -1 );
 	}
-	if( file_system_format == NULL )
+	if( statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system format.",
+		 "%s: invalid statistics.",
 		 function );
 
 		return( -1 );
 	}
+	/* The size allows the structure to be extended, a caller built against
+	 * a newer version passes a larger size and receives the values known to this version
+	 */
+	if( statistics->size < (uint32_t) sizeof( libfsfat_statistics_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics size: %" PRIu32 ".",
+		 function,
+		 statistics->size );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1190,8 +2267,22 @@ int libfsfat_volume_get_file_system_format(
 		return( -1 );
 	}
 #endif
-	*file_system_format = internal_volume->io_handle->file_system_format;
+	/* The counters are updated by readers that share the read lock
+	 */
+	if( libfsfat_statistics_copy(
+	     statistics,
+	     &( internal_volume->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy statistics.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -1207,7 +2298,7 @@ int libfsfat_volume_get_file_system_format(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the size of the UTF-8 encoded label
@@ -1248,7 +2339,8 @@ int libfsfat_volume_get_utf8_label_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1333,7 +2425,8 @@ int libfsfat_volume_get_utf8_label(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1418,7 +2511,8 @@ int libfsfat_volume_get_utf16_label_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1503,7 +2597,8 @@ int libfsfat_volume_get_utf16_label(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libfsfat_statistics_read_write_lock_grab_for_read(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1609,7 +2704,8 @@ int libfsfat_volume_get_root_directory(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1709,7 +2805,218 @@ int libfsfat_volume_get_file_entry_by_identifier(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsfat_file_system_get_file_entry_by_identifier(
+	     internal_volume->file_system,
+	     internal_volume->file_io_handle,
+	     identifier,
+	     file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsfat_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsfat_volume_get_file_entry_by_utf8_path(
+     libfsfat_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsfat_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_get_file_entry_by_utf8_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsfat_file_system_get_file_entry_by_utf8_path(
+	          internal_volume->file_system,
+	          internal_volume->file_io_handle,
+	          utf8_string,
+	          utf8_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsfat_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsfat_volume_get_file_entry_by_utf16_path(
+     libfsfat_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsfat_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsfat_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsfat_volume_get_file_entry_by_utf16_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsfat_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
+	if( libfsfat_statistics_read_write_lock_grab_for_write(
+	     &( internal_volume->io_handle->statistics ),
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1723,20 +3030,22 @@ int libfsfat_volume_get_file_entry_by_identifier(
 		return( -1 );
 	}
 #endif
-	if( libfsfat_file_system_get_file_entry_by_identifier(
-	     internal_volume->file_system,
-	     internal_volume->file_io_handle,
-	     identifier,
-	     file_entry,
-	     error ) != 1 )
+	result = libfsfat_file_system_get_file_entry_by_utf16_path(
+	          internal_volume->file_system,
+	          internal_volume->file_io_handle,
+	          utf16_string,
+	          utf16_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier: %" PRIu64 ".",
-		 function,
-		 identifier );
+		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
+		 function );
 
 		result = -1;
 	}
@@ -1762,21 +3071,35 @@ int libfsfat_volume_get_file_entry_by_identifier(
 	return( result );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Walks the sub file entries of a specific file entry
+ * The walk uses an explicit stack of the directories being walked instead of recursion
+ * Sub file entries at LIBFSFAT_MAXIMUM_RECURSION_DEPTH are passed to the callback function
+ * but their sub file entries are not walked
+ * Returns 1 if successful, 0 if the walk was stopped or -1 on error
  */
-int libfsfat_volume_get_file_entry_by_utf8_path(
-     libfsfat_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsfat_file_entry_t **file_entry,
+int libfsfat_internal_volume_walk_sub_file_entries(
+     libfsfat_internal_volume_t *internal_volume,
+     libfsfat_internal_file_entry_t *internal_file_entry,
+     int depth,
+     int (*callback_function)(
+            libfsfat_file_entry_t *file_entry,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfsfat_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsfat_volume_get_file_entry_by_utf8_path";
-	int result                                  = 0;
+	libfsfat_file_entry_t **file_entries              = NULL;
+	libfsfat_file_entry_t *sub_file_entry             = NULL;
+	libfsfat_internal_file_entry_t *parent_file_entry = NULL;
+	static char *function                             = "libfsfat_internal_volume_walk_sub_file_entries";
+	int *number_of_sub_file_entries                   = NULL;
+	int *sub_file_entry_indexes                       = NULL;
+	int maximum_number_of_frames                      = 0;
+	int result                                        = 1;
+	int stack_index                                   = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1787,9 +3110,18 @@ int libfsfat_volume_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	internal_volume = (libfsfat_internal_volume_t *) volume;
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
 
-	if( file_entry == NULL )
+		return( -1 );
+	}
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1800,85 +3132,312 @@ int libfsfat_volume_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( ( depth < 0 )
+	 || ( depth > LIBFSFAT_MAXIMUM_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfsfat_file_system_get_file_entry_by_utf8_path(
-	          internal_volume->file_system,
-	          internal_volume->file_io_handle,
-	          utf8_string,
-	          utf8_string_length,
-	          file_entry,
-	          error );
+	/* The first frame contains the file entry itself, every next frame
+	 * a sub directory one level deeper
+	 */
+	maximum_number_of_frames = LIBFSFAT_MAXIMUM_RECURSION_DEPTH - depth + 1;
 
-	if( result == -1 )
+	file_entries = (libfsfat_file_entry_t **) memory_allocate(
+	                                           sizeof( libfsfat_file_entry_t * ) * maximum_number_of_frames );
+
+	if( file_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file entries stack.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	number_of_sub_file_entries = (int *) memory_allocate(
+	                                      sizeof( int ) * maximum_number_of_frames );
+
+	if( number_of_sub_file_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create number of sub file entries stack.",
+		 function );
+
+		goto on_error;
+	}
+	sub_file_entry_indexes = (int *) memory_allocate(
+	                                  sizeof( int ) * maximum_number_of_frames );
+
+	if( sub_file_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub file entry indexes stack.",
 		 function );
 
+		goto on_error;
+	}
+	/* The file entry in the first frame is owned by the caller
+	 */
+	file_entries[ 0 ]               = (libfsfat_file_entry_t *) internal_file_entry;
+	number_of_sub_file_entries[ 0 ] = -1;
+	sub_file_entry_indexes[ 0 ]     = 0;
+
+	while( stack_index >= 0 )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			break;
+		}
+		parent_file_entry = (libfsfat_internal_file_entry_t *) file_entries[ stack_index ];
+
+		if( number_of_sub_file_entries[ stack_index ] == -1 )
+		{
+			number_of_sub_file_entries[ stack_index ] = 0;
+
+			if( ( parent_file_entry->directory == NULL )
+			 && ( ( parent_file_entry->file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) != 0 ) )
+			{
+				if( libfsfat_internal_file_entry_get_directory(
+				     parent_file_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( parent_file_entry->directory != NULL )
+			{
+				if( libfsfat_directory_get_number_of_file_entries(
+				     parent_file_entry->directory,
+				     &( number_of_sub_file_entries[ stack_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of file entries from directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( sub_file_entry_indexes[ stack_index ] >= number_of_sub_file_entries[ stack_index ] )
+		{
+			if( stack_index > 0 )
+			{
+				if( libfsfat_file_entry_free(
+				     &( file_entries[ stack_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free sub directory at depth: %d.",
+					 function,
+					 depth + stack_index - 1 );
+
+					goto on_error;
+				}
+			}
+			stack_index--;
+
+			continue;
+		}
+		if( libfsfat_internal_file_entry_get_sub_file_entry_by_index(
+		     parent_file_entry,
+		     sub_file_entry_indexes[ stack_index ],
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d at depth: %d.",
+			 function,
+			 sub_file_entry_indexes[ stack_index ],
+			 depth + stack_index );
+
+			goto on_error;
+		}
+		sub_file_entry_indexes[ stack_index ] += 1;
+
+		result = callback_function(
+		          sub_file_entry,
+		          depth + stack_index,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for sub file entry: %d at depth: %d.",
+			 function,
+			 sub_file_entry_indexes[ stack_index ] - 1,
+			 depth + stack_index );
+
+			goto on_error;
+		}
+		/* The sub file entries of a file entry at the maximum depth are skipped
+		 * so that a directory loop in a corrupted volume ends the branch rather than the walk
+		 */
+		if( ( result != 0 )
+		 && ( ( stack_index + 1 ) < maximum_number_of_frames ) )
+		{
+			stack_index++;
+
+			file_entries[ stack_index ]               = sub_file_entry;
+			number_of_sub_file_entries[ stack_index ] = -1;
+			sub_file_entry_indexes[ stack_index ]     = 0;
+
+			sub_file_entry = NULL;
+
+			continue;
+		}
+		if( libfsfat_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d at depth: %d.",
+			 function,
+			 sub_file_entry_indexes[ stack_index ] - 1,
+			 depth + stack_index );
+
+			goto on_error;
+		}
+	}
+	if( internal_volume->io_handle->abort != 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		result = 1;
+	}
+	while( stack_index > 0 )
+	{
+		if( libfsfat_file_entry_free(
+		     &( file_entries[ stack_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub directory at depth: %d.",
+			 function,
+			 depth + stack_index - 1 );
+
+			goto on_error;
+		}
+		stack_index--;
+	}
+	memory_free(
+	 sub_file_entry_indexes );
+
+	memory_free(
+	 number_of_sub_file_entries );
+
+	memory_free(
+	 file_entries );
+
+	return( result );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
 		libfsfat_file_entry_free(
-		 file_entry,
+		 &sub_file_entry,
 		 NULL );
+	}
+	if( file_entries != NULL )
+	{
+		while( stack_index > 0 )
+		{
+			libfsfat_file_entry_free(
+			 &( file_entries[ stack_index ] ),
+			 NULL );
 
-		return( -1 );
+			stack_index--;
+		}
+		memory_free(
+		 file_entries );
 	}
-#endif
-	return( result );
+	if( sub_file_entry_indexes != NULL )
+	{
+		memory_free(
+		 sub_file_entry_indexes );
+	}
+	if( number_of_sub_file_entries != NULL )
+	{
+		memory_free(
+		 number_of_sub_file_entries );
+	}
+	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Walks the directory hierarchy of the volume
+ * The callback function is called for every file entry, directories before their sub file entries
+ * The file entry passed to the callback function is only valid during the callback
+ * The callback function should return 1 to walk the sub file entries, 0 to skip them or -1 on error
+ * The sub file entries of file entries at LIBFSFAT_MAXIMUM_RECURSION_DEPTH are not walked
+ * Returns 1 if successful, 0 if the walk was aborted or -1 on error
  */
-int libfsfat_volume_get_file_entry_by_utf16_path(
+int libfsfat_volume_walk(
      libfsfat_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsfat_file_entry_t **file_entry,
+     int (*callback_function)(
+            libfsfat_file_entry_t *file_entry,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
+	libfsfat_file_entry_t *root_directory       = NULL;
 	libfsfat_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsfat_volume_get_file_entry_by_utf16_path";
+	static char *function                       = "libfsfat_volume_walk";
 	int result                                  = 0;
 
 	if( volume == NULL )
@@ -1894,49 +3453,35 @@ int libfsfat_volume_get_file_entry_by_utf16_path(
 	}
 	internal_volume = (libfsfat_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
+	if( libfsfat_volume_get_root_directory(
+	     volume,
+	     &root_directory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	result = libfsfat_file_system_get_file_entry_by_utf16_path(
-	          internal_volume->file_system,
-	          internal_volume->file_io_handle,
-	          utf16_string,
-	          utf16_string_length,
-	          file_entry,
+	result = callback_function(
+	          root_directory,
+	          0,
+	          callback_data,
 	          error );
 
 	if( result == -1 )
@@ -1944,31 +3489,65 @@ int libfsfat_volume_get_file_entry_by_utf16_path(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback failed for root directory.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	else if( result != 0 )
+	{
+		/* The sub file entries are walked without holding the volume lock
+		 * the same as for sub file entries retrieved from a file entry
+		 * The walk is single-threaded, sibling directories are not parsed in parallel
+		 * since every directory read goes through the same file IO handle
+		 */
+		result = libfsfat_internal_volume_walk_sub_file_entries(
+		          internal_volume,
+		          (libfsfat_internal_file_entry_t *) root_directory,
+		          1,
+		          callback_function,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk root directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = 1;
+	}
+	if( libfsfat_file_entry_free(
+	     &root_directory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory.",
 		 function );
 
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( root_directory != NULL )
+	{
 		libfsfat_file_entry_free(
-		 file_entry,
+		 &root_directory,
 		 NULL );
-
-		return( -1 );
 	}
-#endif
-	return( result );
+	return( -1 );
 }
 
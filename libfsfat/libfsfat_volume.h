@@ -26,7 +26,9 @@
 #include <types.h>
 
 #include "libfsfat_extern.h"
+#include "libfsfat_file_entry.h"
 #include "libfsfat_file_system.h"
+#include "libfsfat_index.h"
 #include "libfsfat_io_handle.h"
 #include "libfsfat_libbfio.h"
 #include "libfsfat_libcerror.h"
@@ -61,6 +63,10 @@ struct libfsfat_internal_volume
 	 */
 	libfsfat_file_system_t *file_system;
 
+	/* The metadata index to be used by the next open
+	 */
+	libfsfat_index_t *index;
+
 #if defined( HAVE_LIBFSFAT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -101,6 +107,48 @@ int libfsfat_volume_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libfsfat_internal_volume_read_index_file_io_handle(
+     libfsfat_internal_volume_t *internal_volume,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libfsfat_internal_volume_write_index_file_io_handle(
+     libfsfat_internal_volume_t *internal_volume,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_open_with_index(
+     libfsfat_volume_t *volume,
+     const char *filename,
+     const char *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_export_index(
+     libfsfat_volume_t *volume,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_open_with_index_wide(
+     libfsfat_volume_t *volume,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_export_index_wide(
+     libfsfat_volume_t *volume,
+     const wchar_t *index_filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBFSFAT_EXTERN \
 int libfsfat_volume_open_file_io_handle(
      libfsfat_volume_t *volume,
@@ -124,6 +172,18 @@ int libfsfat_volume_get_file_system_format(
      uint8_t *file_system_format,
      libcerror_error_t **error );
 
+LIBFSFAT_EXTERN \
+int libfsfat_volume_set_statistics_flags(
+     libfsfat_volume_t *volume,
+     uint32_t statistics_flags,
+     libcerror_error_t **error );
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_get_statistics(
+     libfsfat_volume_t *volume,
+     libfsfat_statistics_t *statistics,
+     libcerror_error_t **error );
+
 LIBFSFAT_EXTERN \
 int libfsfat_volume_get_utf8_label_size(
      libfsfat_volume_t *volume,
@@ -179,6 +239,29 @@ int libfsfat_volume_get_file_entry_by_utf16_path(
      libfsfat_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsfat_internal_volume_walk_sub_file_entries(
+     libfsfat_internal_volume_t *internal_volume,
+     libfsfat_internal_file_entry_t *internal_file_entry,
+     int depth,
+     int (*callback_function)(
+            libfsfat_file_entry_t *file_entry,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_walk(
+     libfsfat_volume_t *volume,
+     int (*callback_function)(
+            libfsfat_file_entry_t *file_entry,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
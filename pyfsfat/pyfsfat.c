@@ -40,6 +40,7 @@
 #include "pyfsfat_python.h"
 #include "pyfsfat_unused.h"
 #include "pyfsfat_volume.h"
+#include "pyfsfat_walk.h"
 
 #if !defined( LIBFSFAT_HAVE_BFIO )
 
@@ -84,7 +85,7 @@ PyMethodDef pyfsfat_module_methods[] = {
 	{ "open_file_object",
 	  (PyCFunction) pyfsfat_open_new_volume_with_file_object,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open_file_object(file_object, mode='r') -> Object\n"
+	  "open_file_object(file_object, mode='r', read_ahead_size=0) -> Object\n"
 	  "\n"
 	  "Opens a volume using a file-like object." },
 
@@ -360,6 +361,7 @@ PyObject *pyfsfat_check_volume_signature_file_object(
 	if( pyfsfat_file_object_initialize(
 	     &file_io_handle,
 	     file_object,
+	     0,
 	     &error ) != 1 )
 	{
 		pyfsfat_error_raise(
@@ -602,6 +604,15 @@ PyMODINIT_FUNC initpyfsfat(
 		return;
 #endif
 	}
+#if defined( Py_GIL_DISABLED )
+	/* The module does not rely on the GIL: reads of libfsfat objects are guarded
+	 * by the libfsfat locks, and opening and closing the volume, the file object
+	 * IO handle, the walk and the file entries iterator have their own lock
+	 */
+	PyUnstable_Module_SetGIL(
+	 module,
+	 Py_MOD_GIL_NOT_USED );
+#endif
 #if PY_VERSION_HEX < 0x03070000
 	PyEval_InitThreads();
 #endif
@@ -685,6 +696,23 @@ PyMODINIT_FUNC initpyfsfat(
 	 "file_entry",
 	 (PyObject *) &pyfsfat_file_entry_type_object );
 
+	/* Setup the walk type object
+	 */
+	pyfsfat_walk_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsfat_walk_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsfat_walk_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "walk",
+	 (PyObject *) &pyfsfat_walk_type_object );
+
 	/* Setup the volume type object
 	 */
 	pyfsfat_volume_type_object.tp_new = PyType_GenericNew;
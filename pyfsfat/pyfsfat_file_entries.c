@@ -196,11 +196,25 @@ PyObject *pyfsfat_file_entries_new(
 
 		goto on_error;
 	}
-	sequence_object->parent_object     = parent_object;
+	sequence_object->parent_object     = NULL;
+	sequence_object->lock              = NULL;
 	sequence_object->get_item_by_index = get_item_by_index;
 	sequence_object->current_index     = 0;
 	sequence_object->number_of_items   = number_of_items;
 
+	sequence_object->lock = PyThread_allocate_lock();
+
+	if( sequence_object->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create lock.",
+		 function );
+
+		goto on_error;
+	}
+	sequence_object->parent_object = parent_object;
+
 	Py_IncRef(
 	 (PyObject *) sequence_object->parent_object );
 
@@ -235,6 +249,7 @@ int pyfsfat_file_entries_init(
 	/* Make sure the file entries values are initialized
 	 */
 	sequence_object->parent_object     = NULL;
+	sequence_object->lock              = NULL;
 	sequence_object->get_item_by_index = NULL;
 	sequence_object->current_index     = 0;
 	sequence_object->number_of_items   = 0;
@@ -285,6 +300,11 @@ void pyfsfat_file_entries_free(
 
 		return;
 	}
+	if( sequence_object->lock != NULL )
+	{
+		PyThread_free_lock(
+		 sequence_object->lock );
+	}
 	if( sequence_object->parent_object != NULL )
 	{
 		Py_DecRef(
@@ -432,21 +452,36 @@ PyObject *pyfsfat_file_entries_iternext(
 
 		return( NULL );
 	}
+	/* The lock is only grabbed while the GIL is released, so that a thread
+	 * that waits for the lock does not block the thread that holds it
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 sequence_object->lock,
+	 WAIT_LOCK );
+
+	Py_END_ALLOW_THREADS
+
 	if( sequence_object->current_index >= sequence_object->number_of_items )
 	{
 		PyErr_SetNone(
 		 PyExc_StopIteration );
-
-		return( NULL );
 	}
-	file_entry_object = sequence_object->get_item_by_index(
-	                     sequence_object->parent_object,
-	                     sequence_object->current_index );
-
-	if( file_entry_object != NULL )
+	else
 	{
-		sequence_object->current_index++;
+		file_entry_object = sequence_object->get_item_by_index(
+		                     sequence_object->parent_object,
+		                     sequence_object->current_index );
+
+		if( file_entry_object != NULL )
+		{
+			sequence_object->current_index++;
+		}
 	}
+	PyThread_release_lock(
+	 sequence_object->lock );
+
 	return( file_entry_object );
 }
 
@@ -44,6 +44,10 @@ struct pyfsfat_file_entries
 	 */
 	PyObject *parent_object;
 
+	/* The lock that serializes advancing the current index
+	 */
+	PyThread_type_lock lock;
+
 	/* The get item by index callback function
 	 */
 	PyObject* (*get_item_by_index)(
@@ -158,6 +158,21 @@ PyMethodDef pyfsfat_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at the current offset." },
 
+	{ "readinto",
+	  (PyCFunction) pyfsfat_file_entry_readinto,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads data at the current offset into a writable buffer object, such as\n"
+	  "a bytearray or memoryview, and returns the number of bytes read." },
+
+	{ "readable",
+	  (PyCFunction) pyfsfat_file_entry_readable,
+	  METH_NOARGS,
+	  "readable() -> Boolean\n"
+	  "\n"
+	  "Determines if the data can be read." },
+
 	{ "seek",
 	  (PyCFunction) pyfsfat_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -165,6 +180,13 @@ PyMethodDef pyfsfat_file_entry_object_methods[] = {
 	  "\n"
 	  "Seeks an offset within the data." },
 
+	{ "seekable",
+	  (PyCFunction) pyfsfat_file_entry_seekable,
+	  METH_NOARGS,
+	  "seekable() -> Boolean\n"
+	  "\n"
+	  "Determines if the data is seekable." },
+
 	{ "tell",
 	  (PyCFunction) pyfsfat_file_entry_get_offset,
 	  METH_NOARGS,
@@ -172,6 +194,28 @@ PyMethodDef pyfsfat_file_entry_object_methods[] = {
 	  "\n"
 	  "Retrieves the current offset of the data." },
 
+	{ "writable",
+	  (PyCFunction) pyfsfat_file_entry_writable,
+	  METH_NOARGS,
+	  "writable() -> Boolean\n"
+	  "\n"
+	  "Determines if the data can be written." },
+
+	{ "close",
+	  (PyCFunction) pyfsfat_file_entry_close,
+	  METH_NOARGS,
+	  "close() -> None\n"
+	  "\n"
+	  "Closes the data stream. The file entry is owned by the volume, so this\n"
+	  "does nothing." },
+
+	{ "flush",
+	  (PyCFunction) pyfsfat_file_entry_flush,
+	  METH_NOARGS,
+	  "flush() -> None\n"
+	  "\n"
+	  "Flushes the data stream. The data is read-only, so this does nothing." },
+
 	{ "get_size",
 	  (PyCFunction) pyfsfat_file_entry_get_size,
 	  METH_NOARGS,
@@ -260,6 +304,12 @@ PyGetSetDef pyfsfat_file_entry_object_get_set_definitions[] = {
 	  "The number of extents of the data.",
 	  NULL },
 
+	{ "closed",
+	  (getter) pyfsfat_file_entry_get_closed,
+	  (setter) 0,
+	  "Value to indicate the data stream is closed, which is always False.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -1836,6 +1886,250 @@ PyObject *pyfsfat_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data at the current offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_readinto(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer_view;
+
+	PyObject *buffer_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsfat_file_entry_readinto";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &buffer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer_view,
+	     PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS ) != 0 )
+	{
+		return( NULL );
+	}
+	if( (size_t) buffer_view.len > (size_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer_view );
+
+		return( NULL );
+	}
+	/* The data is read directly into the memory of the buffer object
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsfat_file_entry_read_buffer(
+	              pyfsfat_file_entry->file_entry,
+	              (uint8_t *) buffer_view.buf,
+	              (size_t) buffer_view.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer_view );
+
+	if( read_count == -1 )
+	{
+		pyfsfat_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyfsfat_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
+/* Determines if the data can be read
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_readable(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsfat_file_entry_readable";
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_True );
+
+	return( Py_True );
+}
+
+/* Determines if the data is seekable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_seekable(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsfat_file_entry_seekable";
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_True );
+
+	return( Py_True );
+}
+
+/* Determines if the data can be written
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_writable(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsfat_file_entry_writable";
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
+/* Closes the data stream
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_close(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsfat_file_entry_close";
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	/* The file entry is freed when the Python object is released, not when
+	 * the stream is closed, so that io.BufferedReader can close it safely
+	 */
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Flushes the data stream
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_flush(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsfat_file_entry_flush";
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Determines if the data stream is closed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_file_entry_get_closed(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsfat_file_entry_get_closed";
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -130,6 +130,35 @@ PyObject *pyfsfat_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsfat_file_entry_readinto(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsfat_file_entry_readable(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsfat_file_entry_seekable(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsfat_file_entry_writable(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsfat_file_entry_close(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsfat_file_entry_flush(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsfat_file_entry_get_closed(
+           pyfsfat_file_entry_t *pyfsfat_file_entry,
+           PyObject *arguments );
+
 PyObject *pyfsfat_file_entry_seek_offset(
            pyfsfat_file_entry_t *pyfsfat_file_entry,
            PyObject *arguments,
@@ -102,8 +102,36 @@ int pyfsfat_file_object_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *file_object_io_handle )->file_object = file_object;
+	( *file_object_io_handle )->lock = PyThread_allocate_lock();
 
+	if( ( *file_object_io_handle )->lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create lock.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_object_io_handle )->file_object        = file_object;
+	( *file_object_io_handle )->file_object_offset = -1;
+	( *file_object_io_handle )->cache_block_size   = PYFSFAT_FILE_OBJECT_IO_HANDLE_DEFAULT_CACHE_BLOCK_SIZE;
+
+	if( pyfsfat_file_object_io_handle_invalidate_cache(
+	     *file_object_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate cache.",
+		 function );
+
+		goto on_error;
+	}
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
 
@@ -112,6 +140,11 @@ int pyfsfat_file_object_io_handle_initialize(
 on_error:
 	if( *file_object_io_handle != NULL )
 	{
+		if( ( *file_object_io_handle )->lock != NULL )
+		{
+			PyThread_free_lock(
+			 ( *file_object_io_handle )->lock );
+		}
 		PyMem_Free(
 		 *file_object_io_handle );
 
@@ -121,11 +154,13 @@ on_error:
 }
 
 /* Initializes the file object IO handle
+ * A cache block size of 0 represents the default cache block size
  * Returns 1 if successful or -1 on error
  */
 int pyfsfat_file_object_initialize(
      libbfio_handle_t **handle,
      PyObject *file_object,
+     size_t cache_block_size,
      libcerror_error_t **error )
 {
 	pyfsfat_file_object_io_handle_t *file_object_io_handle = NULL;
@@ -167,6 +202,23 @@ int pyfsfat_file_object_initialize(
 
 		goto on_error;
 	}
+	if( cache_block_size != 0 )
+	{
+		if( pyfsfat_file_object_io_handle_set_cache_block_size(
+		     file_object_io_handle,
+		     cache_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache block size.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libbfio_handle_initialize(
 	     handle,
 	     (intptr_t *) file_object_io_handle,
@@ -232,6 +284,16 @@ int pyfsfat_file_object_io_handle_free(
 		Py_DecRef(
 		 ( *file_object_io_handle )->file_object );
 
+		if( ( *file_object_io_handle )->cache_data != NULL )
+		{
+			PyMem_Free(
+			 ( *file_object_io_handle )->cache_data );
+		}
+		if( ( *file_object_io_handle )->lock != NULL )
+		{
+			PyThread_free_lock(
+			 ( *file_object_io_handle )->lock );
+		}
 		PyMem_Free(
 		 *file_object_io_handle );
 
@@ -306,6 +368,106 @@ int pyfsfat_file_object_io_handle_clone(
 
 		return( -1 );
 	}
+	( *destination_file_object_io_handle )->cache_block_size = source_file_object_io_handle->cache_block_size;
+
+	return( 1 );
+}
+
+/* Sets the cache block size
+ * Every cache miss reads a full block from the file object, so this also sets the read-ahead size
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsfat_file_object_io_handle_set_cache_block_size(
+     pyfsfat_file_object_io_handle_t *file_object_io_handle,
+     size_t cache_block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "pyfsfat_file_object_io_handle_set_cache_block_size";
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_block_size < PYFSFAT_FILE_OBJECT_IO_HANDLE_MINIMUM_CACHE_BLOCK_SIZE )
+	 || ( cache_block_size > PYFSFAT_FILE_OBJECT_IO_HANDLE_MAXIMUM_CACHE_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_block_size != file_object_io_handle->cache_block_size )
+	{
+		/* The cache data is reallocated on the next read
+		 */
+		if( file_object_io_handle->cache_data != NULL )
+		{
+			PyMem_Free(
+			 file_object_io_handle->cache_data );
+
+			file_object_io_handle->cache_data = NULL;
+		}
+		file_object_io_handle->cache_block_size = cache_block_size;
+	}
+	if( pyfsfat_file_object_io_handle_invalidate_cache(
+	     file_object_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Invalidates the cache blocks
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsfat_file_object_io_handle_invalidate_cache(
+     pyfsfat_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "pyfsfat_file_object_io_handle_invalidate_cache";
+	int cache_block_index = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_block_index = 0;
+	     cache_block_index < PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS;
+	     cache_block_index++ )
+	{
+		file_object_io_handle->cache_block_offsets[ cache_block_index ]      = -1;
+		file_object_io_handle->cache_block_data_sizes[ cache_block_index ]   = 0;
+		file_object_io_handle->cache_block_access_times[ cache_block_index ] = 0;
+	}
+	file_object_io_handle->cache_access_time = 0;
+
 	return( 1 );
 }
 
@@ -366,7 +528,32 @@ int pyfsfat_file_object_io_handle_open(
 	}
 	/* No need to do anything here, because the file object is already open
 	 */
-	file_object_io_handle->access_flags = access_flags;
+	PyThread_acquire_lock(
+	 file_object_io_handle->lock,
+	 WAIT_LOCK );
+
+	if( pyfsfat_file_object_io_handle_invalidate_cache(
+	     file_object_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate cache.",
+		 function );
+
+		PyThread_release_lock(
+		 file_object_io_handle->lock );
+
+		return( -1 );
+	}
+	file_object_io_handle->access_flags       = access_flags;
+	file_object_io_handle->current_offset     = 0;
+	file_object_io_handle->file_object_offset = -1;
+
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
 
 	return( 1 );
 }
@@ -404,7 +591,31 @@ int pyfsfat_file_object_io_handle_close(
 	}
 	/* Do not close the file object, have Python deal with it
 	 */
-	file_object_io_handle->access_flags = 0;
+	PyThread_acquire_lock(
+	 file_object_io_handle->lock,
+	 WAIT_LOCK );
+
+	if( pyfsfat_file_object_io_handle_invalidate_cache(
+	     file_object_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate cache.",
+		 function );
+
+		PyThread_release_lock(
+		 file_object_io_handle->lock );
+
+		return( -1 );
+	}
+	file_object_io_handle->access_flags       = 0;
+	file_object_io_handle->file_object_offset = -1;
+
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
 
 	return( 0 );
 }
@@ -613,7 +824,248 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a buffer at a specific offset from the file object
+ * Make sure to hold the GIL state before calling this function
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pyfsfat_file_object_io_handle_read_at_offset(
+         pyfsfat_file_object_io_handle_t *file_object_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "pyfsfat_file_object_io_handle_read_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only seek the file object if it is not already positioned at the offset
+	 */
+	if( file_object_io_handle->file_object_offset != offset )
+	{
+		file_object_io_handle->file_object_offset = -1;
+
+		if( pyfsfat_file_object_seek_offset(
+		     file_object_io_handle->file_object,
+		     offset,
+		     SEEK_SET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file object.",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		file_object_io_handle->file_object_offset = offset;
+	}
+	/* The read of the file object can return less data than requested
+	 * before the end of the data is reached
+	 */
+	while( buffer_offset < size )
+	{
+		read_count = pyfsfat_file_object_read_buffer(
+		              file_object_io_handle->file_object,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			file_object_io_handle->file_object_offset = -1;
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset                             += (size_t) read_count;
+		file_object_io_handle->file_object_offset += (off64_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Retrieves the cache block that contains a specific offset
+ * The cache block is read from the file object if it is not cached,
+ * the least recently used cache block is reused
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsfat_file_object_io_handle_get_cache_block(
+     pyfsfat_file_object_io_handle_t *file_object_io_handle,
+     off64_t offset,
+     int *cache_block_index,
+     libcerror_error_t **error )
+{
+	static char *function         = "pyfsfat_file_object_io_handle_get_cache_block";
+	off64_t cache_block_offset    = 0;
+	ssize_t read_count            = 0;
+	int least_recently_used_index = 0;
+	int safe_cache_block_index    = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache block index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_object_io_handle->cache_data == NULL )
+	{
+		file_object_io_handle->cache_data = (uint8_t *) PyMem_Malloc(
+		                                                 file_object_io_handle->cache_block_size * PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS );
+
+		if( file_object_io_handle->cache_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	cache_block_offset = offset - ( offset % (off64_t) file_object_io_handle->cache_block_size );
+
+	for( safe_cache_block_index = 0;
+	     safe_cache_block_index < PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS;
+	     safe_cache_block_index++ )
+	{
+		if( file_object_io_handle->cache_block_offsets[ safe_cache_block_index ] == cache_block_offset )
+		{
+			break;
+		}
+		if( file_object_io_handle->cache_block_access_times[ safe_cache_block_index ] < file_object_io_handle->cache_block_access_times[ least_recently_used_index ] )
+		{
+			least_recently_used_index = safe_cache_block_index;
+		}
+	}
+	if( safe_cache_block_index >= PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS )
+	{
+		safe_cache_block_index = least_recently_used_index;
+
+		file_object_io_handle->cache_block_offsets[ safe_cache_block_index ]    = -1;
+		file_object_io_handle->cache_block_data_sizes[ safe_cache_block_index ] = 0;
+
+		read_count = pyfsfat_file_object_io_handle_read_at_offset(
+		              file_object_io_handle,
+		              cache_block_offset,
+		              &( file_object_io_handle->cache_data[ safe_cache_block_index * file_object_io_handle->cache_block_size ] ),
+		              file_object_io_handle->cache_block_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read cache block at offset: %" PRIi64 " (0x%08" PRIx64 ") from file object.",
+			 function,
+			 cache_block_offset,
+			 cache_block_offset );
+
+			return( -1 );
+		}
+		file_object_io_handle->cache_block_offsets[ safe_cache_block_index ]    = cache_block_offset;
+		file_object_io_handle->cache_block_data_sizes[ safe_cache_block_index ] = (size_t) read_count;
+	}
+	file_object_io_handle->cache_access_time += 1;
+
+	file_object_io_handle->cache_block_access_times[ safe_cache_block_index ] = file_object_io_handle->cache_access_time;
+
+	*cache_block_index = safe_cache_block_index;
+
+	return( 1 );
+}
+
 /* Reads a buffer from the file object IO handle
+ * Reads smaller than the cache block size are served from the cache blocks
  * Returns the number of bytes read if successful, or -1 on error
  */
 ssize_t pyfsfat_file_object_io_handle_read(
@@ -624,7 +1076,11 @@ ssize_t pyfsfat_file_object_io_handle_read(
 {
 	static char *function      = "pyfsfat_file_object_io_handle_read";
 	PyGILState_STATE gil_state = 0;
+	size_t buffer_offset       = 0;
+	size_t cache_block_offset  = 0;
+	size_t read_size           = 0;
 	ssize_t read_count         = 0;
+	int cache_block_index      = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -637,34 +1093,122 @@ ssize_t pyfsfat_file_object_io_handle_read(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	read_count = pyfsfat_file_object_read_buffer(
-	              file_object_io_handle->file_object,
-	              buffer,
-	              size,
-	              error );
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	PyThread_acquire_lock(
+	 file_object_io_handle->lock,
+	 WAIT_LOCK );
+
+	gil_state = PyGILState_Ensure();
+
+	while( buffer_offset < size )
+	{
+		read_size = size - buffer_offset;
+
+		/* Reads of at least the cache block size bypass the cache
+		 */
+		if( read_size >= file_object_io_handle->cache_block_size )
+		{
+			read_count = pyfsfat_file_object_io_handle_read_at_offset(
+			              file_object_io_handle,
+			              file_object_io_handle->current_offset,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file object.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset                         += (size_t) read_count;
+			file_object_io_handle->current_offset += (off64_t) read_count;
+
+			break;
+		}
+		if( pyfsfat_file_object_io_handle_get_cache_block(
+		     file_object_io_handle,
+		     file_object_io_handle->current_offset,
+		     &cache_block_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache block.",
+			 function );
+
+			goto on_error;
+		}
+		cache_block_offset = (size_t) ( file_object_io_handle->current_offset - file_object_io_handle->cache_block_offsets[ cache_block_index ] );
+
+		if( cache_block_offset >= file_object_io_handle->cache_block_data_sizes[ cache_block_index ] )
+		{
+			break;
+		}
+		if( read_size > ( file_object_io_handle->cache_block_data_sizes[ cache_block_index ] - cache_block_offset ) )
+		{
+			read_size = file_object_io_handle->cache_block_data_sizes[ cache_block_index ] - cache_block_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( file_object_io_handle->cache_data[ ( cache_block_index * file_object_io_handle->cache_block_size ) + cache_block_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cache block data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset                         += read_size;
+		file_object_io_handle->current_offset += (off64_t) read_size;
 	}
 	PyGILState_Release(
 	 gil_state );
 
-	return( read_count );
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
+
+	return( (ssize_t) buffer_offset );
 
 on_error:
 	PyGILState_Release(
 	 gil_state );
 
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
+
 	return( -1 );
 }
 
@@ -822,8 +1366,46 @@ ssize_t pyfsfat_file_object_io_handle_write(
 
 		return( -1 );
 	}
+	PyThread_acquire_lock(
+	 file_object_io_handle->lock,
+	 WAIT_LOCK );
+
 	gil_state = PyGILState_Ensure();
 
+	if( pyfsfat_file_object_io_handle_invalidate_cache(
+	     file_object_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_object_io_handle->file_object_offset != file_object_io_handle->current_offset )
+	{
+		file_object_io_handle->file_object_offset = -1;
+
+		if( pyfsfat_file_object_seek_offset(
+		     file_object_io_handle->file_object,
+		     file_object_io_handle->current_offset,
+		     SEEK_SET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek in file object.",
+			 function );
+
+			goto on_error;
+		}
+		file_object_io_handle->file_object_offset = file_object_io_handle->current_offset;
+	}
 	write_count = pyfsfat_file_object_write_buffer(
 	               file_object_io_handle->file_object,
 	               buffer,
@@ -839,17 +1421,27 @@ ssize_t pyfsfat_file_object_io_handle_write(
 		 "%s: unable to write from file object.",
 		 function );
 
+		file_object_io_handle->file_object_offset = -1;
+
 		goto on_error;
 	}
+	file_object_io_handle->current_offset     += (off64_t) write_count;
+	file_object_io_handle->file_object_offset += (off64_t) write_count;
 	PyGILState_Release(
 	 gil_state );
 
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
+
 	return( write_count );
 
 on_error:
 	PyGILState_Release(
 	 gil_state );
 
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
+
 	return( -1 );
 }
 
@@ -1130,6 +1722,7 @@ on_error:
 }
 
 /* Seeks a certain offset within the file object IO handle
+ * Only seeking relative to the end of the data requires calling the file object
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t pyfsfat_file_object_io_handle_seek_offset(
@@ -1152,45 +1745,94 @@ off64_t pyfsfat_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	if( pyfsfat_file_object_seek_offset(
-	     file_object_io_handle->file_object,
-	     offset,
-	     whence,
-	     error ) != 1 )
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( pyfsfat_file_object_get_offset(
-	     file_object_io_handle->file_object,
-	     &offset,
-	     error ) != 1 )
+	PyThread_acquire_lock(
+	 file_object_io_handle->lock,
+	 WAIT_LOCK );
+
+	if( whence == SEEK_END )
+	{
+		gil_state = PyGILState_Ensure();
+
+		file_object_io_handle->file_object_offset = -1;
+
+		if( pyfsfat_file_object_seek_offset(
+		     file_object_io_handle->file_object,
+		     offset,
+		     whence,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek in file object.",
+			 function );
+
+			PyGILState_Release(
+			 gil_state );
+
+			goto on_error;
+		}
+		if( pyfsfat_file_object_get_offset(
+		     file_object_io_handle->file_object,
+		     &offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to retrieve current offset in file object.",
+			 function );
+
+			PyGILState_Release(
+			 gil_state );
+
+			goto on_error;
+		}
+		file_object_io_handle->file_object_offset = offset;
+
+		PyGILState_Release(
+		 gil_state );
+	}
+	else if( whence == SEEK_CUR )
+	{
+		offset += file_object_io_handle->current_offset;
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve current offset in file object.",
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	PyGILState_Release(
-	 gil_state );
+	file_object_io_handle->current_offset = offset;
+
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
 
 	return( offset );
 
 on_error:
-	PyGILState_Release(
-	 gil_state );
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
 
 	return( -1 );
 }
@@ -1401,6 +2043,10 @@ int pyfsfat_file_object_io_handle_get_size(
 
 		return( -1 );
 	}
+	PyThread_acquire_lock(
+	 file_object_io_handle->lock,
+	 WAIT_LOCK );
+
 	gil_state = PyGILState_Ensure();
 
 #if PY_MAJOR_VERSION >= 3
@@ -1508,6 +2154,9 @@ int pyfsfat_file_object_io_handle_get_size(
 	PyGILState_Release(
 	 gil_state );
 
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
+
 	return( 1 );
 
 on_error:
@@ -1519,6 +2168,9 @@ on_error:
 	PyGILState_Release(
 	 gil_state );
 
+	PyThread_release_lock(
+	 file_object_io_handle->lock );
+
 	return( 1 );
 }
 
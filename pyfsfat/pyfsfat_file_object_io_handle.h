@@ -33,6 +33,17 @@
 extern "C" {
 #endif
 
+/* The number of blocks in the read cache
+ */
+#define PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS		16
+
+/* The default, minimum and maximum read cache block size
+ * Every cache miss reads a full block, so this is also the read-ahead size
+ */
+#define PYFSFAT_FILE_OBJECT_IO_HANDLE_DEFAULT_CACHE_BLOCK_SIZE		( 256 * 1024 )
+#define PYFSFAT_FILE_OBJECT_IO_HANDLE_MINIMUM_CACHE_BLOCK_SIZE		512
+#define PYFSFAT_FILE_OBJECT_IO_HANDLE_MAXIMUM_CACHE_BLOCK_SIZE		( 16 * 1024 * 1024 )
+
 typedef struct pyfsfat_file_object_io_handle pyfsfat_file_object_io_handle_t;
 
 struct pyfsfat_file_object_io_handle
@@ -44,6 +55,42 @@ struct pyfsfat_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The lock that serializes access to the offsets and the cache
+	 */
+	PyThread_type_lock lock;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The offset of the python file object or -1 if not known
+	 */
+	off64_t file_object_offset;
+
+	/* The cache block size
+	 */
+	size_t cache_block_size;
+
+	/* The cache data
+	 */
+	uint8_t *cache_data;
+
+	/* The offsets of the cache blocks or -1 if not set
+	 */
+	off64_t cache_block_offsets[ PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS ];
+
+	/* The data sizes of the cache blocks
+	 */
+	size_t cache_block_data_sizes[ PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS ];
+
+	/* The access times of the cache blocks, used to determine the least recently used block
+	 */
+	uint64_t cache_block_access_times[ PYFSFAT_FILE_OBJECT_IO_HANDLE_NUMBER_OF_CACHE_BLOCKS ];
+
+	/* The cache access time
+	 */
+	uint64_t cache_access_time;
 };
 
 int pyfsfat_file_object_io_handle_initialize(
@@ -54,6 +101,7 @@ int pyfsfat_file_object_io_handle_initialize(
 int pyfsfat_file_object_initialize(
      libbfio_handle_t **handle,
      PyObject *file_object,
+     size_t cache_block_size,
      libcerror_error_t **error );
 
 int pyfsfat_file_object_io_handle_free(
@@ -65,6 +113,15 @@ int pyfsfat_file_object_io_handle_clone(
      pyfsfat_file_object_io_handle_t *source_file_object_io_handle,
      libcerror_error_t **error );
 
+int pyfsfat_file_object_io_handle_set_cache_block_size(
+     pyfsfat_file_object_io_handle_t *file_object_io_handle,
+     size_t cache_block_size,
+     libcerror_error_t **error );
+
+int pyfsfat_file_object_io_handle_invalidate_cache(
+     pyfsfat_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error );
+
 int pyfsfat_file_object_io_handle_open(
      pyfsfat_file_object_io_handle_t *file_object_io_handle,
      int access_flags,
@@ -80,6 +137,19 @@ ssize_t pyfsfat_file_object_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t pyfsfat_file_object_io_handle_read_at_offset(
+         pyfsfat_file_object_io_handle_t *file_object_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+int pyfsfat_file_object_io_handle_get_cache_block(
+     pyfsfat_file_object_io_handle_t *file_object_io_handle,
+     off64_t offset,
+     int *cache_block_index,
+     libcerror_error_t **error );
+
 ssize_t pyfsfat_file_object_io_handle_read(
          pyfsfat_file_object_io_handle_t *file_object_io_handle,
          uint8_t *buffer,
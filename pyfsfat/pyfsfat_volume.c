@@ -37,6 +37,7 @@
 #include "pyfsfat_python.h"
 #include "pyfsfat_unused.h"
 #include "pyfsfat_volume.h"
+#include "pyfsfat_walk.h"
 
 #if !defined( LIBFSFAT_HAVE_BFIO )
 
@@ -68,9 +69,12 @@ PyMethodDef pyfsfat_volume_object_methods[] = {
 	{ "open_file_object",
 	  (PyCFunction) pyfsfat_volume_open_file_object,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open_file_object(file_object, mode='r') -> None\n"
+	  "open_file_object(file_object, mode='r', read_ahead_size=0) -> None\n"
 	  "\n"
-	  "Opens a volume using a file-like object." },
+	  "Opens a volume using a file-like object.\n"
+	  "\n"
+	  "Reads from the file-like object are cached in blocks of read_ahead_size\n"
+	  "bytes, where 0 represents the default of 256 KiB." },
 
 	{ "close",
 	  (PyCFunction) pyfsfat_volume_close,
@@ -114,6 +118,16 @@ PyMethodDef pyfsfat_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the file entry for an UTF-8 encoded path specified by the path." },
 
+	{ "walk",
+	  (PyCFunction) pyfsfat_volume_walk,
+	  METH_NOARGS,
+	  "walk() -> Object\n"
+	  "\n"
+	  "Walks the file entries of the volume, directories before their sub file entries.\n"
+	  "Yields a tuple of path, identifier, size, file attribute flags, creation time,\n"
+	  "access time and modification time per file entry, where the times are FAT timestamps.\n"
+	  "The sub file entries of directories at a depth of 256 are not walked." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -259,7 +273,19 @@ int pyfsfat_volume_init(
 	 */
 	pyfsfat_volume->volume         = NULL;
 	pyfsfat_volume->file_io_handle = NULL;
+	pyfsfat_volume->lock           = NULL;
+
+	pyfsfat_volume->lock = PyThread_allocate_lock();
+
+	if( pyfsfat_volume->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create lock.",
+		 function );
 
+		return( -1 );
+	}
 	if( libfsfat_volume_initialize(
 	     &( pyfsfat_volume->volume ),
 	     &error ) != 1 )
@@ -349,6 +375,11 @@ void pyfsfat_volume_free(
 			 &error );
 		}
 	}
+	if( pyfsfat_volume->lock != NULL )
+	{
+		PyThread_free_lock(
+		 pyfsfat_volume->lock );
+	}
 	ob_type->tp_free(
 	 (PyObject*) pyfsfat_volume );
 }
@@ -489,12 +520,19 @@ PyObject *pyfsfat_volume_open(
 #endif
 		Py_BEGIN_ALLOW_THREADS
 
+		PyThread_acquire_lock(
+		 pyfsfat_volume->lock,
+		 WAIT_LOCK );
+
 		result = libfsfat_volume_open_wide(
 		          pyfsfat_volume->volume,
 		          filename_wide,
 		          LIBFSFAT_OPEN_READ,
 		          &error );
 
+		PyThread_release_lock(
+		 pyfsfat_volume->lock );
+
 		Py_END_ALLOW_THREADS
 
 #if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
@@ -523,12 +561,19 @@ PyObject *pyfsfat_volume_open(
 #endif
 		Py_BEGIN_ALLOW_THREADS
 
+		PyThread_acquire_lock(
+		 pyfsfat_volume->lock,
+		 WAIT_LOCK );
+
 		result = libfsfat_volume_open(
 		          pyfsfat_volume->volume,
 		          filename_narrow,
 		          LIBFSFAT_OPEN_READ,
 		          &error );
 
+		PyThread_release_lock(
+		 pyfsfat_volume->lock );
+
 		Py_END_ALLOW_THREADS
 
 		Py_DecRef(
@@ -585,12 +630,19 @@ PyObject *pyfsfat_volume_open(
 #endif
 		Py_BEGIN_ALLOW_THREADS
 
+		PyThread_acquire_lock(
+		 pyfsfat_volume->lock,
+		 WAIT_LOCK );
+
 		result = libfsfat_volume_open(
 		          pyfsfat_volume->volume,
 		          filename_narrow,
 		          LIBFSFAT_OPEN_READ,
 		          &error );
 
+		PyThread_release_lock(
+		 pyfsfat_volume->lock );
+
 		Py_END_ALLOW_THREADS
 
 		if( result != 1 )
@@ -630,8 +682,9 @@ PyObject *pyfsfat_volume_open_file_object(
 	PyObject *file_object       = NULL;
 	libcerror_error_t *error    = NULL;
 	static char *function       = "pyfsfat_volume_open_file_object";
-	static char *keyword_list[] = { "file_object", "mode", NULL };
+	static char *keyword_list[] = { "file_object", "mode", "read_ahead_size", NULL };
 	char *mode                  = NULL;
+	Py_ssize_t read_ahead_size  = 0;
 	int result                  = 0;
 
 	if( pyfsfat_volume == NULL )
@@ -646,10 +699,11 @@ PyObject *pyfsfat_volume_open_file_object(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "O|s",
+	     "O|sn",
 	     keyword_list,
 	     &file_object,
-	     &mode ) == 0 )
+	     &mode,
+	     &read_ahead_size ) == 0 )
 	{
 		return( NULL );
 	}
@@ -664,6 +718,17 @@ PyObject *pyfsfat_volume_open_file_object(
 
 		return( NULL );
 	}
+	if( ( read_ahead_size != 0 )
+	 && ( ( read_ahead_size < (Py_ssize_t) PYFSFAT_FILE_OBJECT_IO_HANDLE_MINIMUM_CACHE_BLOCK_SIZE )
+	  || ( read_ahead_size > (Py_ssize_t) PYFSFAT_FILE_OBJECT_IO_HANDLE_MAXIMUM_CACHE_BLOCK_SIZE ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read-ahead size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
 	PyErr_Clear();
 
 	result = PyObject_HasAttrString(
@@ -694,6 +759,17 @@ PyObject *pyfsfat_volume_open_file_object(
 
 		return( NULL );
 	}
+	/* The lock is only grabbed while the GIL is released, so that a thread
+	 * that waits for the lock does not block the thread that holds it
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsfat_volume->lock,
+	 WAIT_LOCK );
+
+	Py_END_ALLOW_THREADS
+
 	if( pyfsfat_volume->file_io_handle != NULL )
 	{
 		pyfsfat_error_raise(
@@ -702,11 +778,15 @@ PyObject *pyfsfat_volume_open_file_object(
 		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
+		PyThread_release_lock(
+		 pyfsfat_volume->lock );
+
 		return( NULL );
 	}
 	if( pyfsfat_file_object_initialize(
 	     &( pyfsfat_volume->file_io_handle ),
 	     file_object,
+	     (size_t) read_ahead_size,
 	     &error ) != 1 )
 	{
 		pyfsfat_error_raise(
@@ -743,6 +823,9 @@ PyObject *pyfsfat_volume_open_file_object(
 
 		goto on_error;
 	}
+	PyThread_release_lock(
+	 pyfsfat_volume->lock );
+
 	Py_IncRef(
 	 Py_None );
 
@@ -755,6 +838,9 @@ on_error:
 		 &( pyfsfat_volume->file_io_handle ),
 		 NULL );
 	}
+	PyThread_release_lock(
+	 pyfsfat_volume->lock );
+
 	return( NULL );
 }
 
@@ -767,6 +853,7 @@ PyObject *pyfsfat_volume_close(
 {
 	libcerror_error_t *error = NULL;
 	static char *function    = "pyfsfat_volume_close";
+	int free_result          = 1;
 	int result               = 0;
 
 	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
@@ -780,12 +867,29 @@ PyObject *pyfsfat_volume_close(
 
 		return( NULL );
 	}
+	/* The lock is held while the GIL is released, so that a concurrent open
+	 * does not set the file IO handle while it is being freed
+	 */
 	Py_BEGIN_ALLOW_THREADS
 
+	PyThread_acquire_lock(
+	 pyfsfat_volume->lock,
+	 WAIT_LOCK );
+
 	result = libfsfat_volume_close(
 	          pyfsfat_volume->volume,
 	          &error );
 
+	if( ( result == 0 )
+	 && ( pyfsfat_volume->file_io_handle != NULL ) )
+	{
+		free_result = libbfio_handle_free(
+		               &( pyfsfat_volume->file_io_handle ),
+		               &error );
+	}
+	PyThread_release_lock(
+	 pyfsfat_volume->lock );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 0 )
@@ -801,29 +905,18 @@ PyObject *pyfsfat_volume_close(
 
 		return( NULL );
 	}
-	if( pyfsfat_volume->file_io_handle != NULL )
+	if( free_result != 1 )
 	{
-		Py_BEGIN_ALLOW_THREADS
-
-		result = libbfio_handle_free(
-		          &( pyfsfat_volume->file_io_handle ),
-		          &error );
-
-		Py_END_ALLOW_THREADS
-
-		if( result != 1 )
-		{
-			pyfsfat_error_raise(
-			 error,
-			 PyExc_MemoryError,
-			 "%s: unable to free libbfio file IO handle.",
-			 function );
+		pyfsfat_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free libbfio file IO handle.",
+		 function );
 
-			libcerror_error_free(
-			 &error );
+		libcerror_error_free(
+		 &error );
 
-			return( NULL );
-		}
+		return( NULL );
 	}
 	Py_IncRef(
 	 Py_None );
@@ -1277,3 +1370,69 @@ on_error:
 	return( NULL );
 }
 
+/* Walks the file entries of the volume
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_volume_walk(
+           pyfsfat_volume_t *pyfsfat_volume,
+           PyObject *arguments PYFSFAT_ATTRIBUTE_UNUSED )
+{
+	PyObject *walk_object                 = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsfat_file_entry_t *root_directory = NULL;
+	static char *function                 = "pyfsfat_volume_walk";
+	int result                            = 0;
+
+	PYFSFAT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsfat_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsfat_volume_get_root_directory(
+	          pyfsfat_volume->volume,
+	          &root_directory,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsfat_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve root directory file entry.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	walk_object = pyfsfat_walk_new(
+	               (PyObject *) pyfsfat_volume,
+	               root_directory );
+
+	if( walk_object == NULL )
+	{
+		goto on_error;
+	}
+	return( walk_object );
+
+on_error:
+	if( root_directory != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( NULL );
+}
+
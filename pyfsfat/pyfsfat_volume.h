@@ -48,6 +48,10 @@ struct pyfsfat_volume
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
+
+	/* The lock that serializes opening and closing the volume
+	 */
+	PyThread_type_lock lock;
 };
 
 extern PyMethodDef pyfsfat_volume_object_methods[];
@@ -99,6 +103,10 @@ PyObject *pyfsfat_volume_get_file_entry_by_path(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsfat_volume_walk(
+           pyfsfat_volume_t *pyfsfat_volume,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
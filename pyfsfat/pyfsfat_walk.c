@@ -0,0 +1,904 @@
+/*
+ * Python object definition of the iterator object of a volume walk
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsfat_error.h"
+#include "pyfsfat_integer.h"
+#include "pyfsfat_libcerror.h"
+#include "pyfsfat_libfsfat.h"
+#include "pyfsfat_python.h"
+#include "pyfsfat_walk.h"
+
+PyTypeObject pyfsfat_walk_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsfat.walk",
+	/* tp_basicsize */
+	sizeof( pyfsfat_walk_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsfat_walk_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyfsfat iterator object of a volume walk",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyfsfat_walk_iter,
+	/* tp_iternext */
+	(iternextfunc) pyfsfat_walk_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsfat_walk_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new walk iterator object
+ * The walk takes over the management of the root directory file entry if successful
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsfat_walk_new(
+           PyObject *parent_object,
+           libfsfat_file_entry_t *root_directory )
+{
+	pyfsfat_walk_t *pyfsfat_walk = NULL;
+	static char *function        = "pyfsfat_walk_new";
+
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( root_directory == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid root directory.",
+		 function );
+
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyfsfat_walk = PyObject_New(
+	                struct pyfsfat_walk,
+	                &pyfsfat_walk_type_object );
+
+	if( pyfsfat_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create walk.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsfat_walk->parent_object         = NULL;
+	pyfsfat_walk->lock                  = NULL;
+	pyfsfat_walk->directories           = NULL;
+	pyfsfat_walk->number_of_directories = 0;
+	pyfsfat_walk->number_of_records     = 0;
+	pyfsfat_walk->current_record_index  = 0;
+	pyfsfat_walk->records               = NULL;
+	pyfsfat_walk->path_pool             = NULL;
+	pyfsfat_walk->path                  = NULL;
+
+	pyfsfat_walk->lock = PyThread_allocate_lock();
+
+	if( pyfsfat_walk->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create lock.",
+		 function );
+
+		goto on_error;
+	}
+
+	/* The buffers are allocated up front since the records are read
+	 * while the GIL is released
+	 */
+	pyfsfat_walk->directories = (pyfsfat_walk_directory_t *) PyMem_Malloc(
+	                                                          sizeof( pyfsfat_walk_directory_t ) * PYFSFAT_WALK_MAXIMUM_DEPTH );
+
+	if( pyfsfat_walk->directories == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create directories.",
+		 function );
+
+		goto on_error;
+	}
+	/* The packed sub file entries and name pool of a directory are allocated
+	 * when the directory is first read
+	 */
+	if( memory_set(
+	     pyfsfat_walk->directories,
+	     0,
+	     sizeof( pyfsfat_walk_directory_t ) * PYFSFAT_WALK_MAXIMUM_DEPTH ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear directories.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsfat_walk->path = (uint8_t *) PyMem_Malloc(
+	                                  sizeof( uint8_t ) * PYFSFAT_WALK_MAXIMUM_DEPTH * PYFSFAT_WALK_MAXIMUM_NAME_SIZE );
+
+	if( pyfsfat_walk->path == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsfat_walk->records = (pyfsfat_walk_record_t *) PyMem_Malloc(
+	                                                   sizeof( pyfsfat_walk_record_t ) * PYFSFAT_WALK_MAXIMUM_NUMBER_OF_RECORDS );
+
+	if( pyfsfat_walk->records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create records.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsfat_walk->path_pool = (uint8_t *) PyMem_Malloc(
+	                                       sizeof( uint8_t ) * PYFSFAT_WALK_PATH_POOL_SIZE );
+
+	if( pyfsfat_walk->path_pool == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create path pool.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsfat_walk->directories[ 0 ].file_entry = root_directory;
+
+	pyfsfat_walk->number_of_directories = 1;
+
+	pyfsfat_walk->parent_object = parent_object;
+
+	Py_IncRef(
+	 pyfsfat_walk->parent_object );
+
+	return( (PyObject *) pyfsfat_walk );
+
+on_error:
+	if( pyfsfat_walk != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsfat_walk );
+	}
+	return( NULL );
+}
+
+/* Initializes a walk iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsfat_walk_init(
+     pyfsfat_walk_t *pyfsfat_walk )
+{
+	static char *function = "pyfsfat_walk_init";
+
+	if( pyfsfat_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the walk values are initialized
+	 */
+	pyfsfat_walk->parent_object         = NULL;
+	pyfsfat_walk->lock                  = NULL;
+	pyfsfat_walk->directories           = NULL;
+	pyfsfat_walk->number_of_directories = 0;
+	pyfsfat_walk->path                  = NULL;
+	pyfsfat_walk->records               = NULL;
+	pyfsfat_walk->number_of_records     = 0;
+	pyfsfat_walk->current_record_index  = 0;
+	pyfsfat_walk->path_pool             = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of walk not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a walk iterator object
+ */
+void pyfsfat_walk_free(
+      pyfsfat_walk_t *pyfsfat_walk )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsfat_walk_free";
+	int directory_index         = 0;
+	int result                  = 0;
+
+	if( pyfsfat_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsfat_walk );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsfat_walk->directories != NULL )
+	{
+		while( pyfsfat_walk->number_of_directories > 0 )
+		{
+			pyfsfat_walk->number_of_directories -= 1;
+
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libfsfat_file_entry_free(
+			          &( pyfsfat_walk->directories[ pyfsfat_walk->number_of_directories ].file_entry ),
+			          &error );
+
+			Py_END_ALLOW_THREADS
+
+			if( result != 1 )
+			{
+				pyfsfat_error_raise(
+				 error,
+				 PyExc_MemoryError,
+				 "%s: unable to free libfsfat file entry.",
+				 function );
+
+				libcerror_error_free(
+				 &error );
+			}
+		}
+		for( directory_index = 0;
+		     directory_index < PYFSFAT_WALK_MAXIMUM_DEPTH;
+		     directory_index++ )
+		{
+			if( pyfsfat_walk->directories[ directory_index ].packed_file_entries != NULL )
+			{
+				memory_free(
+				 pyfsfat_walk->directories[ directory_index ].packed_file_entries );
+			}
+			if( pyfsfat_walk->directories[ directory_index ].name_pool != NULL )
+			{
+				memory_free(
+				 pyfsfat_walk->directories[ directory_index ].name_pool );
+			}
+		}
+		PyMem_Free(
+		 pyfsfat_walk->directories );
+	}
+	if( pyfsfat_walk->path != NULL )
+	{
+		PyMem_Free(
+		 pyfsfat_walk->path );
+	}
+	if( pyfsfat_walk->records != NULL )
+	{
+		PyMem_Free(
+		 pyfsfat_walk->records );
+	}
+	if( pyfsfat_walk->path_pool != NULL )
+	{
+		PyMem_Free(
+		 pyfsfat_walk->path_pool );
+	}
+	if( pyfsfat_walk->lock != NULL )
+	{
+		PyThread_free_lock(
+		 pyfsfat_walk->lock );
+	}
+	if( pyfsfat_walk->parent_object != NULL )
+	{
+		Py_DecRef(
+		 pyfsfat_walk->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsfat_walk );
+}
+
+/* Reads the next batch of records
+ * Directories are walked depth first, a directory record precedes the records of its sub file entries
+ * The sub file entries of directories at PYFSFAT_WALK_MAXIMUM_DEPTH are not walked
+ * This function does not call the Python API and is called with the GIL released
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int pyfsfat_walk_read_records(
+     pyfsfat_walk_t *pyfsfat_walk,
+     libcerror_error_t **error )
+{
+	libfsfat_file_entry_t *sub_file_entry           = NULL;
+	libfsfat_packed_file_entry_t *packed_file_entry = NULL;
+	pyfsfat_walk_directory_t *directory             = NULL;
+	pyfsfat_walk_directory_t *sub_directory         = NULL;
+	pyfsfat_walk_record_t *record                   = NULL;
+	static char *function                           = "pyfsfat_walk_read_records";
+	size_t name_length                              = 0;
+	size_t path_pool_offset                         = 0;
+	int sub_file_entry_index                        = 0;
+
+	if( pyfsfat_walk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walk.",
+		 function );
+
+		return( -1 );
+	}
+	pyfsfat_walk->number_of_records    = 0;
+	pyfsfat_walk->current_record_index = 0;
+
+	while( ( pyfsfat_walk->number_of_directories > 0 )
+	    && ( pyfsfat_walk->number_of_records < PYFSFAT_WALK_MAXIMUM_NUMBER_OF_RECORDS ) )
+	{
+		directory = &( pyfsfat_walk->directories[ pyfsfat_walk->number_of_directories - 1 ] );
+
+		/* The packed sub file entries of a directory are retrieved when all previously
+		 * retrieved ones were read, also when a sub directory was walked in between
+		 */
+		if( directory->packed_file_entry_index >= directory->number_of_packed_file_entries )
+		{
+			if( directory->packed_file_entries == NULL )
+			{
+				directory->packed_file_entries = (libfsfat_packed_file_entry_t *) memory_allocate(
+				                                                                   sizeof( libfsfat_packed_file_entry_t ) * PYFSFAT_WALK_MAXIMUM_NUMBER_OF_PACKED_FILE_ENTRIES );
+
+				if( directory->packed_file_entries == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create packed file entries.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( directory->name_pool == NULL )
+			{
+				directory->name_pool = (uint8_t *) memory_allocate(
+				                                    sizeof( uint8_t ) * PYFSFAT_WALK_NAME_POOL_SIZE );
+
+				if( directory->name_pool == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create name pool.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libfsfat_file_entry_get_sub_file_entries_packed(
+			     directory->file_entry,
+			     directory->next_sub_file_entry_index,
+			     directory->packed_file_entries,
+			     PYFSFAT_WALK_MAXIMUM_NUMBER_OF_PACKED_FILE_ENTRIES,
+			     directory->name_pool,
+			     PYFSFAT_WALK_NAME_POOL_SIZE,
+			     &( directory->number_of_packed_file_entries ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve packed sub file entries.",
+				 function );
+
+				directory->number_of_packed_file_entries = 0;
+
+				goto on_error;
+			}
+			directory->packed_file_entry_index    = 0;
+			directory->next_sub_file_entry_index += directory->number_of_packed_file_entries;
+
+			if( directory->number_of_packed_file_entries == 0 )
+			{
+				if( libfsfat_file_entry_free(
+				     &( directory->file_entry ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file entry.",
+					 function );
+
+					goto on_error;
+				}
+				pyfsfat_walk->number_of_directories -= 1;
+
+				continue;
+			}
+		}
+		packed_file_entry    = &( directory->packed_file_entries[ directory->packed_file_entry_index ] );
+		sub_file_entry_index = directory->next_sub_file_entry_index - directory->number_of_packed_file_entries + directory->packed_file_entry_index;
+
+		name_length = 0;
+
+		if( packed_file_entry->name_size > 1 )
+		{
+			name_length = (size_t) packed_file_entry->name_size - 1;
+		}
+		if( name_length >= PYFSFAT_WALK_MAXIMUM_NAME_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid packed file entry: %d - name size value out of bounds.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		/* Continue in the next batch when the path pool is full
+		 */
+		if( ( directory->path_length + 1 + name_length ) > ( PYFSFAT_WALK_PATH_POOL_SIZE - path_pool_offset ) )
+		{
+			return( 1 );
+		}
+		record = &( pyfsfat_walk->records[ pyfsfat_walk->number_of_records ] );
+
+		record->identifier           = packed_file_entry->identifier;
+		record->size                 = packed_file_entry->size;
+		record->creation_time        = packed_file_entry->creation_time;
+		record->access_time          = packed_file_entry->access_time;
+		record->modification_time    = packed_file_entry->modification_time;
+		record->file_attribute_flags = packed_file_entry->file_attribute_flags;
+		record->path_offset          = path_pool_offset;
+		record->path_length          = directory->path_length + 1 + name_length;
+
+		if( directory->path_length > 0 )
+		{
+			if( memory_copy(
+			     &( pyfsfat_walk->path_pool[ path_pool_offset ] ),
+			     pyfsfat_walk->path,
+			     directory->path_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy directory path to path pool.",
+				 function );
+
+				goto on_error;
+			}
+			path_pool_offset += directory->path_length;
+		}
+		pyfsfat_walk->path_pool[ path_pool_offset++ ] = (uint8_t) '/';
+
+		if( name_length > 0 )
+		{
+			if( memory_copy(
+			     &( pyfsfat_walk->path_pool[ path_pool_offset ] ),
+			     &( directory->name_pool[ packed_file_entry->name_offset ] ),
+			     name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to path pool.",
+				 function );
+
+				goto on_error;
+			}
+			path_pool_offset += name_length;
+		}
+		pyfsfat_walk->number_of_records    += 1;
+		directory->packed_file_entry_index += 1;
+
+		if( ( packed_file_entry->file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
+		{
+			continue;
+		}
+		/* The record of a directory at the maximum depth is returned
+		 * but its sub file entries are not walked
+		 */
+		if( pyfsfat_walk->number_of_directories >= PYFSFAT_WALK_MAXIMUM_DEPTH )
+		{
+			continue;
+		}
+		/* The file entry is only retrieved for sub directories, since it is
+		 * needed to read their sub file entries
+		 */
+		if( libfsfat_file_entry_get_sub_file_entry_by_index(
+		     directory->file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		/* The path of the sub directory extends the path of the directory
+		 */
+		pyfsfat_walk->path[ directory->path_length ] = (uint8_t) '/';
+
+		if( name_length > 0 )
+		{
+			if( memory_copy(
+			     &( pyfsfat_walk->path[ directory->path_length + 1 ] ),
+			     &( directory->name_pool[ packed_file_entry->name_offset ] ),
+			     name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to path.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The unread packed sub file entries of the directory remain on the stack
+		 * and are read after the sub directory was walked
+		 */
+		sub_directory = &( pyfsfat_walk->directories[ pyfsfat_walk->number_of_directories ] );
+
+		sub_directory->file_entry                    = sub_file_entry;
+		sub_directory->next_sub_file_entry_index     = 0;
+		sub_directory->path_length                   = directory->path_length + 1 + name_length;
+		sub_directory->number_of_packed_file_entries = 0;
+		sub_directory->packed_file_entry_index       = 0;
+
+		pyfsfat_walk->number_of_directories += 1;
+
+		sub_file_entry = NULL;
+	}
+	if( pyfsfat_walk->number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	pyfsfat_walk->number_of_records = 0;
+
+	return( -1 );
+}
+
+/* The walk iter() function
+ */
+PyObject *pyfsfat_walk_iter(
+           pyfsfat_walk_t *pyfsfat_walk )
+{
+	static char *function = "pyfsfat_walk_iter";
+
+	if( pyfsfat_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyfsfat_walk );
+
+	return( (PyObject *) pyfsfat_walk );
+}
+
+/* The walk iternext() function
+ * Returns a tuple of path, identifier, size, file attribute flags, creation time,
+ * access time and modification time
+ */
+PyObject *pyfsfat_walk_iternext(
+           pyfsfat_walk_t *pyfsfat_walk )
+{
+	PyObject *integer_object      = NULL;
+	PyObject *string_object       = NULL;
+	PyObject *tuple_object        = NULL;
+	libcerror_error_t *error      = NULL;
+	pyfsfat_walk_record_t *record = NULL;
+	static char *function         = "pyfsfat_walk_iternext";
+	uint64_t values[ 6 ];
+	int result                    = 0;
+	int value_index               = 0;
+
+	if( pyfsfat_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsfat_walk->records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk - missing records.",
+		 function );
+
+		return( NULL );
+	}
+	/* The lock is only grabbed while the GIL is released, so that a thread
+	 * that waits for the lock does not block the thread that holds it
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsfat_walk->lock,
+	 WAIT_LOCK );
+
+	result = 1;
+
+	if( pyfsfat_walk->current_record_index >= pyfsfat_walk->number_of_records )
+	{
+		result = 0;
+
+		if( pyfsfat_walk->number_of_directories > 0 )
+		{
+			result = pyfsfat_walk_read_records(
+			          pyfsfat_walk,
+			          &error );
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsfat_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		goto on_error;
+	}
+	record = &( pyfsfat_walk->records[ pyfsfat_walk->current_record_index ] );
+
+	tuple_object = PyTuple_New(
+	                7 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) &( pyfsfat_walk->path_pool[ record->path_offset ] ),
+	                 (Py_ssize_t) record->path_length,
+	                 NULL );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 path into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	/* Tuple set item does not increment the reference count of the string object
+	 */
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     0,
+	     string_object ) != 0 )
+	{
+		goto on_error;
+	}
+	values[ 0 ] = record->identifier;
+	values[ 1 ] = record->size;
+	values[ 2 ] = (uint64_t) record->file_attribute_flags;
+	values[ 3 ] = record->creation_time;
+	values[ 4 ] = record->access_time;
+	values[ 5 ] = record->modification_time;
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		integer_object = pyfsfat_integer_unsigned_new_from_64bit(
+		                  values[ value_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		/* Tuple set item does not increment the reference count of the integer object
+		 */
+		if( PyTuple_SetItem(
+		     tuple_object,
+		     value_index + 1,
+		     integer_object ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	pyfsfat_walk->current_record_index += 1;
+
+	PyThread_release_lock(
+	 pyfsfat_walk->lock );
+
+	return( tuple_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 tuple_object );
+	}
+	PyThread_release_lock(
+	 pyfsfat_walk->lock );
+
+	return( NULL );
+}
+
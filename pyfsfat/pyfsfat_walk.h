@@ -0,0 +1,197 @@
+/*
+ * Python object definition of the iterator object of a volume walk
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSFAT_WALK_H )
+#define _PYFSFAT_WALK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsfat_libcerror.h"
+#include "pyfsfat_libfsfat.h"
+#include "pyfsfat_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of records retrieved per batch
+ */
+#define PYFSFAT_WALK_MAXIMUM_NUMBER_OF_RECORDS		1024
+
+/* The maximum number of packed sub file entries retrieved per directory at a time
+ */
+#define PYFSFAT_WALK_MAXIMUM_NUMBER_OF_PACKED_FILE_ENTRIES	256
+
+/* The maximum directory depth, the sub file entries of directories at this depth are not walked
+ */
+#define PYFSFAT_WALK_MAXIMUM_DEPTH			256
+
+/* The maximum size of an UTF-8 encoded name including the end of string character
+ */
+#define PYFSFAT_WALK_MAXIMUM_NAME_SIZE			( ( 255 * 3 ) + 1 )
+
+/* The size of the path pool of a batch
+ */
+#define PYFSFAT_WALK_PATH_POOL_SIZE			( 1024 * 1024 )
+
+/* The size of the name pool used to retrieve the packed sub file entries of a directory
+ */
+#define PYFSFAT_WALK_NAME_POOL_SIZE			( 16 * 1024 )
+
+typedef struct pyfsfat_walk_directory pyfsfat_walk_directory_t;
+
+struct pyfsfat_walk_directory
+{
+	/* The file entry
+	 */
+	libfsfat_file_entry_t *file_entry;
+
+	/* The index of the next sub file entry to retrieve
+	 */
+	int next_sub_file_entry_index;
+
+	/* The length of the path of the directory
+	 */
+	size_t path_length;
+
+	/* The packed sub file entries that were retrieved
+	 */
+	libfsfat_packed_file_entry_t *packed_file_entries;
+
+	/* The name pool of the packed sub file entries
+	 */
+	uint8_t *name_pool;
+
+	/* The number of packed sub file entries that were retrieved
+	 */
+	int number_of_packed_file_entries;
+
+	/* The index of the next packed sub file entry to read a record from
+	 */
+	int packed_file_entry_index;
+};
+
+typedef struct pyfsfat_walk_record pyfsfat_walk_record_t;
+
+struct pyfsfat_walk_record
+{
+	/* The (virtual) identifier
+	 */
+	uint64_t identifier;
+
+	/* The data size
+	 */
+	uint64_t size;
+
+	/* The creation, access and modification FAT timestamps
+	 */
+	uint64_t creation_time;
+	uint64_t access_time;
+	uint64_t modification_time;
+
+	/* The offset of the UTF-8 encoded path in the path pool
+	 */
+	size_t path_offset;
+
+	/* The length of the UTF-8 encoded path
+	 */
+	size_t path_length;
+
+	/* The file attribute flags
+	 */
+	uint16_t file_attribute_flags;
+};
+
+typedef struct pyfsfat_walk pyfsfat_walk_t;
+
+struct pyfsfat_walk
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The lock that serializes reading the records
+	 */
+	PyThread_type_lock lock;
+
+	/* The directory stack, the packed sub file entries and name pool of
+	 * a directory are kept when the stack is popped so they can be reused
+	 */
+	pyfsfat_walk_directory_t *directories;
+
+	/* The number of directories on the stack
+	 */
+	int number_of_directories;
+
+	/* The UTF-8 encoded path of the directory on top of the stack
+	 */
+	uint8_t *path;
+
+	/* The records of the current batch
+	 */
+	pyfsfat_walk_record_t *records;
+
+	/* The number of records in the current batch
+	 */
+	int number_of_records;
+
+	/* The index of the next record in the current batch
+	 */
+	int current_record_index;
+
+	/* The path pool of the current batch
+	 */
+	uint8_t *path_pool;
+};
+
+extern PyTypeObject pyfsfat_walk_type_object;
+
+PyObject *pyfsfat_walk_new(
+           PyObject *parent_object,
+           libfsfat_file_entry_t *root_directory );
+
+int pyfsfat_walk_init(
+     pyfsfat_walk_t *pyfsfat_walk );
+
+void pyfsfat_walk_free(
+      pyfsfat_walk_t *pyfsfat_walk );
+
+int pyfsfat_walk_read_records(
+     pyfsfat_walk_t *pyfsfat_walk,
+     libcerror_error_t **error );
+
+PyObject *pyfsfat_walk_iter(
+           pyfsfat_walk_t *pyfsfat_walk );
+
+PyObject *pyfsfat_walk_iternext(
+           pyfsfat_walk_t *pyfsfat_walk );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSFAT_WALK_H ) */
+
@@ -0,0 +1,1887 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "fsfat_test_functions.h"
+#include "fsfat_test_getopt.h"
+#include "fsfat_test_libbfio.h"
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_libfsfat.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+#include "../libfsfat/libfsfat_boot_record.h"
+#include "../libfsfat/libfsfat_file_system.h"
+#include "../libfsfat/libfsfat_io_handle.h"
+#endif
+
+#if !defined( LIBFSFAT_HAVE_BFIO )
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_open_file_io_handle(
+     libfsfat_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsfat_error_t **error );
+
+#endif /* !defined( LIBFSFAT_HAVE_BFIO ) */
+
+/* The default number of times the volume is opened
+ */
+#define FSFAT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	5
+
+/* The maximum number of paths sampled for the lookup and read benchmarks
+ */
+#define FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS		1024
+
+/* The maximum size of a sampled path including the end of string character
+ */
+#define FSFAT_BENCH_MAXIMUM_PATH_SIZE			1024
+
+/* The maximum directory depth that is tracked while walking
+ */
+#define FSFAT_BENCH_MAXIMUM_DEPTH			256
+
+/* The size of the buffer used for sequential reads
+ */
+#define FSFAT_BENCH_SEQUENTIAL_READ_SIZE		( 1024 * 1024 )
+
+/* The maximum number of bytes read sequentially
+ */
+#define FSFAT_BENCH_MAXIMUM_SEQUENTIAL_READ_SIZE	( (size64_t) 256 * 1024 * 1024 )
+
+/* The size of a random read
+ */
+#define FSFAT_BENCH_RANDOM_READ_SIZE			4096
+
+/* The number of random reads
+ */
+#define FSFAT_BENCH_NUMBER_OF_RANDOM_READS		4096
+
+typedef struct fsfat_bench_path_sample fsfat_bench_path_sample_t;
+
+struct fsfat_bench_path_sample
+{
+	/* The number of paths sampled
+	 */
+	int number_of_paths;
+
+	/* The number of candidate paths seen
+	 */
+	uint64_t number_of_candidates;
+
+	/* The paths, each of FSFAT_BENCH_MAXIMUM_PATH_SIZE
+	 */
+	uint8_t *paths;
+
+	/* The path lengths
+	 */
+	size_t path_lengths[ FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+
+	/* The data sizes
+	 */
+	size64_t sizes[ FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+};
+
+typedef struct fsfat_bench_walk_state fsfat_bench_walk_state_t;
+
+struct fsfat_bench_walk_state
+{
+	/* The number of file entries
+	 */
+	uint64_t number_of_file_entries;
+
+	/* The number of directories
+	 */
+	uint64_t number_of_directories;
+
+	/* The UTF-8 encoded path of the current file entry
+	 */
+	uint8_t path[ FSFAT_BENCH_MAXIMUM_PATH_SIZE ];
+
+	/* The path length per depth
+	 */
+	size_t path_lengths[ FSFAT_BENCH_MAXIMUM_DEPTH ];
+
+	/* The sample of all paths, used for lookups
+	 */
+	fsfat_bench_path_sample_t *lookup_sample;
+
+	/* The sample of file paths with data, used for reads
+	 */
+	fsfat_bench_path_sample_t *read_sample;
+
+	/* The pseudo random number generator state
+	 */
+	uint64_t random_state;
+};
+
+/* Retrieves the next pseudo random number
+ * This uses xorshift64 to keep results reproducible across platforms
+ */
+uint64_t fsfat_bench_get_random(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_get_time(
+     uint64_t *timestamp,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_structure;
+#else
+	struct timeval time_structure;
+#endif
+
+	static char *function = "fsfat_bench_get_time";
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time structure.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( (uint64_t) time_structure.tv_sec * 1000000000 ) + (uint64_t) time_structure.tv_nsec;
+
+#else
+	if( gettimeofday(
+	     &time_structure,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time structure.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( (uint64_t) time_structure.tv_sec * 1000000000 ) + ( (uint64_t) time_structure.tv_usec * 1000 );
+
+#endif
+	return( 1 );
+}
+
+/* Determines the throughput in megabytes (MiB) per second
+ */
+double fsfat_bench_get_megabytes_per_second(
+        uint64_t number_of_bytes,
+        uint64_t elapsed_time )
+{
+	if( elapsed_time == 0 )
+	{
+		return( 0.0 );
+	}
+	return( ( (double) number_of_bytes / ( 1024.0 * 1024.0 ) ) / ( (double) elapsed_time / 1000000000.0 ) );
+}
+
+/* Determines the rate of items per second
+ */
+double fsfat_bench_get_rate(
+        uint64_t number_of_items,
+        uint64_t elapsed_time )
+{
+	if( elapsed_time == 0 )
+	{
+		return( 0.0 );
+	}
+	return( (double) number_of_items / ( (double) elapsed_time / 1000000000.0 ) );
+}
+
+/* Compares two elapsed times
+ * Returns -1, 0 or 1
+ */
+int fsfat_bench_compare_time(
+     const void *first_time,
+     const void *second_time )
+{
+	uint64_t first_value  = *( (const uint64_t *) first_time );
+	uint64_t second_value = *( (const uint64_t *) second_time );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the percentile of sorted elapsed times in microseconds
+ */
+double fsfat_bench_get_percentile(
+        const uint64_t *sorted_times,
+        int number_of_times,
+        int percentile )
+{
+	int time_index = 0;
+
+	if( number_of_times <= 0 )
+	{
+		return( 0.0 );
+	}
+	time_index = (int) ( ( (int64_t) number_of_times * percentile ) / 100 );
+
+	if( time_index >= number_of_times )
+	{
+		time_index = number_of_times - 1;
+	}
+	return( (double) sorted_times[ time_index ] / 1000.0 );
+}
+
+/* Prints a string as a JSON string
+ */
+void fsfat_bench_print_json_string(
+      FILE *stream,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	fprintf(
+	 stream,
+	 "\"" );
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+		else if( string[ string_index ] < (system_character_t) 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04x",
+			 (unsigned int) string[ string_index ] );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
+/* Adds a path to a sample
+ * Reservoir sampling is used to keep the sample bounded and unbiased
+ */
+void fsfat_bench_path_sample_add(
+      fsfat_bench_path_sample_t *path_sample,
+      const uint8_t *path,
+      size_t path_length,
+      size64_t size,
+      uint64_t *random_state )
+{
+	uint64_t path_index = 0;
+
+	path_sample->number_of_candidates += 1;
+
+	if( path_sample->number_of_paths < FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS )
+	{
+		path_index = (uint64_t) path_sample->number_of_paths;
+
+		path_sample->number_of_paths += 1;
+	}
+	else
+	{
+		path_index = fsfat_bench_get_random(
+		              random_state ) % path_sample->number_of_candidates;
+
+		if( path_index >= FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS )
+		{
+			return;
+		}
+	}
+	memory_copy(
+	 &( path_sample->paths[ path_index * FSFAT_BENCH_MAXIMUM_PATH_SIZE ] ),
+	 path,
+	 path_length + 1 );
+
+	path_sample->path_lengths[ path_index ] = path_length;
+	path_sample->sizes[ path_index ]        = size;
+}
+
+/* Callback function to count the file entries of a walk
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_count_callback(
+     libfsfat_file_entry_t *file_entry FSFAT_TEST_ATTRIBUTE_UNUSED,
+     int depth FSFAT_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FSFAT_TEST_ATTRIBUTE_UNUSED )
+{
+	FSFAT_TEST_UNREFERENCED_PARAMETER( file_entry )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( depth )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( error )
+
+	*( (uint64_t *) callback_data ) += 1;
+
+	return( 1 );
+}
+
+/* Callback function to sample the paths of a walk
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_sample_callback(
+     libfsfat_file_entry_t *file_entry,
+     int depth,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	fsfat_bench_walk_state_t *walk_state = NULL;
+	static char *function                = "fsfat_bench_sample_callback";
+	size64_t size                        = 0;
+	size_t name_size                     = 0;
+	size_t path_length                   = 0;
+	uint16_t file_attribute_flags        = 0;
+	int result                           = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	walk_state = (fsfat_bench_walk_state_t *) callback_data;
+
+	walk_state->number_of_file_entries += 1;
+
+	if( depth == 0 )
+	{
+		walk_state->number_of_directories += 1;
+		walk_state->path[ 0 ]              = 0;
+		walk_state->path_lengths[ 0 ]      = 0;
+
+		return( 1 );
+	}
+	if( depth >= FSFAT_BENCH_MAXIMUM_DEPTH )
+	{
+		return( 0 );
+	}
+	if( libfsfat_file_entry_get_file_attribute_flags(
+	     file_entry,
+	     &file_attribute_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) != 0 )
+	{
+		walk_state->number_of_directories += 1;
+	}
+	result = libfsfat_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = walk_state->path_lengths[ depth - 1 ];
+
+	/* Skip the file entry and its sub file entries if it has no name
+	 * or its path does not fit in the path buffer
+	 */
+	if( ( result == 0 )
+	 || ( name_size <= 1 )
+	 || ( name_size > ( FSFAT_BENCH_MAXIMUM_PATH_SIZE - path_length - 1 ) ) )
+	{
+		return( 0 );
+	}
+	walk_state->path[ path_length++ ] = (uint8_t) LIBFSFAT_SEPARATOR;
+
+	if( libfsfat_file_entry_get_utf8_name(
+	     file_entry,
+	     &( walk_state->path[ path_length ] ),
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	path_length += name_size - 1;
+
+	walk_state->path_lengths[ depth ] = path_length;
+
+	if( libfsfat_file_entry_get_size(
+	     file_entry,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	fsfat_bench_path_sample_add(
+	 walk_state->lookup_sample,
+	 walk_state->path,
+	 path_length,
+	 size,
+	 &( walk_state->random_state ) );
+
+	if( ( ( file_attribute_flags & LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY ) == 0 )
+	 && ( size > 0 ) )
+	{
+		fsfat_bench_path_sample_add(
+		 walk_state->read_sample,
+		 walk_state->path,
+		 path_length,
+		 size,
+		 &( walk_state->random_state ) );
+	}
+	return( 1 );
+}
+
+/* Opens a volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_open_volume(
+     libfsfat_volume_t **volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_bench_open_volume";
+
+	if( libfsfat_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_volume_open_file_io_handle(
+	     *volume,
+	     file_io_handle,
+	     LIBFSFAT_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsfat_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_close_volume(
+     libfsfat_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_bench_close_volume";
+	int result            = 1;
+
+	if( libfsfat_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsfat_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Benchmarks opening the volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_open(
+     libbfio_handle_t *file_io_handle,
+     int number_of_iterations,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libfsfat_volume_t *volume = NULL;
+	static char *function     = "fsfat_bench_open";
+	uint64_t end_time         = 0;
+	uint64_t minimum_time     = 0;
+	uint64_t start_time       = 0;
+	uint64_t total_time       = 0;
+	int iteration             = 0;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( fsfat_bench_get_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fsfat_bench_open_volume(
+		     &volume,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fsfat_bench_get_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fsfat_bench_close_volume(
+		     &volume,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		end_time -= start_time;
+
+		if( ( iteration == 0 )
+		 || ( end_time < minimum_time ) )
+		{
+			minimum_time = end_time;
+		}
+		total_time += end_time;
+	}
+	fprintf(
+	 stream,
+	 "\t\"open\": {\n"
+	 "\t\t\"number_of_iterations\": %d,\n"
+	 "\t\t\"minimum_time_us\": %.3f,\n"
+	 "\t\t\"mean_time_us\": %.3f\n"
+	 "\t},\n",
+	 number_of_iterations,
+	 (double) minimum_time / 1000.0,
+	 (double) total_time / ( (double) number_of_iterations * 1000.0 ) );
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to benchmark open.",
+	 function );
+
+	if( volume != NULL )
+	{
+		libfsfat_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+/* Benchmarks decoding the allocation table
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_allocation_table(
+     libbfio_handle_t *file_io_handle,
+     int number_of_iterations,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libfsfat_boot_record_t *boot_record = NULL;
+	libfsfat_file_system_t *file_system = NULL;
+	libfsfat_io_handle_t *io_handle     = NULL;
+	static char *function               = "fsfat_bench_allocation_table";
+	uint64_t end_time                   = 0;
+	uint64_t minimum_time               = 0;
+	uint64_t start_time                 = 0;
+	int iteration                       = 0;
+
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_boot_record_initialize(
+	     &boot_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create boot record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_boot_record_read_file_io_handle(
+	     boot_record,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read boot record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->file_system_format       = boot_record->file_system_format;
+	io_handle->bytes_per_sector         = boot_record->bytes_per_sector;
+	io_handle->cluster_block_size       = boot_record->cluster_block_size;
+	io_handle->total_number_of_clusters = boot_record->total_number_of_clusters;
+	io_handle->first_cluster_offset     = boot_record->first_cluster_offset;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libfsfat_file_system_initialize(
+		     &file_system,
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file system.",
+			 function );
+
+			goto on_error;
+		}
+		if( fsfat_bench_get_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfsfat_file_system_read_allocation_table(
+		     file_system,
+		     file_io_handle,
+		     boot_record->allocation_table_offset,
+		     boot_record->allocation_table_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read allocation table.",
+			 function );
+
+			goto on_error;
+		}
+		if( fsfat_bench_get_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfsfat_file_system_free(
+		     &file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system.",
+			 function );
+
+			goto on_error;
+		}
+		end_time -= start_time;
+
+		if( ( iteration == 0 )
+		 || ( end_time < minimum_time ) )
+		{
+			minimum_time = end_time;
+		}
+	}
+	fprintf(
+	 stream,
+	 "\t\"allocation_table\": {\n"
+	 "\t\t\"size\": %" PRIu64 ",\n"
+	 "\t\t\"number_of_clusters\": %" PRIu32 ",\n"
+	 "\t\t\"minimum_time_us\": %.3f,\n"
+	 "\t\t\"clusters_per_second\": %.1f,\n"
+	 "\t\t\"megabytes_per_second\": %.3f\n"
+	 "\t},\n",
+	 boot_record->allocation_table_size,
+	 boot_record->total_number_of_clusters,
+	 (double) minimum_time / 1000.0,
+	 fsfat_bench_get_rate(
+	  (uint64_t) boot_record->total_number_of_clusters,
+	  minimum_time ),
+	 fsfat_bench_get_megabytes_per_second(
+	  (uint64_t) boot_record->allocation_table_size,
+	  minimum_time ) );
+
+	if( libfsfat_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_boot_record_free(
+	     &boot_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free boot record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_system != NULL )
+	{
+		libfsfat_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsfat_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( boot_record != NULL )
+	{
+		libfsfat_boot_record_free(
+		 &boot_record,
+		 NULL );
+	}
+	libbfio_handle_close(
+	 file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+/* Benchmarks walking the directory hierarchy
+ * The first walk is timed, the second walk samples the paths used by the lookup and read benchmarks
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_walk(
+     libfsfat_volume_t *volume,
+     fsfat_bench_walk_state_t *walk_state,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function           = "fsfat_bench_walk";
+	uint64_t end_time               = 0;
+	uint64_t number_of_file_entries = 0;
+	uint64_t start_time             = 0;
+
+	if( fsfat_bench_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsfat_volume_walk(
+	     volume,
+	     &fsfat_bench_count_callback,
+	     (void *) &number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsfat_bench_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	end_time -= start_time;
+
+	if( libfsfat_volume_walk(
+	     volume,
+	     &fsfat_bench_sample_callback,
+	     (void *) walk_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk volume.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "\t\"walk\": {\n"
+	 "\t\t\"number_of_file_entries\": %" PRIu64 ",\n"
+	 "\t\t\"number_of_directories\": %" PRIu64 ",\n"
+	 "\t\t\"time_us\": %.3f,\n"
+	 "\t\t\"file_entries_per_second\": %.1f\n"
+	 "\t},\n",
+	 number_of_file_entries,
+	 walk_state->number_of_directories,
+	 (double) end_time / 1000.0,
+	 fsfat_bench_get_rate(
+	  number_of_file_entries,
+	  end_time ) );
+
+	return( 1 );
+}
+
+/* Benchmarks looking up file entries by path
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_lookup(
+     libfsfat_volume_t *volume,
+     fsfat_bench_path_sample_t *path_sample,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libfsfat_file_entry_t *file_entry = NULL;
+	uint64_t *lookup_times            = NULL;
+	static char *function             = "fsfat_bench_lookup";
+	uint64_t end_time                 = 0;
+	uint64_t start_time               = 0;
+	int path_index                    = 0;
+	int result                        = 0;
+
+	if( path_sample->number_of_paths > 0 )
+	{
+		lookup_times = (uint64_t *) memory_allocate(
+		                             sizeof( uint64_t ) * path_sample->number_of_paths );
+
+		if( lookup_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create lookup times.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( path_index = 0;
+	     path_index < path_sample->number_of_paths;
+	     path_index++ )
+	{
+		if( fsfat_bench_get_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		result = libfsfat_volume_get_file_entry_by_utf8_path(
+		          volume,
+		          &( path_sample->paths[ path_index * FSFAT_BENCH_MAXIMUM_PATH_SIZE ] ),
+		          path_sample->path_lengths[ path_index ],
+		          &file_entry,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d by path.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( fsfat_bench_get_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfsfat_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			goto on_error;
+		}
+		lookup_times[ path_index ] = end_time - start_time;
+	}
+	if( lookup_times != NULL )
+	{
+		qsort(
+		 lookup_times,
+		 (size_t) path_sample->number_of_paths,
+		 sizeof( uint64_t ),
+		 &fsfat_bench_compare_time );
+	}
+	fprintf(
+	 stream,
+	 "\t\"lookup\": {\n"
+	 "\t\t\"number_of_lookups\": %d,\n"
+	 "\t\t\"p50_us\": %.3f,\n"
+	 "\t\t\"p90_us\": %.3f,\n"
+	 "\t\t\"p99_us\": %.3f,\n"
+	 "\t\t\"maximum_us\": %.3f\n"
+	 "\t},\n",
+	 path_sample->number_of_paths,
+	 fsfat_bench_get_percentile(
+	  lookup_times,
+	  path_sample->number_of_paths,
+	  50 ),
+	 fsfat_bench_get_percentile(
+	  lookup_times,
+	  path_sample->number_of_paths,
+	  90 ),
+	 fsfat_bench_get_percentile(
+	  lookup_times,
+	  path_sample->number_of_paths,
+	  99 ),
+	 fsfat_bench_get_percentile(
+	  lookup_times,
+	  path_sample->number_of_paths,
+	  100 ) );
+
+	if( lookup_times != NULL )
+	{
+		memory_free(
+		 lookup_times );
+	}
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( lookup_times != NULL )
+	{
+		memory_free(
+		 lookup_times );
+	}
+	return( -1 );
+}
+
+/* Benchmarks reading file entry data sequentially and at random offsets
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_bench_read(
+     libfsfat_volume_t *volume,
+     fsfat_bench_path_sample_t *path_sample,
+     uint64_t *random_state,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libfsfat_file_entry_t **file_entries = NULL;
+	uint8_t *buffer                      = NULL;
+	static char *function                = "fsfat_bench_read";
+	size64_t maximum_offset              = 0;
+	size64_t read_count                  = 0;
+	size64_t remaining_size              = 0;
+	size_t read_size                     = 0;
+	ssize_t read_result                  = 0;
+	uint64_t end_time                    = 0;
+	uint64_t number_of_bytes             = 0;
+	uint64_t start_time                  = 0;
+	off64_t file_offset                  = 0;
+	int number_of_files                  = 0;
+	int number_of_random_files           = 0;
+	int path_index                       = 0;
+	int read_index                       = 0;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * FSFAT_BENCH_SEQUENTIAL_READ_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_sample->number_of_paths > 0 )
+	{
+		file_entries = (libfsfat_file_entry_t **) memory_allocate(
+		                                           sizeof( libfsfat_file_entry_t * ) * path_sample->number_of_paths );
+
+		if( file_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     file_entries,
+		     0,
+		     sizeof( libfsfat_file_entry_t * ) * path_sample->number_of_paths ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The file entries are opened up front so only data reads are timed
+	 */
+	for( path_index = 0;
+	     path_index < path_sample->number_of_paths;
+	     path_index++ )
+	{
+		if( libfsfat_volume_get_file_entry_by_utf8_path(
+		     volume,
+		     &( path_sample->paths[ path_index * FSFAT_BENCH_MAXIMUM_PATH_SIZE ] ),
+		     path_sample->path_lengths[ path_index ],
+		     &( file_entries[ path_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d by path.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+	}
+	if( fsfat_bench_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < path_sample->number_of_paths;
+	     path_index++ )
+	{
+		if( number_of_bytes >= FSFAT_BENCH_MAXIMUM_SEQUENTIAL_READ_SIZE )
+		{
+			break;
+		}
+		remaining_size = path_sample->sizes[ path_index ];
+
+		while( remaining_size > 0 )
+		{
+			read_size = FSFAT_BENCH_SEQUENTIAL_READ_SIZE;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			read_result = libfsfat_file_entry_read_buffer_at_offset(
+			               file_entries[ path_index ],
+			               buffer,
+			               read_size,
+			               (off64_t) ( path_sample->sizes[ path_index ] - remaining_size ),
+			               error );
+
+			if( read_result < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of file entry: %d.",
+				 function,
+				 path_index );
+
+				goto on_error;
+			}
+			else if( read_result == 0 )
+			{
+				break;
+			}
+			remaining_size  -= (size64_t) read_result;
+			number_of_bytes += (uint64_t) read_result;
+		}
+		number_of_files++;
+	}
+	if( fsfat_bench_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_time -= start_time;
+
+	fprintf(
+	 stream,
+	 "\t\"sequential_read\": {\n"
+	 "\t\t\"number_of_files\": %d,\n"
+	 "\t\t\"read_size\": %d,\n"
+	 "\t\t\"number_of_bytes\": %" PRIu64 ",\n"
+	 "\t\t\"time_us\": %.3f,\n"
+	 "\t\t\"megabytes_per_second\": %.3f\n"
+	 "\t},\n",
+	 number_of_files,
+	 FSFAT_BENCH_SEQUENTIAL_READ_SIZE,
+	 number_of_bytes,
+	 (double) end_time / 1000.0,
+	 fsfat_bench_get_megabytes_per_second(
+	  number_of_bytes,
+	  end_time ) );
+
+	/* Only files that hold at least one random read size are used for random reads
+	 */
+	for( path_index = 0;
+	     path_index < path_sample->number_of_paths;
+	     path_index++ )
+	{
+		if( path_sample->sizes[ path_index ] >= FSFAT_BENCH_RANDOM_READ_SIZE )
+		{
+			number_of_random_files++;
+		}
+	}
+	number_of_bytes = 0;
+	read_count      = 0;
+	end_time        = 0;
+
+	if( number_of_random_files > 0 )
+	{
+		if( fsfat_bench_get_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( read_index = 0;
+		     read_index < FSFAT_BENCH_NUMBER_OF_RANDOM_READS;
+		     read_index++ )
+		{
+			do
+			{
+				path_index = (int) ( fsfat_bench_get_random(
+				                      random_state ) % (uint64_t) path_sample->number_of_paths );
+			}
+			while( path_sample->sizes[ path_index ] < FSFAT_BENCH_RANDOM_READ_SIZE );
+
+			maximum_offset = path_sample->sizes[ path_index ] - FSFAT_BENCH_RANDOM_READ_SIZE + 1;
+			file_offset    = (off64_t) ( fsfat_bench_get_random(
+			                              random_state ) % maximum_offset );
+
+			read_result = libfsfat_file_entry_read_buffer_at_offset(
+			               file_entries[ path_index ],
+			               buffer,
+			               FSFAT_BENCH_RANDOM_READ_SIZE,
+			               file_offset,
+			               error );
+
+			if( read_result < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of file entry: %d at offset: %" PRIi64 ".",
+				 function,
+				 path_index,
+				 file_offset );
+
+				goto on_error;
+			}
+			number_of_bytes += (uint64_t) read_result;
+			read_count      += 1;
+		}
+		if( fsfat_bench_get_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		end_time -= start_time;
+	}
+	fprintf(
+	 stream,
+	 "\t\"random_read\": {\n"
+	 "\t\t\"number_of_reads\": %" PRIu64 ",\n"
+	 "\t\t\"read_size\": %d,\n"
+	 "\t\t\"number_of_bytes\": %" PRIu64 ",\n"
+	 "\t\t\"time_us\": %.3f,\n"
+	 "\t\t\"megabytes_per_second\": %.3f\n"
+	 "\t}\n",
+	 read_count,
+	 FSFAT_BENCH_RANDOM_READ_SIZE,
+	 number_of_bytes,
+	 (double) end_time / 1000.0,
+	 fsfat_bench_get_megabytes_per_second(
+	  number_of_bytes,
+	  end_time ) );
+
+	for( path_index = 0;
+	     path_index < path_sample->number_of_paths;
+	     path_index++ )
+	{
+		if( libfsfat_file_entry_free(
+		     &( file_entries[ path_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+	}
+	if( file_entries != NULL )
+	{
+		memory_free(
+		 file_entries );
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( file_entries != NULL )
+	{
+		for( path_index = 0;
+		     path_index < path_sample->number_of_paths;
+		     path_index++ )
+		{
+			if( file_entries[ path_index ] != NULL )
+			{
+				libfsfat_file_entry_free(
+				 &( file_entries[ path_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 file_entries );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fsfat_bench_path_sample_t *lookup_sample = NULL;
+	fsfat_bench_path_sample_t *read_sample   = NULL;
+	fsfat_bench_walk_state_t *walk_state     = NULL;
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfsfat_volume_t *volume                = NULL;
+	system_character_t *option_iterations    = NULL;
+	system_character_t *option_offset        = NULL;
+	system_character_t *source               = NULL;
+	system_integer_t option                  = 0;
+	size_t string_length                     = 0;
+	uint64_t number_of_iterations            = FSFAT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	off64_t volume_offset                    = 0;
+
+	while( ( option = fsfat_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:o:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source.\n"
+		 "Usage: fsfat_bench [ -i iterations ] [ -o offset ] source\n" );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_iterations != NULL )
+	{
+		string_length = system_string_length(
+		                 option_iterations );
+
+		if( ( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+		       option_iterations,
+		       string_length + 1,
+		       &number_of_iterations,
+		       &error ) != 1 )
+		 || ( number_of_iterations == 0 )
+		 || ( number_of_iterations > (uint64_t) INT_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		if( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+		     option_offset,
+		     string_length + 1,
+		     (uint64_t *) &volume_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize file IO handle.\n" );
+
+		goto on_error;
+	}
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     source,
+	     string_length,
+	     &error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     source,
+	     string_length,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set file IO handle name.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     volume_offset,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set file IO handle range.\n" );
+
+		goto on_error;
+	}
+	lookup_sample = (fsfat_bench_path_sample_t *) memory_allocate(
+	                                               sizeof( fsfat_bench_path_sample_t ) );
+
+	read_sample = (fsfat_bench_path_sample_t *) memory_allocate(
+	                                             sizeof( fsfat_bench_path_sample_t ) );
+
+	walk_state = (fsfat_bench_walk_state_t *) memory_allocate(
+	                                            sizeof( fsfat_bench_walk_state_t ) );
+
+	if( ( lookup_sample == NULL )
+	 || ( read_sample == NULL )
+	 || ( walk_state == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create walk state.\n" );
+
+		goto on_error;
+	}
+	memory_set(
+	 lookup_sample,
+	 0,
+	 sizeof( fsfat_bench_path_sample_t ) );
+
+	memory_set(
+	 read_sample,
+	 0,
+	 sizeof( fsfat_bench_path_sample_t ) );
+
+	memory_set(
+	 walk_state,
+	 0,
+	 sizeof( fsfat_bench_walk_state_t ) );
+
+	lookup_sample->paths = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS * FSFAT_BENCH_MAXIMUM_PATH_SIZE );
+
+	read_sample->paths = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * FSFAT_BENCH_MAXIMUM_NUMBER_OF_PATHS * FSFAT_BENCH_MAXIMUM_PATH_SIZE );
+
+	if( ( lookup_sample->paths == NULL )
+	 || ( read_sample->paths == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create path samples.\n" );
+
+		goto on_error;
+	}
+	walk_state->lookup_sample = lookup_sample;
+	walk_state->read_sample   = read_sample;
+	walk_state->random_state  = 0x2545f4914f6cdd1dULL;
+
+	fprintf(
+	 stdout,
+	 "{\n"
+	 "\t\"source\": " );
+
+	fsfat_bench_print_json_string(
+	 stdout,
+	 source );
+
+	fprintf(
+	 stdout,
+	 ",\n"
+	 "\t\"offset\": %" PRIi64 ",\n",
+	 volume_offset );
+
+	if( fsfat_bench_open(
+	     file_io_handle,
+	     (int) number_of_iterations,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark open.\n" );
+
+		goto on_error;
+	}
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+	if( fsfat_bench_allocation_table(
+	     file_io_handle,
+	     (int) number_of_iterations,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark allocation table.\n" );
+
+		goto on_error;
+	}
+#else
+	fprintf(
+	 stdout,
+	 "\t\"allocation_table\": null,\n" );
+#endif
+	if( fsfat_bench_open_volume(
+	     &volume,
+	     file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open volume.\n" );
+
+		goto on_error;
+	}
+	if( fsfat_bench_walk(
+	     volume,
+	     walk_state,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark walk.\n" );
+
+		goto on_error;
+	}
+	if( fsfat_bench_lookup(
+	     volume,
+	     lookup_sample,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark lookup.\n" );
+
+		goto on_error;
+	}
+	if( fsfat_bench_read(
+	     volume,
+	     read_sample,
+	     &( walk_state->random_state ),
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark read.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "}\n" );
+
+	if( fsfat_bench_close_volume(
+	     &volume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close volume.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file IO handle.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 read_sample->paths );
+	memory_free(
+	 read_sample );
+	memory_free(
+	 lookup_sample->paths );
+	memory_free(
+	 lookup_sample );
+	memory_free(
+	 walk_state );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsfat_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( read_sample != NULL )
+	{
+		if( read_sample->paths != NULL )
+		{
+			memory_free(
+			 read_sample->paths );
+		}
+		memory_free(
+		 read_sample );
+	}
+	if( lookup_sample != NULL )
+	{
+		if( lookup_sample->paths != NULL )
+		{
+			memory_free(
+			 lookup_sample->paths );
+		}
+		memory_free(
+		 lookup_sample );
+	}
+	if( walk_state != NULL )
+	{
+		memory_free(
+		 walk_state );
+	}
+	return( EXIT_FAILURE );
+}
+
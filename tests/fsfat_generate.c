@@ -0,0 +1,2773 @@
+/*
+ * Synthetic FAT-12, FAT-16, FAT-32 and exFAT image generator
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_test_functions.h"
+#include "fsfat_test_getopt.h"
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_libfsfat.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+#include "../libfsfat/fsfat_boot_record.h"
+#include "../libfsfat/fsfat_directory_entry.h"
+
+/* The generated images use 512 bytes per sector
+ */
+#define FSFAT_GENERATE_BYTES_PER_SECTOR			512
+
+/* The maximum number of files and directories, limited by the 7 hexadecimal digits in the names
+ */
+#define FSFAT_GENERATE_MAXIMUM_NUMBER_OF_ITEMS		0x0fffffffUL
+
+/* The maximum (long) name length
+ */
+#define FSFAT_GENERATE_MAXIMUM_NAME_LENGTH		255
+
+/* The number of sectors in the exFAT main or backup boot region
+ */
+#define FSFAT_GENERATE_EXFAT_BOOT_REGION_SIZE		12
+
+/* The number of entries in the exFAT upcase table
+ */
+#define FSFAT_GENERATE_EXFAT_UPCASE_TABLE_SIZE		128
+
+/* Salts used to derive independent pseudo random streams from the seed
+ */
+#define FSFAT_GENERATE_SALT_NAME			0x6e616d65UL
+#define FSFAT_GENERATE_SALT_DATA			0x64617461UL
+#define FSFAT_GENERATE_SALT_LAYOUT			0x6c61796fUL
+
+typedef struct fsfat_generate_image fsfat_generate_image_t;
+
+struct fsfat_generate_image
+{
+	/* The file system format
+	 */
+	int file_system_format;
+
+	/* The seed
+	 */
+	uint64_t seed;
+
+	/* The number of files
+	 */
+	uint64_t number_of_files;
+
+	/* The maximum number of files per directory
+	 */
+	uint64_t maximum_files_per_directory;
+
+	/* The directory depth, 0 represents all files in the root directory
+	 */
+	uint64_t depth;
+
+	/* The long name length, 0 represents short (8.3) names only
+	 */
+	uint64_t long_name_length;
+
+	/* The fragmentation percentage
+	 */
+	uint64_t fragmentation;
+
+	/* The maximum file size
+	 */
+	uint64_t maximum_file_size;
+
+	/* The cluster block size
+	 */
+	uint64_t cluster_block_size;
+
+	/* The number of directories, not including the root directory
+	 */
+	uint64_t number_of_directories;
+
+	/* The data sizes of the files
+	 */
+	uint64_t *file_sizes;
+
+	/* The first clusters of the files
+	 */
+	uint32_t *file_clusters;
+
+	/* The first clusters of the directories, where index 0 is the root directory
+	 */
+	uint32_t *directory_clusters;
+
+	/* The number of clusters of the directories, where index 0 is the root directory
+	 */
+	uint32_t *directory_sizes;
+
+	/* The number of clusters in the cluster heap
+	 */
+	uint32_t number_of_clusters;
+
+	/* The allocation table, contains number of clusters + 2 entries
+	 */
+	uint32_t *allocation_table;
+
+	/* The clusters in allocation order
+	 */
+	uint32_t *allocation_order;
+
+	/* The index of the next cluster in allocation order
+	 */
+	uint32_t allocation_index;
+
+	/* The number of reserved sectors
+	 */
+	uint32_t number_of_reserved_sectors;
+
+	/* The number of allocation tables
+	 */
+	uint8_t number_of_allocation_tables;
+
+	/* The allocation table size in sectors
+	 */
+	uint32_t allocation_table_size;
+
+	/* The number of FAT-12 or FAT-16 root directory entries
+	 */
+	uint32_t number_of_root_directory_entries;
+
+	/* The offset of the first cluster
+	 */
+	off64_t first_cluster_offset;
+
+	/* The total number of sectors
+	 */
+	uint64_t total_number_of_sectors;
+
+	/* The exFAT allocation bitmap cluster
+	 */
+	uint32_t bitmap_cluster;
+
+	/* The exFAT allocation bitmap size
+	 */
+	uint64_t bitmap_size;
+
+	/* The exFAT upcase table cluster
+	 */
+	uint32_t upcase_table_cluster;
+
+	/* The pseudo random number generator state used for the layout
+	 */
+	uint64_t random_state;
+
+	/* The output stream
+	 */
+	FILE *stream;
+};
+
+/* Retrieves the next pseudo random number
+ * This uses xorshift64 to keep results reproducible across platforms
+ */
+uint64_t fsfat_generate_get_random(
+          uint64_t *random_state )
+{
+	uint64_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Derives a pseudo random number generator state from the seed, a salt and an index
+ * This uses the splitmix64 finalizer so nearby indexes give unrelated streams
+ */
+uint64_t fsfat_generate_get_random_state(
+          uint64_t seed,
+          uint64_t salt,
+          uint64_t index )
+{
+	uint64_t value = seed ^ ( salt << 32 );
+
+	value += ( index + 1 ) * 0x9e3779b97f4a7c15ULL;
+	value  = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	value  = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebULL;
+	value ^= value >> 31;
+
+	if( value == 0 )
+	{
+		value = 0x2545f4914f6cdd1dULL;
+	}
+	return( value );
+}
+
+/* Determines the end of chain value of the allocation table
+ */
+uint32_t fsfat_generate_get_end_of_chain(
+          fsfat_generate_image_t *image )
+{
+	switch( image->file_system_format )
+	{
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
+			return( 0x00000fffUL );
+
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16:
+			return( 0x0000ffffUL );
+
+		case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32:
+			return( 0x0fffffffUL );
+
+		default:
+			break;
+	}
+	return( 0xffffffffUL );
+}
+
+/* Determines the offset of a cluster
+ */
+off64_t fsfat_generate_get_cluster_offset(
+         fsfat_generate_image_t *image,
+         uint32_t cluster_number )
+{
+	return( image->first_cluster_offset + ( (off64_t) ( cluster_number - 2 ) * (off64_t) image->cluster_block_size ) );
+}
+
+/* Determines the name of a file or directory
+ * The short name consists of 11 bytes, the long name is ASCII and not terminated
+ */
+void fsfat_generate_get_name(
+      fsfat_generate_image_t *image,
+      uint8_t is_directory,
+      uint64_t index,
+      uint8_t *short_name,
+      uint8_t *long_name,
+      size_t *long_name_length )
+{
+	static const char *alphabet  = "abcdefghijklmnopqrstuvwxyz0123456789-_";
+	static const char *hex_digits = "0123456789abcdef";
+
+	uint64_t random_state        = 0;
+	size_t name_index            = 0;
+	uint8_t digit                = 0;
+
+	short_name[ 0 ] = ( is_directory != 0 ) ? 'D' : 'F';
+
+	for( name_index = 7;
+	     name_index > 0;
+	     name_index-- )
+	{
+		digit = (uint8_t) ( ( index >> ( ( 7 - name_index ) * 4 ) ) & 0x0f );
+
+		short_name[ name_index ] = (uint8_t) hex_digits[ digit ];
+
+		if( ( short_name[ name_index ] >= 'a' )
+		 && ( short_name[ name_index ] <= 'f' ) )
+		{
+			short_name[ name_index ] -= 'a' - 'A';
+		}
+	}
+	if( is_directory != 0 )
+	{
+		short_name[ 8 ]  = ' ';
+		short_name[ 9 ]  = ' ';
+		short_name[ 10 ] = ' ';
+	}
+	else
+	{
+		short_name[ 8 ]  = 'D';
+		short_name[ 9 ]  = 'A';
+		short_name[ 10 ] = 'T';
+	}
+	*long_name_length = 0;
+
+	if( image->long_name_length > 0 )
+	{
+		random_state = fsfat_generate_get_random_state(
+		                image->seed,
+		                FSFAT_GENERATE_SALT_NAME,
+		                ( index << 1 ) | is_directory );
+
+		for( name_index = 0;
+		     name_index < 8;
+		     name_index++ )
+		{
+			long_name[ name_index ] = short_name[ name_index ];
+
+			if( ( long_name[ name_index ] >= 'A' )
+			 && ( long_name[ name_index ] <= 'Z' ) )
+			{
+				long_name[ name_index ] += 'a' - 'A';
+			}
+		}
+		long_name[ name_index++ ] = '_';
+
+		while( name_index < (size_t) image->long_name_length )
+		{
+			long_name[ name_index++ ] = (uint8_t) alphabet[ fsfat_generate_get_random( &random_state ) % 38 ];
+		}
+		*long_name_length = name_index;
+	}
+	else if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		/* exFAT has no short names so the 8.3 name is stored as the name
+		 */
+		for( name_index = 0;
+		     name_index < 8;
+		     name_index++ )
+		{
+			long_name[ name_index ] = short_name[ name_index ];
+		}
+		if( is_directory == 0 )
+		{
+			long_name[ name_index++ ] = '.';
+			long_name[ name_index++ ] = short_name[ 8 ];
+			long_name[ name_index++ ] = short_name[ 9 ];
+			long_name[ name_index++ ] = short_name[ 10 ];
+		}
+		*long_name_length = name_index;
+	}
+}
+
+/* Determines the number of directory entries used by a file or directory
+ */
+uint64_t fsfat_generate_get_number_of_entries(
+          fsfat_generate_image_t *image,
+          uint8_t is_directory )
+{
+	uint64_t name_length = image->long_name_length;
+
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		if( name_length == 0 )
+		{
+			name_length = ( is_directory != 0 ) ? 8 : 12;
+		}
+		/* File, data stream and name entries
+		 */
+		return( 2 + ( ( name_length + 14 ) / 15 ) );
+	}
+	/* Short name and VFAT long name entries
+	 */
+	return( 1 + ( ( name_length + 12 ) / 13 ) );
+}
+
+/* Retrieves the index of the first sub directory of a directory
+ * Directory index 0 is the root directory, index i + 1 is directory i
+ * Returns 1 if available or 0 if not
+ */
+int fsfat_generate_get_first_sub_directory(
+     fsfat_generate_image_t *image,
+     uint64_t directory_index,
+     uint64_t *sub_directory_index )
+{
+	if( image->number_of_directories == 0 )
+	{
+		return( 0 );
+	}
+	if( directory_index == 0 )
+	{
+		*sub_directory_index = 1;
+
+		return( 1 );
+	}
+	/* Directories are nested in chains of depth directories
+	 */
+	if( ( ( directory_index % image->depth ) == 0 )
+	 || ( directory_index >= image->number_of_directories ) )
+	{
+		return( 0 );
+	}
+	*sub_directory_index = directory_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the next sub directory of the same parent directory
+ * Returns 1 if available or 0 if not
+ */
+int fsfat_generate_get_next_sub_directory(
+     fsfat_generate_image_t *image,
+     uint64_t directory_index,
+     uint64_t *sub_directory_index )
+{
+	/* Only the root directory has multiple sub directories
+	 */
+	if( ( ( ( directory_index - 1 ) % image->depth ) != 0 )
+	 || ( ( directory_index + image->depth ) > image->number_of_directories ) )
+	{
+		return( 0 );
+	}
+	*sub_directory_index = directory_index + image->depth;
+
+	return( 1 );
+}
+
+/* Retrieves the parent directory index of a directory
+ */
+uint64_t fsfat_generate_get_parent_directory(
+          fsfat_generate_image_t *image,
+          uint64_t directory_index )
+{
+	if( ( ( directory_index - 1 ) % image->depth ) == 0 )
+	{
+		return( 0 );
+	}
+	return( directory_index - 1 );
+}
+
+/* Retrieves the range of files in a directory
+ */
+void fsfat_generate_get_files(
+      fsfat_generate_image_t *image,
+      uint64_t directory_index,
+      uint64_t *first_file_index,
+      uint64_t *number_of_files )
+{
+	*first_file_index = 0;
+	*number_of_files  = 0;
+
+	if( image->depth == 0 )
+	{
+		if( directory_index == 0 )
+		{
+			*number_of_files = image->number_of_files;
+		}
+		return;
+	}
+	if( directory_index == 0 )
+	{
+		return;
+	}
+	*first_file_index = ( directory_index - 1 ) * image->maximum_files_per_directory;
+
+	if( *first_file_index < image->number_of_files )
+	{
+		*number_of_files = image->number_of_files - *first_file_index;
+
+		if( *number_of_files > image->maximum_files_per_directory )
+		{
+			*number_of_files = image->maximum_files_per_directory;
+		}
+	}
+}
+
+/* Determines the number of directory entries in a directory
+ */
+uint64_t fsfat_generate_get_directory_number_of_entries(
+          fsfat_generate_image_t *image,
+          uint64_t directory_index )
+{
+	uint64_t first_file_index    = 0;
+	uint64_t number_of_entries   = 0;
+	uint64_t number_of_files     = 0;
+	uint64_t sub_directory_index = 0;
+	int result                   = 0;
+
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		/* The volume label, allocation bitmap and upcase table entries
+		 */
+		if( directory_index == 0 )
+		{
+			number_of_entries += 3;
+		}
+	}
+	else if( directory_index == 0 )
+	{
+		/* The volume label entry
+		 */
+		number_of_entries += 1;
+	}
+	else
+	{
+		/* The self and parent entries
+		 */
+		number_of_entries += 2;
+	}
+	result = fsfat_generate_get_first_sub_directory(
+	          image,
+	          directory_index,
+	          &sub_directory_index );
+
+	while( result != 0 )
+	{
+		number_of_entries += fsfat_generate_get_number_of_entries(
+		                      image,
+		                      1 );
+
+		if( directory_index != 0 )
+		{
+			break;
+		}
+		result = fsfat_generate_get_next_sub_directory(
+		          image,
+		          sub_directory_index,
+		          &sub_directory_index );
+	}
+	fsfat_generate_get_files(
+	 image,
+	 directory_index,
+	 &first_file_index,
+	 &number_of_files );
+
+	number_of_entries += number_of_files * fsfat_generate_get_number_of_entries(
+	                                        image,
+	                                        0 );
+
+	return( number_of_entries );
+}
+
+/* Allocates a cluster chain
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_allocate_chain(
+     fsfat_generate_image_t *image,
+     uint64_t number_of_clusters,
+     uint32_t *first_cluster,
+     libcerror_error_t **error )
+{
+	static char *function  = "fsfat_generate_allocate_chain";
+	uint32_t cluster_number = 0;
+	uint32_t last_cluster  = 0;
+	uint64_t cluster_index = 0;
+
+	*first_cluster = 0;
+
+	if( number_of_clusters > (uint64_t) ( image->number_of_clusters - image->allocation_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: insufficient free clusters.",
+		 function );
+
+		return( -1 );
+	}
+	for( cluster_index = 0;
+	     cluster_index < number_of_clusters;
+	     cluster_index++ )
+	{
+		cluster_number = image->allocation_order[ image->allocation_index++ ];
+
+		if( last_cluster == 0 )
+		{
+			*first_cluster = cluster_number;
+		}
+		else
+		{
+			image->allocation_table[ last_cluster ] = cluster_number;
+		}
+		image->allocation_table[ cluster_number ] = 0xffffffffUL;
+
+		last_cluster = cluster_number;
+	}
+	return( 1 );
+}
+
+/* Determines the layout of the image
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_layout(
+     fsfat_generate_image_t *image,
+     libcerror_error_t **error )
+{
+	static char *function                 = "fsfat_generate_layout";
+	uint64_t allocation_table_data_size   = 0;
+	uint64_t bitmap_clusters              = 0;
+	uint64_t cluster_index                = 0;
+	uint64_t directory_index              = 0;
+	uint64_t file_index                   = 0;
+	uint64_t maximum_number_of_clusters   = 0;
+	uint64_t minimum_number_of_clusters   = 0;
+	uint64_t number_of_clusters           = 0;
+	uint64_t number_of_entries            = 0;
+	uint64_t previous_bitmap_clusters     = 0;
+	uint64_t random_state                 = 0;
+	uint64_t root_directory_sectors       = 0;
+	uint64_t sectors_per_cluster_block    = 0;
+	uint64_t swap_index                   = 0;
+	uint32_t cluster_number               = 0;
+
+	sectors_per_cluster_block = image->cluster_block_size / FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+	if( image->depth > 0 )
+	{
+		image->number_of_directories = ( image->number_of_files + image->maximum_files_per_directory - 1 ) / image->maximum_files_per_directory;
+	}
+	if( image->number_of_directories > FSFAT_GENERATE_MAXIMUM_NUMBER_OF_ITEMS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directories value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( image->number_of_files > 0 )
+	{
+		image->file_sizes = (uint64_t *) memory_allocate(
+		                                  sizeof( uint64_t ) * image->number_of_files );
+
+		image->file_clusters = (uint32_t *) memory_allocate(
+		                                     sizeof( uint32_t ) * image->number_of_files );
+
+		if( ( image->file_sizes == NULL )
+		 || ( image->file_clusters == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create files.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	image->directory_clusters = (uint32_t *) memory_allocate(
+	                                          sizeof( uint32_t ) * ( image->number_of_directories + 1 ) );
+
+	image->directory_sizes = (uint32_t *) memory_allocate(
+	                                       sizeof( uint32_t ) * ( image->number_of_directories + 1 ) );
+
+	if( ( image->directory_clusters == NULL )
+	 || ( image->directory_sizes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directories.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the number of clusters used by the files and directories
+	 */
+	for( file_index = 0;
+	     file_index < image->number_of_files;
+	     file_index++ )
+	{
+		random_state = fsfat_generate_get_random_state(
+		                image->seed,
+		                FSFAT_GENERATE_SALT_DATA,
+		                file_index );
+
+		image->file_sizes[ file_index ] = fsfat_generate_get_random(
+		                                   &random_state ) % ( image->maximum_file_size + 1 );
+
+		image->file_clusters[ file_index ] = 0;
+
+		number_of_clusters += ( image->file_sizes[ file_index ] + image->cluster_block_size - 1 ) / image->cluster_block_size;
+	}
+	for( directory_index = 0;
+	     directory_index <= image->number_of_directories;
+	     directory_index++ )
+	{
+		number_of_entries = fsfat_generate_get_directory_number_of_entries(
+		                     image,
+		                     directory_index );
+
+		image->directory_clusters[ directory_index ] = 0;
+		image->directory_sizes[ directory_index ]    = (uint32_t) ( ( ( number_of_entries * 32 ) + image->cluster_block_size - 1 ) / image->cluster_block_size );
+
+		if( ( directory_index == 0 )
+		 && ( ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12 )
+		  ||  ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16 ) ) )
+		{
+			/* The FAT-12 and FAT-16 root directory is stored outside the cluster heap
+			 */
+			image->number_of_root_directory_entries = (uint32_t) ( ( number_of_entries + 15 ) & ~( (uint64_t) 15 ) );
+
+			if( image->number_of_root_directory_entries < 512 )
+			{
+				image->number_of_root_directory_entries = 512;
+			}
+			if( number_of_entries > 0xfff0UL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: too many entries in root directory, use a depth of 1 or more.",
+				 function );
+
+				goto on_error;
+			}
+			image->directory_sizes[ 0 ] = 0;
+
+			continue;
+		}
+		number_of_clusters += image->directory_sizes[ directory_index ];
+	}
+	/* Determine the geometry
+	 */
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		/* The upcase table fits in a single cluster
+		 */
+		number_of_clusters += 1;
+
+		do
+		{
+			previous_bitmap_clusters = bitmap_clusters;
+
+			bitmap_clusters = ( ( ( number_of_clusters + bitmap_clusters + 7 ) / 8 ) + image->cluster_block_size - 1 ) / image->cluster_block_size;
+		}
+		while( bitmap_clusters != previous_bitmap_clusters );
+
+		number_of_clusters += bitmap_clusters;
+
+		if( number_of_clusters > (uint64_t) 0xfffffff5UL - 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: too many clusters, use a larger cluster block size.",
+			 function );
+
+			goto on_error;
+		}
+		image->bitmap_size                 = ( number_of_clusters + 7 ) / 8;
+		image->number_of_reserved_sectors  = 2 * FSFAT_GENERATE_EXFAT_BOOT_REGION_SIZE;
+		image->number_of_allocation_tables = 1;
+		image->allocation_table_size       = (uint32_t) ( ( ( ( number_of_clusters + 2 ) * 4 ) + FSFAT_GENERATE_BYTES_PER_SECTOR - 1 ) / FSFAT_GENERATE_BYTES_PER_SECTOR );
+
+		/* Align the cluster heap to the cluster block size
+		 */
+		image->first_cluster_offset = (off64_t) ( ( ( image->number_of_reserved_sectors + image->allocation_table_size + sectors_per_cluster_block - 1 ) / sectors_per_cluster_block ) * sectors_per_cluster_block );
+	}
+	else
+	{
+		switch( image->file_system_format )
+		{
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
+				minimum_number_of_clusters = 1;
+				maximum_number_of_clusters = 0x0ff0UL - 2;
+				break;
+
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16:
+				minimum_number_of_clusters = 4085;
+				maximum_number_of_clusters = 0xfff0UL - 2;
+				break;
+
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32:
+				minimum_number_of_clusters = 65525;
+				maximum_number_of_clusters = 0x0ffffff0UL - 2;
+				break;
+		}
+		root_directory_sectors = ( (uint64_t) image->number_of_root_directory_entries * 32 ) / FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+		if( number_of_clusters < minimum_number_of_clusters )
+		{
+			number_of_clusters = minimum_number_of_clusters;
+		}
+		/* libfsfat does not subtract the root directory sectors when determining the format
+		 */
+		if( ( number_of_clusters > maximum_number_of_clusters )
+		 || ( ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12 )
+		  &&  ( ( number_of_clusters + ( root_directory_sectors / sectors_per_cluster_block ) ) >= 4085 ) )
+		 || ( ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16 )
+		  &&  ( ( number_of_clusters + ( root_directory_sectors / sectors_per_cluster_block ) ) >= 65525 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: too many clusters for format, use a larger cluster block size or another format.",
+			 function );
+
+			goto on_error;
+		}
+		switch( image->file_system_format )
+		{
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
+				allocation_table_data_size = ( ( number_of_clusters + 2 ) * 3 + 1 ) / 2;
+				break;
+
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16:
+				allocation_table_data_size = ( number_of_clusters + 2 ) * 2;
+				break;
+
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32:
+				allocation_table_data_size = ( number_of_clusters + 2 ) * 4;
+				break;
+		}
+		image->number_of_reserved_sectors  = ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32 ) ? 32 : 1;
+		image->number_of_allocation_tables = 2;
+		image->allocation_table_size       = (uint32_t) ( ( allocation_table_data_size + FSFAT_GENERATE_BYTES_PER_SECTOR - 1 ) / FSFAT_GENERATE_BYTES_PER_SECTOR );
+		image->first_cluster_offset        = (off64_t) ( image->number_of_reserved_sectors + ( image->number_of_allocation_tables * image->allocation_table_size ) + root_directory_sectors );
+	}
+	image->number_of_clusters      = (uint32_t) number_of_clusters;
+	image->total_number_of_sectors = (uint64_t) image->first_cluster_offset + ( number_of_clusters * sectors_per_cluster_block );
+	image->first_cluster_offset   *= FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+	/* Allocate the clusters
+	 */
+	image->allocation_table = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * ( number_of_clusters + 2 ) );
+
+	image->allocation_order = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * number_of_clusters );
+
+	if( ( image->allocation_table == NULL )
+	 || ( image->allocation_order == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     image->allocation_table,
+	     0,
+	     sizeof( uint32_t ) * ( number_of_clusters + 2 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation table.",
+		 function );
+
+		goto on_error;
+	}
+	for( cluster_index = 0;
+	     cluster_index < number_of_clusters;
+	     cluster_index++ )
+	{
+		image->allocation_order[ cluster_index ] = (uint32_t) ( cluster_index + 2 );
+	}
+	image->allocation_index = 0;
+
+	/* The file system metadata is allocated contiguously at the start of the cluster heap
+	 */
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		if( fsfat_generate_allocate_chain(
+		     image,
+		     bitmap_clusters,
+		     &( image->bitmap_cluster ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fsfat_generate_allocate_chain(
+		     image,
+		     1,
+		     &( image->upcase_table_cluster ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( image->directory_sizes[ 0 ] > 0 )
+	{
+		if( fsfat_generate_allocate_chain(
+		     image,
+		     image->directory_sizes[ 0 ],
+		     &( image->directory_clusters[ 0 ] ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* Fragment the remaining clusters by swapping them with a random later cluster
+	 */
+	if( image->fragmentation > 0 )
+	{
+		random_state = fsfat_generate_get_random_state(
+		                image->seed,
+		                FSFAT_GENERATE_SALT_LAYOUT,
+		                0 );
+
+		for( cluster_index = image->allocation_index;
+		     cluster_index < number_of_clusters;
+		     cluster_index++ )
+		{
+			if( ( fsfat_generate_get_random( &random_state ) % 100 ) >= image->fragmentation )
+			{
+				continue;
+			}
+			swap_index = cluster_index + ( fsfat_generate_get_random( &random_state ) % ( number_of_clusters - cluster_index ) );
+
+			cluster_number                          = image->allocation_order[ swap_index ];
+			image->allocation_order[ swap_index ]    = image->allocation_order[ cluster_index ];
+			image->allocation_order[ cluster_index ] = cluster_number;
+		}
+	}
+	/* Each directory is followed by its files
+	 */
+	for( directory_index = 0;
+	     directory_index <= image->number_of_directories;
+	     directory_index++ )
+	{
+		if( directory_index > 0 )
+		{
+			if( fsfat_generate_allocate_chain(
+			     image,
+			     image->directory_sizes[ directory_index ],
+			     &( image->directory_clusters[ directory_index ] ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		fsfat_generate_get_files(
+		 image,
+		 directory_index,
+		 &file_index,
+		 &number_of_entries );
+
+		for( cluster_index = 0;
+		     cluster_index < number_of_entries;
+		     cluster_index++ )
+		{
+			if( fsfat_generate_allocate_chain(
+			     image,
+			     ( image->file_sizes[ file_index ] + image->cluster_block_size - 1 ) / image->cluster_block_size,
+			     &( image->file_clusters[ file_index ] ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			file_index++;
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Writes data at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write_at_offset(
+     fsfat_generate_image_t *image,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_generate_write_at_offset";
+
+	if( file_stream_seek_offset(
+	     image->stream,
+	     offset,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     image->stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data at offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data to a cluster chain
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write_chain(
+     fsfat_generate_image_t *image,
+     uint32_t first_cluster,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	size_t data_offset      = 0;
+	size_t write_size       = 0;
+	uint32_t cluster_number = first_cluster;
+
+	while( data_offset < data_size )
+	{
+		write_size = data_size - data_offset;
+
+		if( write_size > (size_t) image->cluster_block_size )
+		{
+			write_size = (size_t) image->cluster_block_size;
+		}
+		if( fsfat_generate_write_at_offset(
+		     image,
+		     &( data[ data_offset ] ),
+		     write_size,
+		     fsfat_generate_get_cluster_offset(
+		      image,
+		      cluster_number ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		data_offset   += write_size;
+		cluster_number = image->allocation_table[ cluster_number ];
+	}
+	return( 1 );
+}
+
+/* Sets a FAT date and time from a pseudo random number
+ */
+void fsfat_generate_set_date_time(
+      uint8_t *date,
+      uint8_t *time,
+      uint64_t random_value )
+{
+	uint16_t value_16bit = 0;
+
+	/* Dates between 1990 and 2029
+	 */
+	value_16bit = (uint16_t) ( ( ( 10 + ( random_value % 40 ) ) << 9 )
+	            | ( ( 1 + ( ( random_value >> 8 ) % 12 ) ) << 5 )
+	            | ( 1 + ( ( random_value >> 16 ) % 28 ) ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 date,
+	 value_16bit );
+
+	value_16bit = (uint16_t) ( ( ( ( random_value >> 24 ) % 24 ) << 11 )
+	            | ( ( ( random_value >> 32 ) % 60 ) << 5 )
+	            | ( ( random_value >> 40 ) % 30 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 time,
+	 value_16bit );
+}
+
+/* Sets a FAT short name directory entry
+ */
+void fsfat_generate_set_short_name_entry(
+      uint8_t *entry_data,
+      const uint8_t *short_name,
+      uint8_t file_attribute_flags,
+      uint32_t data_start_cluster,
+      uint32_t data_size,
+      uint64_t random_value )
+{
+	fsfat_directory_entry_t *directory_entry = (fsfat_directory_entry_t *) entry_data;
+
+	memory_copy(
+	 directory_entry->name,
+	 short_name,
+	 8 );
+
+	memory_copy(
+	 directory_entry->extension,
+	 &( short_name[ 8 ] ),
+	 3 );
+
+	directory_entry->file_attribute_flags = file_attribute_flags;
+
+	fsfat_generate_set_date_time(
+	 directory_entry->creation_date,
+	 directory_entry->creation_time,
+	 random_value );
+
+	fsfat_generate_set_date_time(
+	 directory_entry->modification_date,
+	 directory_entry->modification_time,
+	 random_value >> 3 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 directory_entry->access_date,
+	 ( ( 10 + ( ( random_value >> 5 ) % 40 ) ) << 9 ) | ( 1 << 5 ) | 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 directory_entry->data_start_cluster_upper,
+	 (uint16_t) ( data_start_cluster >> 16 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 directory_entry->data_start_cluster,
+	 (uint16_t) ( data_start_cluster & 0x0000ffffUL ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 directory_entry->data_size,
+	 data_size );
+}
+
+/* Sets the FAT VFAT long name directory entries
+ * Returns the number of entries set
+ */
+size_t fsfat_generate_set_vfat_entries(
+        uint8_t *entries_data,
+        const uint8_t *short_name,
+        const uint8_t *long_name,
+        size_t long_name_length )
+{
+	fsfat_directory_entry_vfat_t *vfat_entry = NULL;
+	uint8_t *segment                         = NULL;
+	size_t character_index                   = 0;
+	size_t entry_index                       = 0;
+	size_t name_index                        = 0;
+	size_t number_of_entries                 = 0;
+	uint16_t character                       = 0;
+	uint8_t checksum                         = 0;
+
+	for( name_index = 0;
+	     name_index < 11;
+	     name_index++ )
+	{
+		checksum = (uint8_t) ( ( ( checksum & 1 ) << 7 ) + ( checksum >> 1 ) + short_name[ name_index ] );
+	}
+	number_of_entries = ( long_name_length + 12 ) / 13;
+
+	/* The entries are stored in reverse order, the last entry first
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		vfat_entry = (fsfat_directory_entry_vfat_t *) &( entries_data[ ( number_of_entries - entry_index - 1 ) * 32 ] );
+
+		vfat_entry->sequence_number = (uint8_t) ( entry_index + 1 );
+
+		if( entry_index == ( number_of_entries - 1 ) )
+		{
+			vfat_entry->sequence_number |= 0x40;
+		}
+		vfat_entry->unknown1      = 0x0f;
+		vfat_entry->name_checksum = checksum;
+
+		for( character_index = 0;
+		     character_index < 13;
+		     character_index++ )
+		{
+			name_index = ( entry_index * 13 ) + character_index;
+
+			if( name_index < long_name_length )
+			{
+				character = long_name[ name_index ];
+			}
+			else if( name_index == long_name_length )
+			{
+				character = 0x0000;
+			}
+			else
+			{
+				character = 0xffff;
+			}
+			if( character_index < 5 )
+			{
+				segment = &( vfat_entry->first_name_segment[ character_index * 2 ] );
+			}
+			else if( character_index < 11 )
+			{
+				segment = &( vfat_entry->second_name_segment[ ( character_index - 5 ) * 2 ] );
+			}
+			else
+			{
+				segment = &( vfat_entry->third_name_segment[ ( character_index - 11 ) * 2 ] );
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 segment,
+			 character );
+		}
+	}
+	return( number_of_entries );
+}
+
+/* Sets the exFAT file, data stream and name directory entries
+ * Returns the number of entries set
+ */
+size_t fsfat_generate_set_exfat_entries(
+        uint8_t *entries_data,
+        const uint8_t *name,
+        size_t name_length,
+        uint16_t file_attribute_flags,
+        uint32_t data_start_cluster,
+        uint64_t data_size,
+        uint64_t random_value )
+{
+	fsfat_directory_entry_exfat_data_stream_t *data_stream_entry = NULL;
+	fsfat_directory_entry_exfat_file_entry_t *file_entry         = NULL;
+	fsfat_directory_entry_exfat_file_entry_name_t *name_entry    = NULL;
+	size_t byte_index                                            = 0;
+	size_t entry_index                                           = 0;
+	size_t name_index                                            = 0;
+	size_t number_of_entries                                     = 0;
+	uint16_t character                                           = 0;
+	uint16_t checksum                                            = 0;
+	uint16_t name_hash                                           = 0;
+
+	number_of_entries = 2 + ( ( name_length + 14 ) / 15 );
+
+	file_entry = (fsfat_directory_entry_exfat_file_entry_t *) entries_data;
+
+	file_entry->entry_type = 0x85;
+	file_entry->unknown1   = (uint8_t) ( number_of_entries - 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 file_entry->file_attribute_flags,
+	 file_attribute_flags );
+
+	fsfat_generate_set_date_time(
+	 file_entry->creation_date,
+	 file_entry->creation_time,
+	 random_value );
+
+	fsfat_generate_set_date_time(
+	 file_entry->modification_date,
+	 file_entry->modification_time,
+	 random_value >> 3 );
+
+	fsfat_generate_set_date_time(
+	 file_entry->access_date,
+	 file_entry->access_time,
+	 random_value >> 5 );
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		character = name[ name_index ];
+
+		/* The name hash is calculated over the upper case name
+		 */
+		if( ( character >= 'a' )
+		 && ( character <= 'z' ) )
+		{
+			character -= 'a' - 'A';
+		}
+		name_hash = (uint16_t) ( ( ( name_hash & 1 ) ? 0x8000 : 0 ) + ( name_hash >> 1 ) + ( character & 0xff ) );
+		name_hash = (uint16_t) ( ( ( name_hash & 1 ) ? 0x8000 : 0 ) + ( name_hash >> 1 ) + ( character >> 8 ) );
+	}
+	data_stream_entry = (fsfat_directory_entry_exfat_data_stream_t *) &( entries_data[ 32 ] );
+
+	data_stream_entry->entry_type = 0xc0;
+
+	/* Allocation possible
+	 */
+	data_stream_entry->unknown1  = 0x01;
+	data_stream_entry->name_size = (uint8_t) name_length;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 data_stream_entry->name_hash,
+	 name_hash );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 data_stream_entry->valid_data_size,
+	 data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_stream_entry->data_start_cluster,
+	 data_start_cluster );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 data_stream_entry->data_size,
+	 data_size );
+
+	for( entry_index = 2;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		name_entry = (fsfat_directory_entry_exfat_file_entry_name_t *) &( entries_data[ entry_index * 32 ] );
+
+		name_entry->entry_type = 0xc1;
+
+		for( byte_index = 0;
+		     byte_index < 15;
+		     byte_index++ )
+		{
+			name_index = ( ( entry_index - 2 ) * 15 ) + byte_index;
+
+			if( name_index >= name_length )
+			{
+				break;
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( name_entry->name[ byte_index * 2 ] ),
+			 (uint16_t) name[ name_index ] );
+		}
+	}
+	/* The set checksum is calculated over all entries of the set except for the checksum itself
+	 */
+	for( byte_index = 0;
+	     byte_index < ( number_of_entries * 32 );
+	     byte_index++ )
+	{
+		if( ( byte_index == 2 )
+		 || ( byte_index == 3 ) )
+		{
+			continue;
+		}
+		checksum = (uint16_t) ( ( ( checksum & 1 ) ? 0x8000 : 0 ) + ( checksum >> 1 ) + entries_data[ byte_index ] );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 file_entry->unknown2,
+	 checksum );
+
+	return( number_of_entries );
+}
+
+/* Sets the directory entries of a file or directory
+ * Returns the number of entries set
+ */
+size_t fsfat_generate_set_entries(
+        fsfat_generate_image_t *image,
+        uint8_t *entries_data,
+        uint8_t is_directory,
+        uint64_t index,
+        uint32_t data_start_cluster,
+        uint64_t data_size )
+{
+	uint8_t long_name[ FSFAT_GENERATE_MAXIMUM_NAME_LENGTH ];
+	uint8_t short_name[ 11 ];
+
+	size_t long_name_length   = 0;
+	size_t number_of_entries  = 0;
+	uint64_t random_value     = 0;
+	uint8_t file_attribute_flags = LIBFSFAT_FILE_ATTRIBUTE_FLAG_ARCHIVE;
+
+	if( is_directory != 0 )
+	{
+		file_attribute_flags = LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY;
+	}
+	fsfat_generate_get_name(
+	 image,
+	 is_directory,
+	 index,
+	 short_name,
+	 long_name,
+	 &long_name_length );
+
+	random_value = fsfat_generate_get_random_state(
+	                image->seed,
+	                FSFAT_GENERATE_SALT_NAME,
+	                ( index << 1 ) | is_directory );
+
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		return( fsfat_generate_set_exfat_entries(
+		         entries_data,
+		         long_name,
+		         long_name_length,
+		         (uint16_t) file_attribute_flags,
+		         data_start_cluster,
+		         data_size,
+		         random_value ) );
+	}
+	if( long_name_length > 0 )
+	{
+		number_of_entries = fsfat_generate_set_vfat_entries(
+		                     entries_data,
+		                     short_name,
+		                     long_name,
+		                     long_name_length );
+	}
+	fsfat_generate_set_short_name_entry(
+	 &( entries_data[ number_of_entries * 32 ] ),
+	 short_name,
+	 file_attribute_flags,
+	 data_start_cluster,
+	 ( is_directory != 0 ) ? 0 : (uint32_t) data_size,
+	 random_value );
+
+	return( number_of_entries + 1 );
+}
+
+/* Writes a directory
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write_directory(
+     fsfat_generate_image_t *image,
+     uint64_t directory_index,
+     libcerror_error_t **error )
+{
+	uint8_t *directory_data                                            = NULL;
+	fsfat_directory_entry_exfat_allocation_bitmap_t *allocation_bitmap = NULL;
+	fsfat_directory_entry_exfat_volume_label_t *volume_label           = NULL;
+	static char *function                                              = "fsfat_generate_write_directory";
+	static const char *label                                           = "FSFATGEN   ";
+	size_t directory_data_size                                         = 0;
+	size_t entry_offset                                                = 0;
+	uint64_t file_index                                                = 0;
+	uint64_t number_of_files                                           = 0;
+	uint64_t parent_directory_index                                    = 0;
+	uint64_t sub_directory_index                                       = 0;
+	uint32_t checksum                                                  = 0;
+	int label_index                                                    = 0;
+	int result                                                         = 0;
+	int upcase_index                                                   = 0;
+
+	if( image->directory_sizes[ directory_index ] == 0 )
+	{
+		directory_data_size = (size_t) image->number_of_root_directory_entries * 32;
+	}
+	else
+	{
+		directory_data_size = (size_t) image->directory_sizes[ directory_index ] * (size_t) image->cluster_block_size;
+	}
+	directory_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * directory_data_size );
+
+	if( directory_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     directory_data,
+	     0,
+	     directory_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory data.",
+		 function );
+
+		goto on_error;
+	}
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		if( directory_index == 0 )
+		{
+			volume_label = (fsfat_directory_entry_exfat_volume_label_t *) directory_data;
+
+			volume_label->entry_type = 0x83;
+			volume_label->name_size  = 8;
+
+			for( label_index = 0;
+			     label_index < 8;
+			     label_index++ )
+			{
+				volume_label->name[ label_index * 2 ] = (uint8_t) label[ label_index ];
+			}
+			allocation_bitmap = (fsfat_directory_entry_exfat_allocation_bitmap_t *) &( directory_data[ 32 ] );
+
+			allocation_bitmap->entry_type = 0x81;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 allocation_bitmap->data_start_cluster,
+			 image->bitmap_cluster );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 allocation_bitmap->data_size,
+			 image->bitmap_size );
+
+			/* The upcase table entry has the same layout as the allocation bitmap entry
+			 * with the table checksum stored at offset 4
+			 */
+			allocation_bitmap = (fsfat_directory_entry_exfat_allocation_bitmap_t *) &( directory_data[ 64 ] );
+
+			allocation_bitmap->entry_type = 0x82;
+
+			for( upcase_index = 0;
+			     upcase_index < FSFAT_GENERATE_EXFAT_UPCASE_TABLE_SIZE;
+			     upcase_index++ )
+			{
+				result = upcase_index;
+
+				if( ( result >= 'a' )
+				 && ( result <= 'z' ) )
+				{
+					result -= 'a' - 'A';
+				}
+				checksum = ( ( checksum & 1 ) ? 0x80000000UL : 0 ) + ( checksum >> 1 ) + (uint32_t) ( result & 0xff );
+				checksum = ( ( checksum & 1 ) ? 0x80000000UL : 0 ) + ( checksum >> 1 ) + (uint32_t) ( result >> 8 );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( allocation_bitmap->unknown1[ 2 ] ),
+			 checksum );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 allocation_bitmap->data_start_cluster,
+			 image->upcase_table_cluster );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 allocation_bitmap->data_size,
+			 (uint64_t) FSFAT_GENERATE_EXFAT_UPCASE_TABLE_SIZE * 2 );
+
+			entry_offset = 96;
+		}
+	}
+	else if( directory_index == 0 )
+	{
+		fsfat_generate_set_short_name_entry(
+		 directory_data,
+		 (const uint8_t *) label,
+		 LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL,
+		 0,
+		 0,
+		 0 );
+
+		entry_offset = 32;
+	}
+	else
+	{
+		parent_directory_index = fsfat_generate_get_parent_directory(
+		                          image,
+		                          directory_index );
+
+		fsfat_generate_set_short_name_entry(
+		 directory_data,
+		 (const uint8_t *) ".          ",
+		 LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+		 image->directory_clusters[ directory_index ],
+		 0,
+		 0 );
+
+		/* The parent of a top level directory is referenced as cluster 0
+		 */
+		fsfat_generate_set_short_name_entry(
+		 &( directory_data[ 32 ] ),
+		 (const uint8_t *) "..         ",
+		 LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY,
+		 ( parent_directory_index == 0 ) ? 0 : image->directory_clusters[ parent_directory_index ],
+		 0,
+		 0 );
+
+		entry_offset = 64;
+	}
+	result = fsfat_generate_get_first_sub_directory(
+	          image,
+	          directory_index,
+	          &sub_directory_index );
+
+	while( result != 0 )
+	{
+		entry_offset += 32 * fsfat_generate_set_entries(
+		                      image,
+		                      &( directory_data[ entry_offset ] ),
+		                      1,
+		                      sub_directory_index - 1,
+		                      image->directory_clusters[ sub_directory_index ],
+		                      (uint64_t) image->directory_sizes[ sub_directory_index ] * image->cluster_block_size );
+
+		if( directory_index != 0 )
+		{
+			break;
+		}
+		result = fsfat_generate_get_next_sub_directory(
+		          image,
+		          sub_directory_index,
+		          &sub_directory_index );
+	}
+	fsfat_generate_get_files(
+	 image,
+	 directory_index,
+	 &file_index,
+	 &number_of_files );
+
+	while( number_of_files > 0 )
+	{
+		entry_offset += 32 * fsfat_generate_set_entries(
+		                      image,
+		                      &( directory_data[ entry_offset ] ),
+		                      0,
+		                      file_index,
+		                      image->file_clusters[ file_index ],
+		                      image->file_sizes[ file_index ] );
+
+		file_index++;
+		number_of_files--;
+	}
+	if( image->directory_sizes[ directory_index ] == 0 )
+	{
+		result = fsfat_generate_write_at_offset(
+		          image,
+		          directory_data,
+		          directory_data_size,
+		          image->first_cluster_offset - (off64_t) directory_data_size,
+		          error );
+	}
+	else
+	{
+		result = fsfat_generate_write_chain(
+		          image,
+		          image->directory_clusters[ directory_index ],
+		          directory_data,
+		          directory_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write directory: %" PRIu64 ".",
+		 function,
+		 directory_index );
+
+		goto on_error;
+	}
+	memory_free(
+	 directory_data );
+
+	return( 1 );
+
+on_error:
+	if( directory_data != NULL )
+	{
+		memory_free(
+		 directory_data );
+	}
+	return( -1 );
+}
+
+/* Writes the file data
+ * The data of a file is derived from the seed and the file index so it can be verified
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write_files(
+     fsfat_generate_image_t *image,
+     libcerror_error_t **error )
+{
+	uint8_t *cluster_data   = NULL;
+	static char *function   = "fsfat_generate_write_files";
+	size_t data_offset      = 0;
+	size_t write_size       = 0;
+	uint64_t file_index     = 0;
+	uint64_t random_state   = 0;
+	uint64_t random_value   = 0;
+	uint64_t remaining_size = 0;
+	uint32_t cluster_number = 0;
+
+	cluster_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * image->cluster_block_size );
+
+	if( cluster_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cluster data.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < image->number_of_files;
+	     file_index++ )
+	{
+		random_state = fsfat_generate_get_random_state(
+		                image->seed,
+		                FSFAT_GENERATE_SALT_DATA,
+		                file_index );
+
+		/* The first value was used to determine the file size
+		 */
+		fsfat_generate_get_random(
+		 &random_state );
+
+		cluster_number = image->file_clusters[ file_index ];
+		remaining_size = image->file_sizes[ file_index ];
+
+		while( remaining_size > 0 )
+		{
+			write_size = (size_t) image->cluster_block_size;
+
+			if( (uint64_t) write_size > remaining_size )
+			{
+				write_size = (size_t) remaining_size;
+			}
+			for( data_offset = 0;
+			     data_offset < write_size;
+			     data_offset += 8 )
+			{
+				random_value = fsfat_generate_get_random(
+				                &random_state );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 &( cluster_data[ data_offset ] ),
+				 random_value );
+			}
+			if( fsfat_generate_write_at_offset(
+			     image,
+			     cluster_data,
+			     write_size,
+			     fsfat_generate_get_cluster_offset(
+			      image,
+			      cluster_number ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data of file: %" PRIu64 ".",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			remaining_size -= write_size;
+			cluster_number  = image->allocation_table[ cluster_number ];
+		}
+	}
+	memory_free(
+	 cluster_data );
+
+	return( 1 );
+
+on_error:
+	if( cluster_data != NULL )
+	{
+		memory_free(
+		 cluster_data );
+	}
+	return( -1 );
+}
+
+/* Writes the allocation tables and for exFAT the allocation bitmap and upcase table
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write_allocation_tables(
+     fsfat_generate_image_t *image,
+     libcerror_error_t **error )
+{
+	uint8_t *data                  = NULL;
+	static char *function          = "fsfat_generate_write_allocation_tables";
+	size_t data_offset             = 0;
+	size_t data_size               = 0;
+	uint64_t cluster_index         = 0;
+	uint32_t end_of_chain          = 0;
+	uint32_t value_32bit           = 0;
+	uint8_t allocation_table_index = 0;
+	int upcase_index               = 0;
+
+	data_size = (size_t) image->allocation_table_size * FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+	if( ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	 && ( data_size < (size_t) image->bitmap_size ) )
+	{
+		data_size = (size_t) image->bitmap_size;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation table data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	end_of_chain = fsfat_generate_get_end_of_chain(
+	                image );
+
+	image->allocation_table[ 0 ] = ( end_of_chain & 0xfffffff8UL ) | 0xf8;
+	image->allocation_table[ 1 ] = end_of_chain;
+
+	for( cluster_index = 0;
+	     cluster_index < ( (uint64_t) image->number_of_clusters + 2 );
+	     cluster_index++ )
+	{
+		value_32bit = image->allocation_table[ cluster_index ] & end_of_chain;
+
+		switch( image->file_system_format )
+		{
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12:
+				data_offset = (size_t) ( ( cluster_index * 3 ) / 2 );
+
+				if( ( cluster_index & 1 ) == 0 )
+				{
+					data[ data_offset ]     = (uint8_t) ( value_32bit & 0xff );
+					data[ data_offset + 1 ] = (uint8_t) ( ( data[ data_offset + 1 ] & 0xf0 ) | ( ( value_32bit >> 8 ) & 0x0f ) );
+				}
+				else
+				{
+					data[ data_offset ]     = (uint8_t) ( ( data[ data_offset ] & 0x0f ) | ( ( value_32bit << 4 ) & 0xf0 ) );
+					data[ data_offset + 1 ] = (uint8_t) ( ( value_32bit >> 4 ) & 0xff );
+				}
+				break;
+
+			case LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16:
+				byte_stream_copy_from_uint16_little_endian(
+				 &( data[ cluster_index * 2 ] ),
+				 (uint16_t) value_32bit );
+				break;
+
+			default:
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ cluster_index * 4 ] ),
+				 value_32bit );
+				break;
+		}
+	}
+	for( allocation_table_index = 0;
+	     allocation_table_index < image->number_of_allocation_tables;
+	     allocation_table_index++ )
+	{
+		if( fsfat_generate_write_at_offset(
+		     image,
+		     data,
+		     (size_t) image->allocation_table_size * FSFAT_GENERATE_BYTES_PER_SECTOR,
+		     (off64_t) ( image->number_of_reserved_sectors + ( allocation_table_index * image->allocation_table_size ) ) * FSFAT_GENERATE_BYTES_PER_SECTOR,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write allocation table: %" PRIu8 ".",
+			 function,
+			 allocation_table_index );
+
+			goto on_error;
+		}
+	}
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		memory_set(
+		 data,
+		 0,
+		 data_size );
+
+		for( cluster_index = 0;
+		     cluster_index < (uint64_t) image->number_of_clusters;
+		     cluster_index++ )
+		{
+			if( image->allocation_table[ cluster_index + 2 ] != 0 )
+			{
+				data[ cluster_index / 8 ] |= (uint8_t) ( 1 << ( cluster_index % 8 ) );
+			}
+		}
+		if( fsfat_generate_write_chain(
+		     image,
+		     image->bitmap_cluster,
+		     data,
+		     (size_t) image->bitmap_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write allocation bitmap.",
+			 function );
+
+			goto on_error;
+		}
+		/* The upcase table only maps ASCII, which covers the generated names
+		 */
+		for( upcase_index = 0;
+		     upcase_index < FSFAT_GENERATE_EXFAT_UPCASE_TABLE_SIZE;
+		     upcase_index++ )
+		{
+			value_32bit = (uint32_t) upcase_index;
+
+			if( ( value_32bit >= 'a' )
+			 && ( value_32bit <= 'z' ) )
+			{
+				value_32bit -= 'a' - 'A';
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( data[ upcase_index * 2 ] ),
+			 (uint16_t) value_32bit );
+		}
+		if( fsfat_generate_write_at_offset(
+		     image,
+		     data,
+		     FSFAT_GENERATE_EXFAT_UPCASE_TABLE_SIZE * 2,
+		     fsfat_generate_get_cluster_offset(
+		      image,
+		      image->upcase_table_cluster ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write upcase table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Writes the boot record and the other reserved sectors
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write_boot_record(
+     fsfat_generate_image_t *image,
+     libcerror_error_t **error )
+{
+	uint8_t data[ FSFAT_GENERATE_EXFAT_BOOT_REGION_SIZE * FSFAT_GENERATE_BYTES_PER_SECTOR ];
+
+	fsfat_boot_record_exfat_t *exfat_boot_record = (fsfat_boot_record_exfat_t *) data;
+	fsfat_boot_record_fat12_t *fat12_boot_record = (fsfat_boot_record_fat12_t *) data;
+	fsfat_boot_record_fat32_t *fat32_boot_record = (fsfat_boot_record_fat32_t *) data;
+	static char *function                        = "fsfat_generate_write_boot_record";
+	static const char *label                     = "FSFATGEN   ";
+	const char *file_system_hint                 = NULL;
+	size_t data_offset                           = 0;
+	uint64_t sectors_per_cluster_block           = 0;
+	uint32_t checksum                            = 0;
+	uint32_t volume_serial_number                = 0;
+	uint8_t shift                                = 0;
+	int sector_index                             = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 FSFAT_GENERATE_EXFAT_BOOT_REGION_SIZE * FSFAT_GENERATE_BYTES_PER_SECTOR );
+
+	sectors_per_cluster_block = image->cluster_block_size / FSFAT_GENERATE_BYTES_PER_SECTOR;
+	volume_serial_number      = (uint32_t) fsfat_generate_get_random_state(
+	                                        image->seed,
+	                                        FSFAT_GENERATE_SALT_LAYOUT,
+	                                        1 );
+
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	{
+		exfat_boot_record->boot_entry_point[ 0 ] = 0xeb;
+		exfat_boot_record->boot_entry_point[ 1 ] = 0x76;
+		exfat_boot_record->boot_entry_point[ 2 ] = 0x90;
+
+		memory_copy(
+		 exfat_boot_record->oem_name,
+		 "EXFAT   ",
+		 8 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 exfat_boot_record->total_number_of_sectors_64bit,
+		 image->total_number_of_sectors );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 exfat_boot_record->allocation_table_offset,
+		 image->number_of_reserved_sectors );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 exfat_boot_record->allocation_table_size_32bit,
+		 image->allocation_table_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 exfat_boot_record->first_cluster_offset,
+		 (uint32_t) ( image->first_cluster_offset / FSFAT_GENERATE_BYTES_PER_SECTOR ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 exfat_boot_record->total_number_of_clusters,
+		 image->number_of_clusters );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 exfat_boot_record->root_directory_cluster,
+		 image->directory_clusters[ 0 ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 exfat_boot_record->volume_serial_number,
+		 volume_serial_number );
+
+		exfat_boot_record->revision_minor_number = 0;
+		exfat_boot_record->revision_major_number = 1;
+
+		for( shift = 0;
+		     ( (uint64_t) 1 << shift ) < sectors_per_cluster_block;
+		     shift++ )
+		{
+		}
+		exfat_boot_record->bytes_per_sector            = 9;
+		exfat_boot_record->sectors_per_cluster_block   = shift;
+		exfat_boot_record->number_of_allocation_tables = 1;
+		exfat_boot_record->drive_number                = 0x80;
+
+		/* The percentage in use is not determined
+		 */
+		exfat_boot_record->unknown4 = 0xff;
+
+		exfat_boot_record->sector_signature[ 0 ] = 0x55;
+		exfat_boot_record->sector_signature[ 1 ] = 0xaa;
+
+		/* The extended boot sectors
+		 */
+		for( sector_index = 1;
+		     sector_index < 9;
+		     sector_index++ )
+		{
+			data_offset = ( (size_t) sector_index + 1 ) * FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+			data[ data_offset - 2 ] = 0x55;
+			data[ data_offset - 1 ] = 0xaa;
+		}
+		/* The boot checksum excludes the volume flags and percentage in use
+		 */
+		for( data_offset = 0;
+		     data_offset < ( 11 * FSFAT_GENERATE_BYTES_PER_SECTOR );
+		     data_offset++ )
+		{
+			if( ( data_offset == 106 )
+			 || ( data_offset == 107 )
+			 || ( data_offset == 112 ) )
+			{
+				continue;
+			}
+			checksum = ( ( checksum & 1 ) ? 0x80000000UL : 0 ) + ( checksum >> 1 ) + data[ data_offset ];
+		}
+		for( data_offset = 11 * FSFAT_GENERATE_BYTES_PER_SECTOR;
+		     data_offset < ( 12 * FSFAT_GENERATE_BYTES_PER_SECTOR );
+		     data_offset += 4 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 checksum );
+		}
+		/* The main and backup boot regions
+		 */
+		for( sector_index = 0;
+		     sector_index < 2;
+		     sector_index++ )
+		{
+			if( fsfat_generate_write_at_offset(
+			     image,
+			     data,
+			     FSFAT_GENERATE_EXFAT_BOOT_REGION_SIZE * FSFAT_GENERATE_BYTES_PER_SECTOR,
+			     (off64_t) sector_index * FSFAT_GENERATE_EXFAT_BOOT_REGION_SIZE * FSFAT_GENERATE_BYTES_PER_SECTOR,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		return( 1 );
+	}
+	fat12_boot_record->boot_entry_point[ 0 ] = 0xeb;
+	fat12_boot_record->boot_entry_point[ 1 ] = ( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32 ) ? 0x58 : 0x3c;
+	fat12_boot_record->boot_entry_point[ 2 ] = 0x90;
+
+	memory_copy(
+	 fat12_boot_record->oem_name,
+	 "MSWIN4.1",
+	 8 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 fat12_boot_record->bytes_per_sector,
+	 FSFAT_GENERATE_BYTES_PER_SECTOR );
+
+	fat12_boot_record->sectors_per_cluster_block = (uint8_t) sectors_per_cluster_block;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 fat12_boot_record->number_of_reserved_sectors,
+	 (uint16_t) image->number_of_reserved_sectors );
+
+	fat12_boot_record->number_of_allocation_tables = image->number_of_allocation_tables;
+	fat12_boot_record->media_descriptor            = 0xf8;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 fat12_boot_record->sectors_per_track,
+	 63 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 fat12_boot_record->number_of_heads,
+	 255 );
+
+	if( ( image->file_system_format != LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32 )
+	 && ( image->total_number_of_sectors <= 0xffffUL ) )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 fat12_boot_record->total_number_of_sectors_16bit,
+		 (uint16_t) image->total_number_of_sectors );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 fat12_boot_record->total_number_of_sectors_32bit,
+		 (uint32_t) image->total_number_of_sectors );
+	}
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 fat32_boot_record->allocation_table_size_32bit,
+		 image->allocation_table_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 fat32_boot_record->root_directory_cluster,
+		 image->directory_clusters[ 0 ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 fat32_boot_record->fsinfo_sector_number,
+		 1 );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 fat32_boot_record->boot_sector_number,
+		 6 );
+
+		fat32_boot_record->drive_number            = 0x80;
+		fat32_boot_record->extended_boot_signature = 0x29;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 fat32_boot_record->volume_serial_number,
+		 volume_serial_number );
+
+		memory_copy(
+		 fat32_boot_record->volume_label,
+		 label,
+		 11 );
+
+		memory_copy(
+		 fat32_boot_record->file_system_hint,
+		 "FAT32   ",
+		 8 );
+	}
+	else
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 fat12_boot_record->number_of_root_directory_entries,
+		 (uint16_t) image->number_of_root_directory_entries );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 fat12_boot_record->allocation_table_size_16bit,
+		 (uint16_t) image->allocation_table_size );
+
+		fat12_boot_record->drive_number            = 0x80;
+		fat12_boot_record->extended_boot_signature = 0x29;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 fat12_boot_record->volume_serial_number,
+		 volume_serial_number );
+
+		memory_copy(
+		 fat12_boot_record->volume_label,
+		 label,
+		 11 );
+
+		if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12 )
+		{
+			file_system_hint = "FAT12   ";
+		}
+		else
+		{
+			file_system_hint = "FAT16   ";
+		}
+		memory_copy(
+		 fat12_boot_record->file_system_hint,
+		 file_system_hint,
+		 8 );
+	}
+	fat12_boot_record->sector_signature[ 0 ] = 0x55;
+	fat12_boot_record->sector_signature[ 1 ] = 0xaa;
+
+	if( image->file_system_format == LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32 )
+	{
+		/* The FSInfo sector, with unknown free cluster count and next free cluster
+		 */
+		data_offset = FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 0x41615252UL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 484 ] ),
+		 0x61417272UL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 488 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 492 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 508 ] ),
+		 0xaa550000UL );
+
+		/* The boot sector and its backup at sector 6
+		 */
+		if( fsfat_generate_write_at_offset(
+		     image,
+		     data,
+		     2 * FSFAT_GENERATE_BYTES_PER_SECTOR,
+		     6 * FSFAT_GENERATE_BYTES_PER_SECTOR,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fsfat_generate_write_at_offset(
+		     image,
+		     data,
+		     2 * FSFAT_GENERATE_BYTES_PER_SECTOR,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( fsfat_generate_write_at_offset(
+	     image,
+	     data,
+	     FSFAT_GENERATE_BYTES_PER_SECTOR,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write boot record.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the image
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_write(
+     fsfat_generate_image_t *image,
+     libcerror_error_t **error )
+{
+	uint8_t sector_data[ FSFAT_GENERATE_BYTES_PER_SECTOR ];
+
+	static char *function    = "fsfat_generate_write";
+	uint64_t directory_index = 0;
+
+	/* Write the last sector first so the image has its full size
+	 */
+	memory_set(
+	 sector_data,
+	 0,
+	 FSFAT_GENERATE_BYTES_PER_SECTOR );
+
+	if( fsfat_generate_write_at_offset(
+	     image,
+	     sector_data,
+	     FSFAT_GENERATE_BYTES_PER_SECTOR,
+	     (off64_t) ( image->total_number_of_sectors - 1 ) * FSFAT_GENERATE_BYTES_PER_SECTOR,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fsfat_generate_write_boot_record(
+	     image,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fsfat_generate_write_allocation_tables(
+	     image,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( directory_index = 0;
+	     directory_index <= image->number_of_directories;
+	     directory_index++ )
+	{
+		if( fsfat_generate_write_directory(
+		     image,
+		     directory_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( fsfat_generate_write_files(
+	     image,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write image.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees the image values
+ */
+void fsfat_generate_image_free(
+      fsfat_generate_image_t *image )
+{
+	if( image->file_sizes != NULL )
+	{
+		memory_free(
+		 image->file_sizes );
+	}
+	if( image->file_clusters != NULL )
+	{
+		memory_free(
+		 image->file_clusters );
+	}
+	if( image->directory_clusters != NULL )
+	{
+		memory_free(
+		 image->directory_clusters );
+	}
+	if( image->directory_sizes != NULL )
+	{
+		memory_free(
+		 image->directory_sizes );
+	}
+	if( image->allocation_table != NULL )
+	{
+		memory_free(
+		 image->allocation_table );
+	}
+	if( image->allocation_order != NULL )
+	{
+		memory_free(
+		 image->allocation_order );
+	}
+}
+
+/* Prints usage information
+ */
+void fsfat_generate_usage_fprint(
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "Use fsfat_generate to write a synthetic FAT or exFAT image.\n\n" );
+
+	fprintf(
+	 stream,
+	 "Usage: fsfat_generate [ -c cluster_size ] [ -d depth ] [ -e files_per_directory ]\n"
+	 "                      [ -f fragmentation ] [ -l name_length ] [ -m maximum_size ]\n"
+	 "                      [ -n number_of_files ] [ -s seed ] [ -t format ] target\n\n" );
+
+	fprintf(
+	 stream,
+	 "\ttarget: the image file to write\n\n" );
+	fprintf(
+	 stream,
+	 "\t-c:     cluster block size in bytes, default is 4096\n" );
+	fprintf(
+	 stream,
+	 "\t-d:     depth of the nested directories, 0 stores all files in the\n"
+	 "\t        root directory, default is 1\n" );
+	fprintf(
+	 stream,
+	 "\t-e:     maximum number of files per directory, default is 1000\n" );
+	fprintf(
+	 stream,
+	 "\t-f:     percentage of clusters allocated out of order (0 - 100), default is 0\n" );
+	fprintf(
+	 stream,
+	 "\t-l:     length of the long (VFAT) names (9 - 255), 0 represents short\n"
+	 "\t        (8.3) names only, default is 0\n" );
+	fprintf(
+	 stream,
+	 "\t-m:     maximum file size in bytes, default is 0\n" );
+	fprintf(
+	 stream,
+	 "\t-n:     number of files, default is 100\n" );
+	fprintf(
+	 stream,
+	 "\t-s:     seed of the pseudo random number generator, default is 0\n" );
+	fprintf(
+	 stream,
+	 "\t-t:     format, options: exfat, fat12, fat16, fat32 (default)\n" );
+}
+
+/* Copies a decimal option value
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_generate_get_option_value(
+     const system_character_t *option,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	size_t string_length = 0;
+
+	string_length = system_string_length(
+	                 option );
+
+	return( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+	         option,
+	         string_length + 1,
+	         value,
+	         error ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fsfat_generate_image_t image;
+
+	libcerror_error_t *error   = NULL;
+	system_character_t *target = NULL;
+	system_integer_t option    = 0;
+	uint64_t value_64bit       = 0;
+	int result                 = 0;
+
+	memory_set(
+	 &image,
+	 0,
+	 sizeof( fsfat_generate_image_t ) );
+
+	image.file_system_format          = LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32;
+	image.number_of_files             = 100;
+	image.maximum_files_per_directory = 1000;
+	image.depth                       = 1;
+	image.cluster_block_size          = 4096;
+
+	while( ( option = fsfat_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:d:e:f:hl:m:n:s:t:" ) ) ) != (system_integer_t) -1 )
+	{
+		result = 1;
+
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				fsfat_generate_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.cluster_block_size ),
+				          &error );
+				break;
+
+			case (system_integer_t) 'd':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.depth ),
+				          &error );
+				break;
+
+			case (system_integer_t) 'e':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.maximum_files_per_directory ),
+				          &error );
+				break;
+
+			case (system_integer_t) 'f':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.fragmentation ),
+				          &error );
+				break;
+
+			case (system_integer_t) 'h':
+				fsfat_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.long_name_length ),
+				          &error );
+				break;
+
+			case (system_integer_t) 'm':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.maximum_file_size ),
+				          &error );
+				break;
+
+			case (system_integer_t) 'n':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.number_of_files ),
+				          &error );
+				break;
+
+			case (system_integer_t) 's':
+				result = fsfat_generate_get_option_value(
+				          optarg,
+				          &( image.seed ),
+				          &error );
+				break;
+
+			case (system_integer_t) 't':
+				if( system_string_compare(
+				     optarg,
+				     _SYSTEM_STRING( "exfat" ),
+				     6 ) == 0 )
+				{
+					image.file_system_format = LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT;
+				}
+				else if( system_string_compare(
+				          optarg,
+				          _SYSTEM_STRING( "fat12" ),
+				          6 ) == 0 )
+				{
+					image.file_system_format = LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12;
+				}
+				else if( system_string_compare(
+				          optarg,
+				          _SYSTEM_STRING( "fat16" ),
+				          6 ) == 0 )
+				{
+					image.file_system_format = LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16;
+				}
+				else if( system_string_compare(
+				          optarg,
+				          _SYSTEM_STRING( "fat32" ),
+				          6 ) == 0 )
+				{
+					image.file_system_format = LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32;
+				}
+				else
+				{
+					result = -1;
+				}
+				break;
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported option value: %" PRIs_SYSTEM "\n",
+			 optarg );
+
+			goto on_error;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		fsfat_generate_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	target = argv[ optind ];
+
+	value_64bit = image.cluster_block_size / FSFAT_GENERATE_BYTES_PER_SECTOR;
+
+	if( ( image.cluster_block_size < FSFAT_GENERATE_BYTES_PER_SECTOR )
+	 || ( ( image.cluster_block_size % FSFAT_GENERATE_BYTES_PER_SECTOR ) != 0 )
+	 || ( ( value_64bit & ( value_64bit - 1 ) ) != 0 )
+	 || ( ( image.file_system_format != LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	  &&  ( value_64bit > 128 ) )
+	 || ( image.cluster_block_size > ( 32 * 1024 * 1024 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported cluster block size.\n" );
+
+		goto on_error;
+	}
+	if( ( image.number_of_files > FSFAT_GENERATE_MAXIMUM_NUMBER_OF_ITEMS )
+	 || ( image.maximum_files_per_directory == 0 )
+	 || ( image.depth > FSFAT_GENERATE_MAXIMUM_NUMBER_OF_ITEMS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of files, files per directory or depth.\n" );
+
+		goto on_error;
+	}
+	if( ( image.long_name_length != 0 )
+	 && ( ( image.long_name_length < 9 )
+	  ||  ( image.long_name_length > FSFAT_GENERATE_MAXIMUM_NAME_LENGTH ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported name length.\n" );
+
+		goto on_error;
+	}
+	if( image.fragmentation > 100 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported fragmentation.\n" );
+
+		goto on_error;
+	}
+	if( ( image.file_system_format != LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT )
+	 && ( image.maximum_file_size > 0xffffffffUL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported maximum file size.\n" );
+
+		goto on_error;
+	}
+	if( fsfat_generate_layout(
+	     &image,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine layout.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	image.stream = file_stream_open_wide(
+	                target,
+	                _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	image.stream = file_stream_open(
+	                target,
+	                FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( image.stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %" PRIs_SYSTEM "\n",
+		 target );
+
+		goto on_error;
+	}
+	if( fsfat_generate_write(
+	     &image,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write image.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     image.stream ) != 0 )
+	{
+		image.stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Wrote %" PRIu64 " files in %" PRIu64 " directories using %" PRIu32 " clusters of %" PRIu64 " bytes.\n",
+	 image.number_of_files,
+	 image.number_of_directories + 1,
+	 image.allocation_index,
+	 image.cluster_block_size );
+
+	fsfat_generate_image_free(
+	 &image );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( image.stream != NULL )
+	{
+		file_stream_close(
+		 image.stream );
+	}
+	fsfat_generate_image_free(
+	 &image );
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,98 @@
+/*
+ * IO trace format definitions
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSFAT_IO_TRACE_H )
+#define _FSFAT_IO_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The IO trace file signature
+ */
+#define FSFAT_IO_TRACE_SIGNATURE		"fsfatiot"
+
+/* The IO trace format version
+ */
+#define FSFAT_IO_TRACE_FORMAT_VERSION		1
+
+/* The stages of the caller of a read
+ */
+enum FSFAT_IO_TRACE_STAGES
+{
+	FSFAT_IO_TRACE_STAGE_OPEN		= 1,
+	FSFAT_IO_TRACE_STAGE_DIRECTORY		= 2,
+	FSFAT_IO_TRACE_STAGE_DATA		= 3
+};
+
+/* The number of stages including the unused stage 0
+ */
+#define FSFAT_IO_TRACE_NUMBER_OF_STAGES		4
+
+typedef struct fsfat_io_trace_file_header fsfat_io_trace_file_header_t;
+
+struct fsfat_io_trace_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The volume size
+	 * Consists of 8 bytes
+	 */
+	uint8_t volume_size[ 8 ];
+};
+
+typedef struct fsfat_io_trace_record fsfat_io_trace_record_t;
+
+struct fsfat_io_trace_record
+{
+	/* The offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t offset[ 8 ];
+
+	/* The size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The stage
+	 * Consists of 1 byte
+	 */
+	uint8_t stage;
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSFAT_IO_TRACE_H ) */
+
@@ -0,0 +1,1157 @@
+/*
+ * Library IO access pattern recorder program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_io_trace.h"
+#include "fsfat_test_functions.h"
+#include "fsfat_test_getopt.h"
+#include "fsfat_test_libbfio.h"
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_libfsfat.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+#if !defined( LIBFSFAT_HAVE_BFIO )
+
+LIBFSFAT_EXTERN \
+int libfsfat_volume_open_file_io_handle(
+     libfsfat_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsfat_error_t **error );
+
+#endif /* !defined( LIBFSFAT_HAVE_BFIO ) */
+
+/* The default size of the reads of the file entry data
+ */
+#define FSFAT_RECORD_DEFAULT_READ_SIZE		65536
+
+/* The maximum size of the reads of the file entry data
+ */
+#define FSFAT_RECORD_MAXIMUM_READ_SIZE		( 16 * 1024 * 1024 )
+
+typedef struct fsfat_record_io_handle fsfat_record_io_handle_t;
+
+struct fsfat_record_io_handle
+{
+	/* The file IO handle that is recorded
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The trace stream
+	 */
+	FILE *stream;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The current stage
+	 */
+	uint8_t stage;
+
+	/* The number of records
+	 */
+	uint64_t number_of_records;
+};
+
+typedef struct fsfat_record_walk_state fsfat_record_walk_state_t;
+
+struct fsfat_record_walk_state
+{
+	/* The recording IO handle
+	 */
+	fsfat_record_io_handle_t *io_handle;
+
+	/* The read buffer
+	 */
+	uint8_t *buffer;
+
+	/* The read size
+	 */
+	size_t read_size;
+
+	/* The number of file entries
+	 */
+	uint64_t number_of_file_entries;
+
+	/* The number of bytes of file entry data read
+	 */
+	uint64_t number_of_bytes;
+};
+
+/* Frees a recording IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_record_io_handle_free(
+     fsfat_record_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_free";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		/* The file IO handle and the trace stream are freed by the caller
+		 */
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Opens the recording IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_record_io_handle_open(
+     fsfat_record_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     io_handle->file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = 0;
+
+	return( 1 );
+}
+
+/* Closes the recording IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int fsfat_record_io_handle_close(
+     fsfat_record_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_close";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     io_handle->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads a buffer from the recording IO handle and adds a record to the trace
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t fsfat_record_io_handle_read(
+         fsfat_record_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	fsfat_io_trace_record_t trace_record;
+
+	static char *function = "fsfat_record_io_handle_read";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              io_handle->file_io_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The requested size is recorded since that is what a cache has to provide
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 trace_record.offset,
+	 (uint64_t) io_handle->current_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 trace_record.size,
+	 (uint32_t) size );
+
+	trace_record.stage = io_handle->stage;
+
+	if( file_stream_write(
+	     io_handle->stream,
+	     &trace_record,
+	     sizeof( fsfat_io_trace_record_t ) ) != sizeof( fsfat_io_trace_record_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write trace record.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset    += read_count;
+	io_handle->number_of_records += 1;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the recording IO handle
+ * Returns -1 since writing is not supported
+ */
+ssize_t fsfat_record_io_handle_write(
+         fsfat_record_io_handle_t *io_handle FSFAT_TEST_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer FSFAT_TEST_ATTRIBUTE_UNUSED,
+         size_t size FSFAT_TEST_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_write";
+
+	FSFAT_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the recording IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t fsfat_record_io_handle_seek_offset(
+         fsfat_record_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_seek_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	offset = libbfio_handle_seek_offset(
+	          io_handle->file_io_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the recording IO handle exists
+ * Returns 1 if the file IO handle exists
+ */
+int fsfat_record_io_handle_exists(
+     fsfat_record_io_handle_t *io_handle FSFAT_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FSFAT_TEST_ATTRIBUTE_UNUSED )
+{
+	FSFAT_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Checks if the recording IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int fsfat_record_io_handle_is_open(
+     fsfat_record_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_is_open";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the recording IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_record_io_handle_get_size(
+     fsfat_record_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_record_io_handle_get_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     io_handle->file_io_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a file IO handle that records the reads of another file IO handle
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_record_handle_initialize(
+     libbfio_handle_t **handle,
+     fsfat_record_io_handle_t **io_handle,
+     libbfio_handle_t *file_io_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	fsfat_record_io_handle_t *record_io_handle = NULL;
+	static char *function                      = "fsfat_record_handle_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	record_io_handle = memory_allocate_structure(
+	                    fsfat_record_io_handle_t );
+
+	if( record_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     record_io_handle,
+	     0,
+	     sizeof( fsfat_record_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	record_io_handle->file_io_handle = file_io_handle;
+	record_io_handle->stream         = stream;
+	record_io_handle->stage          = FSFAT_IO_TRACE_STAGE_OPEN;
+
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) record_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) fsfat_record_io_handle_free,
+	     NULL,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) fsfat_record_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) fsfat_record_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) fsfat_record_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) fsfat_record_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) fsfat_record_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) fsfat_record_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) fsfat_record_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) fsfat_record_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	*io_handle = record_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( record_io_handle != NULL )
+	{
+		memory_free(
+		 record_io_handle );
+	}
+	return( -1 );
+}
+
+/* Writes the trace file header
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_record_write_file_header(
+     FILE *stream,
+     size64_t volume_size,
+     libcerror_error_t **error )
+{
+	fsfat_io_trace_file_header_t file_header;
+
+	static char *function = "fsfat_record_write_file_header";
+
+	if( memory_copy(
+	     file_header.signature,
+	     FSFAT_IO_TRACE_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 FSFAT_IO_TRACE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.volume_size,
+	 (uint64_t) volume_size );
+
+	if( file_stream_write(
+	     stream,
+	     &file_header,
+	     sizeof( fsfat_io_trace_file_header_t ) ) != sizeof( fsfat_io_trace_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to read the data of the file entries of a walk
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_record_walk_callback(
+     libfsfat_file_entry_t *file_entry,
+     int depth FSFAT_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	fsfat_record_walk_state_t *walk_state = NULL;
+	static char *function                 = "fsfat_record_walk_callback";
+	size64_t size                         = 0;
+	ssize_t read_count                    = 0;
+	off64_t offset                        = 0;
+	uint16_t file_attribute_flags         = 0;
+
+	FSFAT_TEST_UNREFERENCED_PARAMETER( depth )
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	walk_state = (fsfat_record_walk_state_t *) callback_data;
+
+	walk_state->number_of_file_entries += 1;
+
+	if( walk_state->read_size == 0 )
+	{
+		return( 1 );
+	}
+	if( libfsfat_file_entry_get_file_attribute_flags(
+	     file_entry,
+	     &file_attribute_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_attribute_flags & ( LIBFSFAT_FILE_ATTRIBUTE_FLAG_DIRECTORY | LIBFSFAT_FILE_ATTRIBUTE_FLAG_VOLUME_LABEL ) ) != 0 )
+	{
+		return( 1 );
+	}
+	if( libfsfat_file_entry_get_size(
+	     file_entry,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	walk_state->io_handle->stage = FSFAT_IO_TRACE_STAGE_DATA;
+
+	while( (size64_t) offset < size )
+	{
+		read_count = libfsfat_file_entry_read_buffer_at_offset(
+		              file_entry,
+		              walk_state->buffer,
+		              walk_state->read_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		offset                      += read_count;
+		walk_state->number_of_bytes += read_count;
+	}
+	walk_state->io_handle->stage = FSFAT_IO_TRACE_STAGE_DIRECTORY;
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fsfat_record_walk_state_t walk_state;
+
+	fsfat_record_io_handle_t *record_io_handle = NULL;
+	libbfio_handle_t *file_io_handle           = NULL;
+	libbfio_handle_t *record_file_io_handle    = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsfat_volume_t *volume                  = NULL;
+	system_character_t *option_offset          = NULL;
+	system_character_t *option_read_size       = NULL;
+	system_character_t *source                 = NULL;
+	system_character_t *target                 = NULL;
+	system_integer_t option                    = 0;
+	FILE *stream                               = NULL;
+	size64_t volume_size                       = 0;
+	size_t string_length                       = 0;
+	uint64_t read_size                         = FSFAT_RECORD_DEFAULT_READ_SIZE;
+	off64_t volume_offset                      = 0;
+
+	while( ( option = fsfat_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:r:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_read_size = optarg;
+
+				break;
+		}
+	}
+	if( ( optind + 1 ) >= argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source or target.\n"
+		 "Usage: fsfat_record [ -o offset ] [ -r read_size ] source target\n"
+		 "\n"
+		 "\tsource: the source file or device\n"
+		 "\ttarget: the IO trace file to write\n"
+		 "\n"
+		 "\t-o:     specify the volume offset in bytes\n"
+		 "\t-r:     specify the size of the file entry data reads in bytes,\n"
+		 "\t        default is %d, 0 disables reading the file entry data\n",
+		 FSFAT_RECORD_DEFAULT_READ_SIZE );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+	target = argv[ optind + 1 ];
+
+	memory_set(
+	 &walk_state,
+	 0,
+	 sizeof( fsfat_record_walk_state_t ) );
+
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		if( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+		     option_offset,
+		     string_length + 1,
+		     (uint64_t *) &volume_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_read_size != NULL )
+	{
+		string_length = system_string_length(
+		                 option_read_size );
+
+		if( ( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+		       option_read_size,
+		       string_length + 1,
+		       &read_size,
+		       &error ) != 1 )
+		 || ( read_size > (uint64_t) FSFAT_RECORD_MAXIMUM_READ_SIZE ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported read size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( read_size > 0 )
+	{
+		walk_state.buffer = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * (size_t) read_size );
+
+		if( walk_state.buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create read buffer.\n" );
+
+			goto on_error;
+		}
+	}
+	walk_state.read_size = (size_t) read_size;
+
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize file IO handle.\n" );
+
+		goto on_error;
+	}
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     source,
+	     string_length,
+	     &error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     source,
+	     string_length,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set file IO handle name.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     volume_offset,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set file IO handle range.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          target,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          target,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %" PRIs_SYSTEM "\n",
+		 target );
+
+		goto on_error;
+	}
+	if( fsfat_record_handle_initialize(
+	     &record_file_io_handle,
+	     &record_io_handle,
+	     file_io_handle,
+	     stream,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize recording file IO handle.\n" );
+
+		goto on_error;
+	}
+	walk_state.io_handle = record_io_handle;
+
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source: %" PRIs_SYSTEM "\n",
+		 source );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &volume_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve volume size.\n" );
+
+		goto on_error;
+	}
+	if( fsfat_record_write_file_header(
+	     stream,
+	     volume_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write trace file header.\n" );
+
+		goto on_error;
+	}
+	if( libfsfat_volume_initialize(
+	     &volume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize volume.\n" );
+
+		goto on_error;
+	}
+	record_io_handle->stage = FSFAT_IO_TRACE_STAGE_OPEN;
+
+	if( libfsfat_volume_open_file_io_handle(
+	     volume,
+	     record_file_io_handle,
+	     LIBFSFAT_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open volume.\n" );
+
+		goto on_error;
+	}
+	record_io_handle->stage = FSFAT_IO_TRACE_STAGE_DIRECTORY;
+
+	if( libfsfat_volume_walk(
+	     volume,
+	     &fsfat_record_walk_callback,
+	     (void *) &walk_state,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to walk volume.\n" );
+
+		goto on_error;
+	}
+	if( libfsfat_volume_close(
+	     volume,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close volume.\n" );
+
+		goto on_error;
+	}
+	if( libfsfat_volume_free(
+	     &volume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free volume.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Recorded %" PRIu64 " reads of %" PRIu64 " file entries and %" PRIu64 " bytes of file entry data.\n",
+	 record_io_handle->number_of_records,
+	 walk_state.number_of_file_entries,
+	 walk_state.number_of_bytes );
+
+	if( libbfio_handle_free(
+	     &record_file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free recording file IO handle.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file IO handle.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	if( walk_state.buffer != NULL )
+	{
+		memory_free(
+		 walk_state.buffer );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsfat_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( record_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &record_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( walk_state.buffer != NULL )
+	{
+		memory_free(
+		 walk_state.buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,636 @@
+/*
+ * Library IO access pattern replay program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_io_trace.h"
+#include "fsfat_replay_simulator.h"
+#include "fsfat_test_functions.h"
+#include "fsfat_test_getopt.h"
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+/* The default size of a cache block
+ */
+#define FSFAT_REPLAY_DEFAULT_BLOCK_SIZE		4096
+
+/* The default size of the cache
+ */
+#define FSFAT_REPLAY_DEFAULT_CACHE_SIZE		( 4 * 1024 * 1024 )
+
+/* The maximum number of reads in a trace
+ */
+#define FSFAT_REPLAY_MAXIMUM_NUMBER_OF_READS	( 256 * 1024 * 1024 )
+
+/* The number of cache policies
+ */
+#define FSFAT_REPLAY_NUMBER_OF_POLICIES		3
+
+/* The number of read-ahead sizes
+ */
+#define FSFAT_REPLAY_NUMBER_OF_READ_AHEAD_SIZES	6
+
+/* The read-ahead sizes that are simulated
+ */
+static size_t fsfat_replay_read_ahead_sizes[ FSFAT_REPLAY_NUMBER_OF_READ_AHEAD_SIZES ] = {
+	0, 4096, 16384, 65536, 262144, 1048576 };
+
+/* Retrieves the name of a stage
+ */
+const char *fsfat_replay_get_stage_name(
+             int stage )
+{
+	switch( stage )
+	{
+		case FSFAT_IO_TRACE_STAGE_OPEN:
+			return( "open" );
+
+		case FSFAT_IO_TRACE_STAGE_DIRECTORY:
+			return( "directory" );
+
+		case FSFAT_IO_TRACE_STAGE_DATA:
+			return( "data" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Retrieves the name of a cache policy
+ */
+const char *fsfat_replay_get_policy_name(
+             int policy )
+{
+	switch( policy )
+	{
+		case FSFAT_REPLAY_POLICY_DIRECT_MAPPED:
+			return( "direct_mapped" );
+
+		case FSFAT_REPLAY_POLICY_FIFO:
+			return( "fifo" );
+
+		case FSFAT_REPLAY_POLICY_LRU:
+			return( "lru" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Frees the reads of a trace
+ */
+void fsfat_replay_trace_free(
+      fsfat_replay_trace_t *trace )
+{
+	if( trace->reads != NULL )
+	{
+		memory_free(
+		 trace->reads );
+
+		trace->reads = NULL;
+	}
+	trace->number_of_reads = 0;
+}
+
+/* Reads a trace file
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_replay_trace_read(
+     fsfat_replay_trace_t *trace,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	fsfat_io_trace_file_header_t file_header;
+	fsfat_io_trace_record_t trace_record;
+
+	fsfat_replay_read_t *reads      = NULL;
+	fsfat_replay_read_t *trace_read = NULL;
+	static char *function           = "fsfat_replay_trace_read";
+	FILE *stream                    = NULL;
+	size_t maximum_number_of_reads  = 0;
+	size_t read_count               = 0;
+	uint32_t format_version         = 0;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open trace file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_read(
+	     stream,
+	     &file_header,
+	     sizeof( fsfat_io_trace_file_header_t ) ) != sizeof( fsfat_io_trace_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     FSFAT_IO_TRACE_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	if( format_version != FSFAT_IO_TRACE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.volume_size,
+	 trace->volume_size );
+
+	for( ;; )
+	{
+		read_count = file_stream_read(
+		              stream,
+		              &trace_record,
+		              sizeof( fsfat_io_trace_record_t ) );
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+		else if( read_count != sizeof( fsfat_io_trace_record_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read trace record: %" PRIzd ".",
+			 function,
+			 trace->number_of_reads );
+
+			goto on_error;
+		}
+		if( trace->number_of_reads >= maximum_number_of_reads )
+		{
+			if( maximum_number_of_reads >= FSFAT_REPLAY_MAXIMUM_NUMBER_OF_READS )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of reads value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( maximum_number_of_reads == 0 )
+			{
+				maximum_number_of_reads = 4096;
+			}
+			else
+			{
+				maximum_number_of_reads *= 2;
+			}
+			reads = (fsfat_replay_read_t *) memory_reallocate(
+			                                 trace->reads,
+			                                 sizeof( fsfat_replay_read_t ) * maximum_number_of_reads );
+
+			if( reads == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize reads.",
+				 function );
+
+				goto on_error;
+			}
+			trace->reads = reads;
+		}
+		trace_read = &( trace->reads[ trace->number_of_reads ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 trace_record.offset,
+		 trace_read->offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 trace_record.size,
+		 trace_read->size );
+
+		trace_read->stage = trace_record.stage;
+
+		if( trace_read->stage >= FSFAT_IO_TRACE_NUMBER_OF_STAGES )
+		{
+			trace_read->stage = 0;
+		}
+		trace->number_of_stage_reads[ trace_read->stage ] += 1;
+		trace->number_of_stage_bytes[ trace_read->stage ] += trace_read->size;
+
+		trace->number_of_reads += 1;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close trace file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	fsfat_replay_trace_free(
+	 trace );
+
+	return( -1 );
+}
+
+/* Prints a string as a JSON string
+ */
+void fsfat_replay_print_json_string(
+      FILE *stream,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	fprintf(
+	 stream,
+	 "\"" );
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+		else if( string[ string_index ] < (system_character_t) 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04x",
+			 (unsigned int) string[ string_index ] );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fsfat_replay_result_t result;
+	fsfat_replay_trace_t trace;
+
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_block_size = NULL;
+	system_character_t *option_cache_size = NULL;
+	system_character_t *source            = NULL;
+	system_integer_t option               = 0;
+	size_t string_length                  = 0;
+	uint64_t block_size                   = FSFAT_REPLAY_DEFAULT_BLOCK_SIZE;
+	uint64_t cache_size                   = FSFAT_REPLAY_DEFAULT_CACHE_SIZE;
+	uint64_t number_of_bytes              = 0;
+	int policy                            = 0;
+	int read_ahead_index                  = 0;
+	int stage                             = 0;
+
+	while( ( option = fsfat_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:c:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_block_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				option_cache_size = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source.\n"
+		 "Usage: fsfat_replay [ -b block_size ] [ -c cache_size ] source\n"
+		 "\n"
+		 "\tsource: the IO trace file written by fsfat_record\n"
+		 "\n"
+		 "\t-b:     specify the size of a cache block in bytes, default is %d\n"
+		 "\t-c:     specify the size of the cache in bytes, default is %d\n",
+		 FSFAT_REPLAY_DEFAULT_BLOCK_SIZE,
+		 FSFAT_REPLAY_DEFAULT_CACHE_SIZE );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	memory_set(
+	 &trace,
+	 0,
+	 sizeof( fsfat_replay_trace_t ) );
+
+	if( option_block_size != NULL )
+	{
+		string_length = system_string_length(
+		                 option_block_size );
+
+		if( ( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+		       option_block_size,
+		       string_length + 1,
+		       &block_size,
+		       &error ) != 1 )
+		 || ( block_size == 0 )
+		 || ( block_size > (uint64_t) UINT32_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported block size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_cache_size != NULL )
+	{
+		string_length = system_string_length(
+		                 option_cache_size );
+
+		if( fsfat_test_system_string_copy_from_64_bit_in_decimal(
+		     option_cache_size,
+		     string_length + 1,
+		     &cache_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported cache size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( cache_size < block_size )
+	 || ( ( cache_size / block_size ) > (uint64_t) FSFAT_REPLAY_MAXIMUM_NUMBER_OF_BLOCKS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported cache size, the cache should contain between 1 and %d blocks.\n",
+		 FSFAT_REPLAY_MAXIMUM_NUMBER_OF_BLOCKS );
+
+		goto on_error;
+	}
+	if( fsfat_replay_trace_read(
+	     &trace,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read trace: %" PRIs_SYSTEM "\n",
+		 source );
+
+		goto on_error;
+	}
+	for( stage = 0;
+	     stage < FSFAT_IO_TRACE_NUMBER_OF_STAGES;
+	     stage++ )
+	{
+		number_of_bytes += trace.number_of_stage_bytes[ stage ];
+	}
+	fprintf(
+	 stdout,
+	 "{\n"
+	 "\t\"source\": " );
+
+	fsfat_replay_print_json_string(
+	 stdout,
+	 source );
+
+	fprintf(
+	 stdout,
+	 ",\n"
+	 "\t\"volume_size\": %" PRIu64 ",\n"
+	 "\t\"number_of_reads\": %" PRIzd ",\n"
+	 "\t\"number_of_bytes\": %" PRIu64 ",\n"
+	 "\t\"stages\": {\n",
+	 trace.volume_size,
+	 trace.number_of_reads,
+	 number_of_bytes );
+
+	for( stage = 1;
+	     stage < FSFAT_IO_TRACE_NUMBER_OF_STAGES;
+	     stage++ )
+	{
+		fprintf(
+		 stdout,
+		 "\t\t\"%s\": {\n"
+		 "\t\t\t\"number_of_reads\": %" PRIu64 ",\n"
+		 "\t\t\t\"number_of_bytes\": %" PRIu64 "\n"
+		 "\t\t}%s\n",
+		 fsfat_replay_get_stage_name(
+		  stage ),
+		 trace.number_of_stage_reads[ stage ],
+		 trace.number_of_stage_bytes[ stage ],
+		 ( stage + 1 < FSFAT_IO_TRACE_NUMBER_OF_STAGES ) ? "," : "" );
+	}
+	fprintf(
+	 stdout,
+	 "\t},\n"
+	 "\t\"block_size\": %" PRIu64 ",\n"
+	 "\t\"cache_size\": %" PRIu64 ",\n"
+	 "\t\"simulations\": [\n",
+	 block_size,
+	 cache_size );
+
+	for( policy = 1;
+	     policy <= FSFAT_REPLAY_NUMBER_OF_POLICIES;
+	     policy++ )
+	{
+		for( read_ahead_index = 0;
+		     read_ahead_index < FSFAT_REPLAY_NUMBER_OF_READ_AHEAD_SIZES;
+		     read_ahead_index++ )
+		{
+			if( fsfat_replay_simulate(
+			     &trace,
+			     policy,
+			     (size_t) block_size,
+			     (size_t) cache_size,
+			     fsfat_replay_read_ahead_sizes[ read_ahead_index ],
+			     &result,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to simulate cache policy: %s.\n",
+				 fsfat_replay_get_policy_name(
+				  policy ) );
+
+				goto on_error;
+			}
+			fprintf(
+			 stdout,
+			 "\t\t{\n"
+			 "\t\t\t\"policy\": \"%s\",\n"
+			 "\t\t\t\"read_ahead_size\": %" PRIzd ",\n"
+			 "\t\t\t\"read_hit_rate\": %.4f,\n"
+			 "\t\t\t\"block_hit_rate\": %.4f,\n"
+			 "\t\t\t\"number_of_device_reads\": %" PRIu64 ",\n"
+			 "\t\t\t\"number_of_bytes_read\": %" PRIu64 "\n"
+			 "\t\t}%s\n",
+			 fsfat_replay_get_policy_name(
+			  policy ),
+			 fsfat_replay_read_ahead_sizes[ read_ahead_index ],
+			 ( trace.number_of_reads == 0 ) ? 0.0 : (double) result.number_of_read_hits / (double) trace.number_of_reads,
+			 ( ( result.number_of_block_hits + result.number_of_block_misses ) == 0 ) ? 0.0 : (double) result.number_of_block_hits / (double) ( result.number_of_block_hits + result.number_of_block_misses ),
+			 result.number_of_device_reads,
+			 result.number_of_bytes_read,
+			 ( ( policy < FSFAT_REPLAY_NUMBER_OF_POLICIES ) || ( read_ahead_index + 1 < FSFAT_REPLAY_NUMBER_OF_READ_AHEAD_SIZES ) ) ? "," : "" );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "\t]\n"
+	 "}\n" );
+
+	fsfat_replay_trace_free(
+	 &trace );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	fsfat_replay_trace_free(
+	 &trace );
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,521 @@
+/*
+ * Library IO access pattern replay cache simulator
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "fsfat_replay_simulator.h"
+#include "fsfat_test_libcerror.h"
+
+/* Frees a cache
+ */
+void fsfat_replay_cache_free(
+      fsfat_replay_cache_t *cache )
+{
+	if( cache->block_numbers != NULL )
+	{
+		memory_free(
+		 cache->block_numbers );
+
+		cache->block_numbers = NULL;
+	}
+	if( cache->previous_slots != NULL )
+	{
+		memory_free(
+		 cache->previous_slots );
+
+		cache->previous_slots = NULL;
+	}
+	if( cache->next_slots != NULL )
+	{
+		memory_free(
+		 cache->next_slots );
+
+		cache->next_slots = NULL;
+	}
+	if( cache->bucket_slots != NULL )
+	{
+		memory_free(
+		 cache->bucket_slots );
+
+		cache->bucket_slots = NULL;
+	}
+	if( cache->bucket_next_slots != NULL )
+	{
+		memory_free(
+		 cache->bucket_next_slots );
+
+		cache->bucket_next_slots = NULL;
+	}
+}
+
+/* Initializes a cache
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_replay_cache_initialize(
+     fsfat_replay_cache_t *cache,
+     int policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function      = "fsfat_replay_cache_initialize";
+	uint32_t number_of_buckets = 1;
+	int slot_index             = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots <= 0 )
+	 || ( number_of_slots > FSFAT_REPLAY_MAXIMUM_NUMBER_OF_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	memory_set(
+	 cache,
+	 0,
+	 sizeof( fsfat_replay_cache_t ) );
+
+	/* Use twice as many hash buckets as slots to keep the chains short
+	 */
+	while( number_of_buckets < ( (uint32_t) number_of_slots * 2 ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	cache->policy          = policy;
+	cache->number_of_slots = number_of_slots;
+	cache->first_slot      = -1;
+	cache->last_slot       = -1;
+	cache->bucket_mask     = number_of_buckets - 1;
+
+	cache->block_numbers = (uint64_t *) memory_allocate(
+	                                     sizeof( uint64_t ) * number_of_slots );
+
+	cache->previous_slots = (int *) memory_allocate(
+	                                 sizeof( int ) * number_of_slots );
+
+	cache->next_slots = (int *) memory_allocate(
+	                             sizeof( int ) * number_of_slots );
+
+	cache->bucket_slots = (int *) memory_allocate(
+	                               sizeof( int ) * number_of_buckets );
+
+	cache->bucket_next_slots = (int *) memory_allocate(
+	                                    sizeof( int ) * number_of_slots );
+
+	if( ( cache->block_numbers == NULL )
+	 || ( cache->previous_slots == NULL )
+	 || ( cache->next_slots == NULL )
+	 || ( cache->bucket_slots == NULL )
+	 || ( cache->bucket_next_slots == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index++ )
+	{
+		cache->block_numbers[ slot_index ] = (uint64_t) -1;
+	}
+	memory_set(
+	 cache->bucket_slots,
+	 0xff,
+	 sizeof( int ) * number_of_buckets );
+
+	return( 1 );
+
+on_error:
+	fsfat_replay_cache_free(
+	 cache );
+
+	return( -1 );
+}
+
+/* Retrieves the hash bucket of a block number
+ */
+uint32_t fsfat_replay_cache_get_bucket(
+          fsfat_replay_cache_t *cache,
+          uint64_t block_number )
+{
+	return( (uint32_t) ( ( block_number * 0x9e3779b97f4a7c15ULL ) >> 32 ) & cache->bucket_mask );
+}
+
+/* Removes a slot from the recency list
+ */
+void fsfat_replay_cache_unlink_slot(
+      fsfat_replay_cache_t *cache,
+      int slot_index )
+{
+	int next_slot     = cache->next_slots[ slot_index ];
+	int previous_slot = cache->previous_slots[ slot_index ];
+
+	if( previous_slot != -1 )
+	{
+		cache->next_slots[ previous_slot ] = next_slot;
+	}
+	else
+	{
+		cache->first_slot = next_slot;
+	}
+	if( next_slot != -1 )
+	{
+		cache->previous_slots[ next_slot ] = previous_slot;
+	}
+	else
+	{
+		cache->last_slot = previous_slot;
+	}
+}
+
+/* Adds a slot to the front of the recency list
+ */
+void fsfat_replay_cache_link_slot(
+      fsfat_replay_cache_t *cache,
+      int slot_index )
+{
+	cache->previous_slots[ slot_index ] = -1;
+	cache->next_slots[ slot_index ]     = cache->first_slot;
+
+	if( cache->first_slot != -1 )
+	{
+		cache->previous_slots[ cache->first_slot ] = slot_index;
+	}
+	cache->first_slot = slot_index;
+
+	if( cache->last_slot == -1 )
+	{
+		cache->last_slot = slot_index;
+	}
+}
+
+/* Looks up a block in the cache
+ * If touch is set the block becomes the most recently used with the LRU policy
+ * Returns 1 if the block is cached or 0 if not
+ */
+int fsfat_replay_cache_lookup(
+     fsfat_replay_cache_t *cache,
+     uint64_t block_number,
+     int touch )
+{
+	int slot_index = 0;
+
+	if( cache->policy == FSFAT_REPLAY_POLICY_DIRECT_MAPPED )
+	{
+		slot_index = (int) ( block_number % (uint64_t) cache->number_of_slots );
+
+		return( cache->block_numbers[ slot_index ] == block_number );
+	}
+	slot_index = cache->bucket_slots[ fsfat_replay_cache_get_bucket( cache, block_number ) ];
+
+	while( slot_index != -1 )
+	{
+		if( cache->block_numbers[ slot_index ] == block_number )
+		{
+			if( ( touch != 0 )
+			 && ( cache->policy == FSFAT_REPLAY_POLICY_LRU )
+			 && ( slot_index != cache->first_slot ) )
+			{
+				fsfat_replay_cache_unlink_slot(
+				 cache,
+				 slot_index );
+
+				fsfat_replay_cache_link_slot(
+				 cache,
+				 slot_index );
+			}
+			return( 1 );
+		}
+		slot_index = cache->bucket_next_slots[ slot_index ];
+	}
+	return( 0 );
+}
+
+/* Inserts a block that is not cached into the cache
+ * The least recently inserted or used block is evicted if the cache is full
+ */
+void fsfat_replay_cache_insert(
+      fsfat_replay_cache_t *cache,
+      uint64_t block_number )
+{
+	uint32_t bucket     = 0;
+	int *slot_reference = NULL;
+	int slot_index      = 0;
+
+	if( cache->policy == FSFAT_REPLAY_POLICY_DIRECT_MAPPED )
+	{
+		slot_index = (int) ( block_number % (uint64_t) cache->number_of_slots );
+
+		cache->block_numbers[ slot_index ] = block_number;
+
+		return;
+	}
+	if( cache->number_of_used_slots < cache->number_of_slots )
+	{
+		slot_index = cache->number_of_used_slots;
+
+		cache->number_of_used_slots += 1;
+	}
+	else
+	{
+		slot_index = cache->last_slot;
+
+		bucket = fsfat_replay_cache_get_bucket(
+		          cache,
+		          cache->block_numbers[ slot_index ] );
+
+		slot_reference = &( cache->bucket_slots[ bucket ] );
+
+		while( *slot_reference != slot_index )
+		{
+			slot_reference = &( cache->bucket_next_slots[ *slot_reference ] );
+		}
+		*slot_reference = cache->bucket_next_slots[ slot_index ];
+
+		fsfat_replay_cache_unlink_slot(
+		 cache,
+		 slot_index );
+	}
+	bucket = fsfat_replay_cache_get_bucket(
+	          cache,
+	          block_number );
+
+	cache->block_numbers[ slot_index ]     = block_number;
+	cache->bucket_next_slots[ slot_index ] = cache->bucket_slots[ bucket ];
+	cache->bucket_slots[ bucket ]          = slot_index;
+
+	fsfat_replay_cache_link_slot(
+	 cache,
+	 slot_index );
+}
+
+/* Simulates a cache policy and read-ahead size against a trace
+ * Every block of a read is counted once, as a hit if it was cached before the read
+ * and as a miss otherwise. A miss that is not covered by an earlier device read of
+ * the same read results in a single device read up to the end of the read or the
+ * read-ahead, whichever is further, limited to the number of blocks in the cache
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_replay_simulate(
+     fsfat_replay_trace_t *trace,
+     int policy,
+     size_t block_size,
+     size_t cache_size,
+     size_t read_ahead_size,
+     fsfat_replay_result_t *result,
+     libcerror_error_t **error )
+{
+	fsfat_replay_cache_t cache;
+
+	fsfat_replay_read_t *trace_read      = NULL;
+	static char *function                = "fsfat_replay_simulate";
+	uint64_t block_number                = 0;
+	uint64_t fetch_block_number          = 0;
+	uint64_t first_block_number          = 0;
+	uint64_t last_block_number           = 0;
+	uint64_t last_volume_block           = (uint64_t) -1;
+	uint64_t number_of_read_ahead_blocks = 0;
+	size_t read_index                    = 0;
+	int is_hit                           = 0;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsfat_replay_cache_initialize(
+	     &cache,
+	     policy,
+	     (int) ( cache_size / block_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		return( -1 );
+	}
+	memory_set(
+	 result,
+	 0,
+	 sizeof( fsfat_replay_result_t ) );
+
+	if( trace->volume_size > 0 )
+	{
+		last_volume_block = ( trace->volume_size - 1 ) / block_size;
+	}
+	number_of_read_ahead_blocks = ( read_ahead_size + block_size - 1 ) / block_size;
+
+	for( read_index = 0;
+	     read_index < trace->number_of_reads;
+	     read_index++ )
+	{
+		trace_read = &( trace->reads[ read_index ] );
+
+		if( trace_read->size == 0 )
+		{
+			continue;
+		}
+		first_block_number = trace_read->offset / block_size;
+		last_block_number  = ( trace_read->offset + trace_read->size - 1 ) / block_size;
+		fetch_block_number = 0;
+		is_hit             = 1;
+
+		for( block_number = first_block_number;
+		     block_number <= last_block_number;
+		     block_number++ )
+		{
+			/* Blocks that are cached are touched so that the LRU policy
+			 * sees every block of the read
+			 */
+			if( fsfat_replay_cache_lookup(
+			     &cache,
+			     block_number,
+			     1 ) != 0 )
+			{
+				result->number_of_block_hits += 1;
+
+				continue;
+			}
+			result->number_of_block_misses += 1;
+
+			fsfat_replay_cache_insert(
+			 &cache,
+			 block_number );
+
+			result->number_of_bytes_read += block_size;
+
+			/* The block was fetched by an earlier device read of this read
+			 */
+			if( ( is_hit == 0 )
+			 && ( block_number <= fetch_block_number ) )
+			{
+				continue;
+			}
+			is_hit = 0;
+
+			result->number_of_device_reads += 1;
+
+			fetch_block_number = block_number + number_of_read_ahead_blocks;
+
+			if( fetch_block_number < last_block_number )
+			{
+				fetch_block_number = last_block_number;
+			}
+			if( fetch_block_number > last_volume_block )
+			{
+				fetch_block_number = last_volume_block;
+			}
+			if( fetch_block_number < block_number )
+			{
+				fetch_block_number = block_number;
+			}
+			/* A single fetch should not evict its own blocks
+			 */
+			if( ( fetch_block_number - block_number ) >= (uint64_t) cache.number_of_slots )
+			{
+				fetch_block_number = block_number + cache.number_of_slots - 1;
+			}
+		}
+		/* The read-ahead beyond the end of the read is cached without being touched
+		 */
+		if( is_hit == 0 )
+		{
+			for( block_number = last_block_number + 1;
+			     block_number <= fetch_block_number;
+			     block_number++ )
+			{
+				if( fsfat_replay_cache_lookup(
+				     &cache,
+				     block_number,
+				     0 ) == 0 )
+				{
+					fsfat_replay_cache_insert(
+					 &cache,
+					 block_number );
+
+					result->number_of_bytes_read += block_size;
+				}
+			}
+		}
+		if( is_hit != 0 )
+		{
+			result->number_of_read_hits += 1;
+		}
+	}
+	fsfat_replay_cache_free(
+	 &cache );
+
+	return( 1 );
+}
+
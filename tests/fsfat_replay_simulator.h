@@ -0,0 +1,208 @@
+/*
+ * Library IO access pattern replay cache simulator
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSFAT_REPLAY_SIMULATOR_H )
+#define _FSFAT_REPLAY_SIMULATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fsfat_io_trace.h"
+#include "fsfat_test_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of blocks in the cache
+ */
+#define FSFAT_REPLAY_MAXIMUM_NUMBER_OF_BLOCKS	( 16 * 1024 * 1024 )
+
+/* The cache policies
+ */
+enum FSFAT_REPLAY_POLICIES
+{
+	FSFAT_REPLAY_POLICY_DIRECT_MAPPED	= 1,
+	FSFAT_REPLAY_POLICY_FIFO		= 2,
+	FSFAT_REPLAY_POLICY_LRU			= 3
+};
+
+typedef struct fsfat_replay_read fsfat_replay_read_t;
+
+struct fsfat_replay_read
+{
+	/* The offset
+	 */
+	uint64_t offset;
+
+	/* The size
+	 */
+	uint32_t size;
+
+	/* The stage
+	 */
+	uint8_t stage;
+};
+
+typedef struct fsfat_replay_trace fsfat_replay_trace_t;
+
+struct fsfat_replay_trace
+{
+	/* The volume size
+	 */
+	size64_t volume_size;
+
+	/* The reads
+	 */
+	fsfat_replay_read_t *reads;
+
+	/* The number of reads
+	 */
+	size_t number_of_reads;
+
+	/* The number of reads per stage
+	 */
+	uint64_t number_of_stage_reads[ FSFAT_IO_TRACE_NUMBER_OF_STAGES ];
+
+	/* The number of bytes per stage
+	 */
+	uint64_t number_of_stage_bytes[ FSFAT_IO_TRACE_NUMBER_OF_STAGES ];
+};
+
+typedef struct fsfat_replay_cache fsfat_replay_cache_t;
+
+struct fsfat_replay_cache
+{
+	/* The policy
+	 */
+	int policy;
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The number of used slots
+	 */
+	int number_of_used_slots;
+
+	/* The block number per slot
+	 */
+	uint64_t *block_numbers;
+
+	/* The previous slot per slot, in order of recency
+	 */
+	int *previous_slots;
+
+	/* The next slot per slot, in order of recency
+	 */
+	int *next_slots;
+
+	/* The most recent slot
+	 */
+	int first_slot;
+
+	/* The least recent slot
+	 */
+	int last_slot;
+
+	/* The hash bucket mask
+	 */
+	uint32_t bucket_mask;
+
+	/* The first slot per hash bucket
+	 */
+	int *bucket_slots;
+
+	/* The next slot in the same hash bucket per slot
+	 */
+	int *bucket_next_slots;
+};
+
+typedef struct fsfat_replay_result fsfat_replay_result_t;
+
+struct fsfat_replay_result
+{
+	/* The number of reads that were fully served from the cache
+	 */
+	uint64_t number_of_read_hits;
+
+	/* The number of blocks that were served from the cache
+	 */
+	uint64_t number_of_block_hits;
+
+	/* The number of blocks that were not in the cache
+	 */
+	uint64_t number_of_block_misses;
+
+	/* The number of reads of the underlying device
+	 */
+	uint64_t number_of_device_reads;
+
+	/* The number of bytes read from the underlying device
+	 */
+	uint64_t number_of_bytes_read;
+};
+
+void fsfat_replay_cache_free(
+      fsfat_replay_cache_t *cache );
+
+int fsfat_replay_cache_initialize(
+     fsfat_replay_cache_t *cache,
+     int policy,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+uint32_t fsfat_replay_cache_get_bucket(
+          fsfat_replay_cache_t *cache,
+          uint64_t block_number );
+
+void fsfat_replay_cache_unlink_slot(
+      fsfat_replay_cache_t *cache,
+      int slot_index );
+
+void fsfat_replay_cache_link_slot(
+      fsfat_replay_cache_t *cache,
+      int slot_index );
+
+int fsfat_replay_cache_lookup(
+     fsfat_replay_cache_t *cache,
+     uint64_t block_number,
+     int touch );
+
+void fsfat_replay_cache_insert(
+      fsfat_replay_cache_t *cache,
+      uint64_t block_number );
+
+int fsfat_replay_simulate(
+     fsfat_replay_trace_t *trace,
+     int policy,
+     size_t block_size,
+     size_t cache_size,
+     size_t read_ahead_size,
+     fsfat_replay_result_t *result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSFAT_REPLAY_SIMULATOR_H ) */
+
@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #endif
 
+#include "fsfat_test_functions.h"
+#include "fsfat_test_libbfio.h"
 #include "fsfat_test_libcerror.h"
 #include "fsfat_test_libfsfat.h"
 #include "fsfat_test_macros.h"
@@ -34,6 +36,8 @@
 #include "fsfat_test_unused.h"
 
 #include "../libfsfat/libfsfat_allocation_table.h"
+#include "../libfsfat/libfsfat_definitions.h"
+#include "../libfsfat/libfsfat_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
 
@@ -275,6 +279,293 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsfat_allocation_table_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_allocation_table_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libfsfat_allocation_table_t *allocation_table = NULL;
+	libfsfat_io_handle_t *io_handle               = NULL;
+	uint8_t *table_data                           = NULL;
+	size_t table_data_offset                      = 0;
+	size_t table_data_size                        = 0;
+	uint32_t cluster_number                       = 0;
+	uint32_t expected_cluster_number              = 0;
+	int number_of_cluster_numbers                 = 0;
+	int result                                    = 0;
+	int table_index                               = 0;
+
+	/* Initialize test
+	 * The FAT-12 table is 1 sector larger than the number of sectors read at once
+	 * so that the cluster numbers around the read boundary and the partial
+	 * cluster number pair at the end of the table are decoded
+	 */
+	table_data_size           = 512 * ( LIBFSFAT_ALLOCATION_TABLE_READ_NUMBER_OF_SECTORS + 1 );
+	number_of_cluster_numbers = (int) ( ( table_data_size * 2 ) / 3 );
+
+	table_data = (uint8_t *) memory_allocate(
+	                          table_data_size );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "table_data",
+	 table_data );
+
+	for( table_index = 0;
+	     table_index < number_of_cluster_numbers;
+	     table_index += 2 )
+	{
+		table_data_offset = ( (size_t) table_index / 2 ) * 3;
+
+		cluster_number = ( ( table_index * 7 ) + 3 ) & 0x00000fffUL;
+
+		if( ( table_index + 1 ) < number_of_cluster_numbers )
+		{
+			cluster_number |= ( ( ( ( table_index + 1 ) * 7 ) + 3 ) & 0x00000fffUL ) << 12;
+		}
+		table_data[ table_data_offset ]     = (uint8_t) ( cluster_number & 0xff );
+		table_data[ table_data_offset + 1 ] = (uint8_t) ( ( cluster_number >> 8 ) & 0xff );
+
+		if( ( table_data_offset + 2 ) < table_data_size )
+		{
+			table_data[ table_data_offset + 2 ] = (uint8_t) ( ( cluster_number >> 16 ) & 0xff );
+		}
+	}
+	result = libfsfat_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_system_format = LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12;
+	io_handle->bytes_per_sector   = 512;
+
+	result = libfsfat_allocation_table_initialize(
+	          &allocation_table,
+	          (uint32_t) number_of_cluster_numbers,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = fsfat_test_open_file_io_handle(
+	          &file_io_handle,
+	          table_data,
+	          table_data_size,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_allocation_table_read_file_io_handle(
+	          allocation_table,
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          (size64_t) table_data_size,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( table_index = 0;
+	     table_index < number_of_cluster_numbers;
+	     table_index++ )
+	{
+		result = libfsfat_allocation_table_get_cluster_number_by_index(
+		          allocation_table,
+		          table_index,
+		          &cluster_number,
+		          &error );
+
+		FSFAT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSFAT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_cluster_number = ( ( table_index * 7 ) + 3 ) & 0x00000fffUL;
+
+		FSFAT_TEST_ASSERT_EQUAL_UINT32(
+		 "cluster_number",
+		 cluster_number,
+		 expected_cluster_number );
+	}
+	/* Test error cases
+	 */
+	result = libfsfat_allocation_table_read_file_io_handle(
+	          NULL,
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          (size64_t) table_data_size,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_allocation_table_read_file_io_handle(
+	          allocation_table,
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          (size64_t) table_data_size,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = fsfat_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsfat_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 table_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( allocation_table != NULL )
+	{
+		libfsfat_allocation_table_free(
+		 &allocation_table,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsfat_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( table_data != NULL )
+	{
+		memory_free(
+		 table_data );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
 
 /* The main program
@@ -302,7 +593,9 @@ int main(
 	 "libfsfat_allocation_table_free",
 	 fsfat_test_allocation_table_free );
 
-	/* TODO: add tests for libfsfat_allocation_table_read_file_io_handle */
+	FSFAT_TEST_RUN(
+	 "libfsfat_allocation_table_read_file_io_handle",
+	 fsfat_test_allocation_table_read_file_io_handle );
 
 	/* TODO: add tests for libfsfat_allocation_table_get_sector_identifier_by_index */
 
@@ -0,0 +1,261 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_libfsfat.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+#include "../libfsfat/libfsfat_checksum.h"
+
+uint8_t fsfat_test_checksum_data1[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+/* Tests the libfsfat_checksum_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_checksum_calculate_crc32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          fsfat_test_checksum_data1,
+	          0,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x00000000UL );
+
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          fsfat_test_checksum_data1,
+	          1,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x83dcefb7UL );
+
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          fsfat_test_checksum_data1,
+	          9,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xcbf43926UL );
+
+	/* Test calculating the checksum over multiple buffers
+	 */
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          fsfat_test_checksum_data1,
+	          3,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          &( fsfat_test_checksum_data1[ 3 ] ),
+	          6,
+	          checksum,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xcbf43926UL );
+
+	/* Test error cases
+	 */
+	result = libfsfat_checksum_calculate_crc32(
+	          NULL,
+	          fsfat_test_checksum_data1,
+	          9,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          NULL,
+	          6,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_checksum_calculate_crc32(
+	          &checksum,
+	          fsfat_test_checksum_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_checksum_calculate_crc32",
+	 fsfat_test_checksum_calculate_crc32 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+}
+
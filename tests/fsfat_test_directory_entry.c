@@ -41,6 +41,10 @@ uint8_t fsfat_test_directory_entry_data1[ 32 ] = {
 	0x54, 0x45, 0x53, 0x54, 0x44, 0x49, 0x52, 0x31, 0x20, 0x20, 0x20, 0x10, 0x08, 0x82, 0x59, 0xa2,
 	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x5a, 0xa2, 0xc9, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
+uint8_t fsfat_test_directory_entry_data2[ 32 ] = {
+	0x54, 0x45, 0x53, 0x54, 0x44, 0x49, 0x52, 0x31, 0x20, 0x20, 0x20, 0x10, 0x08, 0x82, 0x59, 0xa2,
+	0xc9, 0x52, 0xc9, 0x52, 0x34, 0x12, 0x5a, 0xa2, 0xc9, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
 
 /* Tests the libfsfat_directory_entry_initialize function
@@ -437,6 +441,176 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsfat_directory_entry_read_data function with the upper 16-bit of the data start cluster
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_entry_read_data_data_start_cluster_upper(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsfat_directory_entry_t *directory_entry = NULL;
+	uint32_t data_start_cluster                 = 0;
+	int result                                  = 0;
+
+	/* Test FAT-32 where the upper 16-bit of the data start cluster are used
+	 */
+	result = libfsfat_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_entry_read_data(
+	          directory_entry,
+	          fsfat_test_directory_entry_data2,
+	          32,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT32,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_entry_get_data_start_cluster(
+	          directory_entry,
+	          &data_start_cluster,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "data_start_cluster",
+	 data_start_cluster,
+	 (uint32_t) 0x12340002UL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test FAT-16 where the same bytes are ignored
+	 */
+	result = libfsfat_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_entry_read_data(
+	          directory_entry,
+	          fsfat_test_directory_entry_data2,
+	          32,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_entry_get_data_start_cluster(
+	          directory_entry,
+	          &data_start_cluster,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "data_start_cluster",
+	 data_start_cluster,
+	 (uint32_t) 0x00000002UL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsfat_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsfat_directory_entry_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -706,6 +880,10 @@ int main(
 	 "libfsfat_directory_entry_read_data",
 	 fsfat_test_directory_entry_read_data );
 
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_entry_read_data_data_start_cluster_upper",
+	 fsfat_test_directory_entry_read_data_data_start_cluster_upper );
+
 	FSFAT_TEST_RUN(
 	 "libfsfat_directory_entry_read_file_io_handle",
 	 fsfat_test_directory_entry_read_file_io_handle );
@@ -0,0 +1,1828 @@
+/*
+ * Library directory parser type test program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_libfsfat.h"
+#include "fsfat_test_libuna.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+#include "../libfsfat/libfsfat_directory.h"
+#include "../libfsfat/libfsfat_directory_parser.h"
+#include "../libfsfat/libfsfat_name.h"
+
+/* Define to make fsfat_test_directory_parser generate verbose output
+#define FSFAT_TEST_DIRECTORY_PARSER_VERBOSE
+ */
+
+uint8_t fsfat_test_directory_parser_data1[ 416 ] = {
+	0x54, 0x45, 0x53, 0x54, 0x56, 0x4f, 0x4c, 0x55, 0x4d, 0x45, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x41, 0x65, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x74, 0x00, 0x79, 0x00, 0x0f, 0x00, 0xc9, 0x66, 0x00,
+	0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x45, 0x4d, 0x50, 0x54, 0x59, 0x46, 0x7e, 0x31, 0x20, 0x20, 0x20, 0x20, 0x00, 0x86, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x54, 0x45, 0x53, 0x54, 0x44, 0x49, 0x52, 0x31, 0x20, 0x20, 0x20, 0x10, 0x08, 0x86, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x44, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x00, 0x93, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0x6d, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x73, 0x00, 0x0f, 0x00, 0x93, 0x6f, 0x00,
+	0x20, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x6c, 0x00,
+	0x02, 0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x0f, 0x00, 0x93, 0x20, 0x00,
+	0x66, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x61, 0x00,
+	0x01, 0x4d, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x0f, 0x00, 0x93, 0x6e, 0x00,
+	0x67, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65, 0x00, 0x00, 0x00, 0x72, 0x00, 0x79, 0x00,
+	0x4d, 0x59, 0x4c, 0x4f, 0x4e, 0x47, 0x7e, 0x31, 0x20, 0x20, 0x20, 0x20, 0x00, 0x8e, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x42, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x0f, 0x00, 0x72, 0x72, 0x00,
+	0x6d, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+	0x01, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x0f, 0x00, 0x72, 0x6d, 0x00,
+	0x20, 0x00, 0x56, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x65, 0x00,
+	0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x7e, 0x31, 0x20, 0x20, 0x20, 0x16, 0x00, 0xab, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsfat_test_directory_parser_data2[ 160 ] = {
+	0x83, 0x04, 0x54, 0x00, 0x45, 0x00, 0x53, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x85, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x67, 0xa1, 0xc9, 0x52, 0x67, 0xa1, 0xc9, 0x52,
+	0x67, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc1, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsfat_test_directory_parser_data3[ 96 ] = {
+	0x54, 0x45, 0x53, 0x54, 0x56, 0x4f, 0x4c, 0x55, 0x4d, 0x45, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x46, 0x49, 0x4c, 0x45, 0x20, 0x20, 0x20, 0x20, 0x54, 0x58, 0x54, 0x20, 0x00, 0x86, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+/* Tests the libfsfat_directory_parser_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_FSFAT_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_directory_parser_initialize(
+	          NULL,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_parser = (libfsfat_directory_parser_t *) 0x12345678UL;
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_parser = NULL;
+
+#if defined( HAVE_FSFAT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsfat_directory_parser_initialize with malloc failing
+		 */
+		fsfat_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsfat_directory_parser_initialize(
+		          &directory_parser,
+		          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+		          &error );
+
+		if( fsfat_test_malloc_attempts_before_fail != -1 )
+		{
+			fsfat_test_malloc_attempts_before_fail = -1;
+
+			if( directory_parser != NULL )
+			{
+				libfsfat_directory_parser_free(
+				 &directory_parser,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSFAT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSFAT_TEST_ASSERT_IS_NULL(
+			 "directory_parser",
+			 directory_parser );
+
+			FSFAT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsfat_directory_parser_initialize with memset failing
+		 */
+		fsfat_test_memset_attempts_before_fail = test_number;
+
+		result = libfsfat_directory_parser_initialize(
+		          &directory_parser,
+		          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+		          &error );
+
+		if( fsfat_test_memset_attempts_before_fail != -1 )
+		{
+			fsfat_test_memset_attempts_before_fail = -1;
+
+			if( directory_parser != NULL )
+			{
+				libfsfat_directory_parser_free(
+				 &directory_parser,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSFAT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSFAT_TEST_ASSERT_IS_NULL(
+			 "directory_parser",
+			 directory_parser );
+
+			FSFAT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSFAT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsfat_directory_parser_free(
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_get_first_slot_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_get_first_slot_index(
+     void )
+{
+	int slot_index = 0;
+
+	/* Test regular cases
+	 */
+	slot_index = libfsfat_directory_parser_get_first_slot_index(
+	              0x0000000000000001ULL );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "slot_index",
+	 slot_index,
+	 0 );
+
+	slot_index = libfsfat_directory_parser_get_first_slot_index(
+	              0x00000000000002f4ULL );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "slot_index",
+	 slot_index,
+	 2 );
+
+	slot_index = libfsfat_directory_parser_get_first_slot_index(
+	              0x0001000000000000ULL );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "slot_index",
+	 slot_index,
+	 48 );
+
+	slot_index = libfsfat_directory_parser_get_first_slot_index(
+	              0x8000000000000000ULL );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "slot_index",
+	 slot_index,
+	 63 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_scan_slots function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_scan_slots(
+     void )
+{
+	uint8_t first_bytes[ 10 ]                     = { 0x41, 0xe5, 0x2e, 0xe5, 0x41, 0x41, 0x41, 0x41, 0xe5, 0x00 };
+	uint8_t data[ 2048 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	uint64_t slots_bitmap                         = 0;
+	int result                                    = 0;
+	int slot_index                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          data,
+	          0,
+	          2048 ) != NULL;
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( slot_index = 0;
+	     slot_index < 10;
+	     slot_index++ )
+	{
+		data[ slot_index * 32 ] = first_bytes[ slot_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          data,
+	          320,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "slots_bitmap",
+	 slots_bitmap,
+	 (uint64_t) 0x00000000000002f5ULL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that empty slots in a full buffer are read
+	 */
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          data,
+	          2048,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "slots_bitmap",
+	 slots_bitmap,
+	 (uint64_t) 0xfffffffffffffef5ULL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_parser->file_system_format = LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT;
+
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          data,
+	          320,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "slots_bitmap",
+	 slots_bitmap,
+	 (uint64_t) 0x000000000000030aULL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_directory_parser_scan_slots(
+	          NULL,
+	          data,
+	          320,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          NULL,
+	          320,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          data,
+	          2080,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          data,
+	          31,
+	          &slots_bitmap,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_scan_slots(
+	          directory_parser,
+	          data,
+	          320,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_read_fat_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_read_fat_data(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_t *directory               = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	int number_of_file_entries                    = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data1,
+	          416,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 12 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->volume_label_entry",
+	 directory->volume_label_entry );
+
+	result = libfsfat_directory_get_number_of_file_entries(
+	          directory,
+	          &number_of_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 4 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_directory_parser_read_fat_data(
+	          NULL,
+	          directory,
+	          fsfat_test_directory_parser_data1,
+	          416,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          NULL,
+	          fsfat_test_directory_parser_data1,
+	          416,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          NULL,
+	          416,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data1,
+	          31,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_read_exfat_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_read_exfat_data(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_t *directory               = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	int number_of_file_entries                    = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_directory_parser_read_exfat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data2,
+	          160,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 4 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->volume_label_entry",
+	 directory->volume_label_entry );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser->current_file_entry",
+	 directory_parser->current_file_entry );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_parser->current_file_entry->data_start_cluster",
+	 directory_parser->current_file_entry->data_start_cluster,
+	 (uint32_t) 5 );
+
+	result = libfsfat_directory_get_number_of_file_entries(
+	          directory,
+	          &number_of_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_directory_parser_read_exfat_data(
+	          NULL,
+	          directory,
+	          fsfat_test_directory_parser_data2,
+	          160,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_exfat_data(
+	          directory_parser,
+	          NULL,
+	          fsfat_test_directory_parser_data2,
+	          160,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_exfat_data(
+	          directory_parser,
+	          directory,
+	          NULL,
+	          160,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_directory_parser_read_exfat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data2,
+	          31,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_read_fat_data function with a volume label
+ * that has the archive attribute flag set, as in a FAT-16 root directory
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_read_fat_data_volume_label(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_t *directory               = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	int number_of_file_entries                    = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT16,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data3,
+	          96,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 2 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->volume_label_entry",
+	 directory->volume_label_entry );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT16(
+	 "directory->volume_label_entry->file_attribute_flags",
+	 directory->volume_label_entry->file_attribute_flags,
+	 (uint16_t) 0x0028 );
+
+	result = libfsfat_directory_get_number_of_file_entries(
+	          directory,
+	          &number_of_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_read_fat_data function with a VFAT long file name
+ * sequence that is split over 2 reads
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_read_fat_data_split(
+     void )
+{
+	uint8_t expected_name[ 42 ] = {
+		'M', 'y', ' ', 'l', 'o', 'n', 'g', ',', ' ', 'v', 'e', 'r', 'y', ' ', 'l', 'o',
+		'n', 'g', ' ', 'f', 'i', 'l', 'e', ' ', 'n', 'a', 'm', 'e', ',', ' ', 's', 'o',
+		' ', 'v', 'e', 'r', 'y', ' ', 'l', 'o', 'n', 'g' };
+
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_t *directory               = NULL;
+	libfsfat_directory_entry_t *directory_entry   = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	int number_of_file_entries                    = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Split the data between the second and third VFAT long file name entries of MYLONG~1
+	 */
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data1,
+	          192,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 6 );
+
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          &( fsfat_test_directory_parser_data1[ 192 ] ),
+	          224,
+	          192,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 12 );
+
+	result = libfsfat_directory_get_number_of_file_entries(
+	          directory,
+	          &number_of_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 4 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_determine_names(
+	          directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_get_file_entry_by_index(
+	          directory,
+	          2,
+	          &directory_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          directory_entry->case_folded_name,
+	          directory_entry->case_folded_name_length,
+	          expected_name,
+	          42,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_directory_parser_read_exfat_data function with a file entry set
+ * that is split over 2 reads
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_directory_parser_read_exfat_data_split(
+     void )
+{
+	uint8_t expected_name[ 4 ] = {
+		't', 'e', 's', 't' };
+
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_t *directory               = NULL;
+	libfsfat_directory_entry_t *directory_entry   = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	int number_of_file_entries                    = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_EXFAT,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Split the data between the data stream and file name entries of the file entry set
+	 */
+	result = libfsfat_directory_parser_read_exfat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_directory_parser_data2,
+	          96,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 3 );
+
+	result = libfsfat_directory_parser_read_exfat_data(
+	          directory_parser,
+	          directory,
+	          &( fsfat_test_directory_parser_data2[ 96 ] ),
+	          64,
+	          96,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_parser->number_of_entries_read",
+	 directory_parser->number_of_entries_read,
+	 (uint64_t) 4 );
+
+	result = libfsfat_directory_get_number_of_file_entries(
+	          directory,
+	          &number_of_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_determine_names(
+	          directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_get_file_entry_by_index(
+	          directory,
+	          0,
+	          &directory_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          directory_entry->case_folded_name,
+	          directory_entry->case_folded_name_length,
+	          expected_name,
+	          4,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( FSFAT_TEST_DIRECTORY_PARSER_VERBOSE )
+	libfsfat_notify_set_verbose(
+	 1 );
+	libfsfat_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_initialize",
+	 fsfat_test_directory_parser_initialize );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_free",
+	 fsfat_test_directory_parser_free );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_get_first_slot_index",
+	 fsfat_test_directory_parser_get_first_slot_index );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_scan_slots",
+	 fsfat_test_directory_parser_scan_slots );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_read_fat_data",
+	 fsfat_test_directory_parser_read_fat_data );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_read_fat_data_volume_label",
+	 fsfat_test_directory_parser_read_fat_data_volume_label );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_read_fat_data_split",
+	 fsfat_test_directory_parser_read_fat_data_split );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_read_exfat_data",
+	 fsfat_test_directory_parser_read_exfat_data );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_directory_parser_read_exfat_data_split",
+	 fsfat_test_directory_parser_read_exfat_data_split );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+}
+
@@ -33,7 +33,38 @@
 #include "fsfat_test_memory.h"
 #include "fsfat_test_unused.h"
 
+#include "../libfsfat/libfsfat_directory.h"
+#include "../libfsfat/libfsfat_directory_parser.h"
 #include "../libfsfat/libfsfat_file_entry.h"
+#include "../libfsfat/libfsfat_io_handle.h"
+
+uint8_t fsfat_test_file_entry_data1[ 416 ] = {
+	0x54, 0x45, 0x53, 0x54, 0x56, 0x4f, 0x4c, 0x55, 0x4d, 0x45, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x41, 0x65, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x74, 0x00, 0x79, 0x00, 0x0f, 0x00, 0xc9, 0x66, 0x00,
+	0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x45, 0x4d, 0x50, 0x54, 0x59, 0x46, 0x7e, 0x31, 0x20, 0x20, 0x20, 0x20, 0x00, 0x86, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x54, 0x45, 0x53, 0x54, 0x44, 0x49, 0x52, 0x31, 0x20, 0x20, 0x20, 0x10, 0x08, 0x86, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x44, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x00, 0x93, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0x6d, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x73, 0x00, 0x0f, 0x00, 0x93, 0x6f, 0x00,
+	0x20, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x6c, 0x00,
+	0x02, 0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x0f, 0x00, 0x93, 0x20, 0x00,
+	0x66, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x61, 0x00,
+	0x01, 0x4d, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x0f, 0x00, 0x93, 0x6e, 0x00,
+	0x67, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65, 0x00, 0x00, 0x00, 0x72, 0x00, 0x79, 0x00,
+	0x4d, 0x59, 0x4c, 0x4f, 0x4e, 0x47, 0x7e, 0x31, 0x20, 0x20, 0x20, 0x20, 0x00, 0x8e, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x42, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x0f, 0x00, 0x72, 0x72, 0x00,
+	0x6d, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+	0x01, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x0f, 0x00, 0x72, 0x6d, 0x00,
+	0x20, 0x00, 0x56, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x65, 0x00,
+	0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x7e, 0x31, 0x20, 0x20, 0x20, 0x16, 0x00, 0xab, 0x67, 0xa1,
+	0xc9, 0x52, 0xc9, 0x52, 0x00, 0x00, 0x68, 0xa1, 0xc9, 0x52, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
 /* Tests the libfsfat_file_entry_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +106,700 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
 
+/* Tests the libfsfat_file_entry_get_sub_file_entries_packed function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_file_entry_get_sub_file_entries_packed(
+     void )
+{
+	libfsfat_packed_file_entry_t packed_file_entries[ 8 ];
+	uint8_t name_pool[ 256 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfsfat_directory_t *directory               = NULL;
+	libfsfat_directory_t *empty_directory         = NULL;
+	libfsfat_directory_parser_t *directory_parser = NULL;
+	libfsfat_file_entry_t *empty_file_entry       = NULL;
+	libfsfat_file_entry_t *file_entry             = NULL;
+	libfsfat_io_handle_t *io_handle               = NULL;
+	int number_of_packed_file_entries             = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_initialize(
+	          &directory_parser,
+	          LIBFSFAT_FILE_SYSTEM_FORMAT_FAT12,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_parser",
+	 directory_parser );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The directory contains: emptyfile, testdir1,
+	 * My long, very long file name, so very long and System Volume Information
+	 */
+	result = libfsfat_directory_parser_read_fat_data(
+	          directory_parser,
+	          directory,
+	          fsfat_test_file_entry_data1,
+	          416,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_parser_free(
+	          &directory_parser,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_initialize(
+	          &empty_directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "empty_directory",
+	 empty_directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file entries do not manage the directories
+	 */
+	result = libfsfat_file_entry_initialize(
+	          &file_entry,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_file_entry_initialize(
+	          &empty_file_entry,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          empty_directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "empty_file_entry",
+	 empty_file_entry );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_packed_file_entries",
+	 number_of_packed_file_entries,
+	 4 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The names are stored consecutively in the name pool including the end of string character
+	 */
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 0 ].name_offset",
+	 packed_file_entries[ 0 ].name_offset,
+	 (uint32_t) 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 0 ].name_size",
+	 packed_file_entries[ 0 ].name_size,
+	 (uint32_t) 10 );
+
+	result = memory_compare(
+	          &( name_pool[ packed_file_entries[ 0 ].name_offset ] ),
+	          "emptyfile",
+	          10 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 1 ].name_offset",
+	 packed_file_entries[ 1 ].name_offset,
+	 (uint32_t) 10 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 1 ].name_size",
+	 packed_file_entries[ 1 ].name_size,
+	 (uint32_t) 9 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 1 ].data_start_cluster",
+	 packed_file_entries[ 1 ].data_start_cluster,
+	 (uint32_t) 2 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT16(
+	 "packed_file_entries[ 1 ].file_attribute_flags",
+	 packed_file_entries[ 1 ].file_attribute_flags,
+	 (uint16_t) 0x0010 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 2 ].name_offset",
+	 packed_file_entries[ 2 ].name_offset,
+	 (uint32_t) 19 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 2 ].name_size",
+	 packed_file_entries[ 2 ].name_size,
+	 (uint32_t) 43 );
+
+	result = memory_compare(
+	          &( name_pool[ packed_file_entries[ 2 ].name_offset ] ),
+	          "My long, very long file name, so very long",
+	          43 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 3 ].name_offset",
+	 packed_file_entries[ 3 ].name_offset,
+	 (uint32_t) 62 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 3 ].name_size",
+	 packed_file_entries[ 3 ].name_size,
+	 (uint32_t) 26 );
+
+	result = memory_compare(
+	          &( name_pool[ packed_file_entries[ 3 ].name_offset ] ),
+	          "System Volume Information",
+	          26 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 3 ].data_start_cluster",
+	 packed_file_entries[ 3 ].data_start_cluster,
+	 (uint32_t) 14 );
+
+	/* Test continuing from a specific index with a limited number of packed file entries
+	 */
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          2,
+	          packed_file_entries,
+	          1,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_packed_file_entries",
+	 number_of_packed_file_entries,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 0 ].name_offset",
+	 packed_file_entries[ 0 ].name_offset,
+	 (uint32_t) 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "packed_file_entries[ 0 ].name_size",
+	 packed_file_entries[ 0 ].name_size,
+	 (uint32_t) 43 );
+
+	/* Test a name pool that only fits the names of the first 2 sub file entries
+	 */
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          20,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_packed_file_entries",
+	 number_of_packed_file_entries,
+	 2 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the first index beyond the last sub file entry
+	 */
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          4,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_packed_file_entries",
+	 number_of_packed_file_entries,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty directory
+	 */
+	number_of_packed_file_entries = -1;
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          empty_file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_packed_file_entries",
+	 number_of_packed_file_entries,
+	 0 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          NULL,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          -1,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          NULL,
+	          8,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          0,
+	          name_pool,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          NULL,
+	          256,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          0,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a name pool that is too small for the name of the first sub file entry
+	 */
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          5,
+	          &number_of_packed_file_entries,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_file_entry_get_sub_file_entries_packed(
+	          file_entry,
+	          0,
+	          packed_file_entries,
+	          8,
+	          name_pool,
+	          256,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsfat_file_entry_free(
+	          &empty_file_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &empty_directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_directory_free(
+	          &directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( empty_file_entry != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &empty_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( directory_parser != NULL )
+	{
+		libfsfat_directory_parser_free(
+		 &directory_parser,
+		 NULL );
+	}
+	if( empty_directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &empty_directory,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsfat_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsfat_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
 
 /* The main program
@@ -136,6 +861,10 @@ int main(
 
 	/* TODO: add tests for libfsfat_file_entry_get_sub_file_entry_by_utf16_name */
 
+	FSFAT_TEST_RUN(
+	 "libfsfat_file_entry_get_sub_file_entries_packed",
+	 fsfat_test_file_entry_get_sub_file_entries_packed );
+
 	/* TODO: add tests for libfsfat_file_entry_read_buffer */
 
 	/* TODO: add tests for libfsfat_file_entry_read_buffer_at_offset */
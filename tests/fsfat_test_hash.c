@@ -0,0 +1,261 @@
+/*
+ * Library hash functions test program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_libfsfat.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_memory.h"
+#include "fsfat_test_unused.h"
+
+#include "../libfsfat/libfsfat_hash.h"
+
+uint8_t fsfat_test_hash_data1[ 6 ] = {
+	'f', 'o', 'o', 'b', 'a', 'r' };
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+/* Tests the libfsfat_hash_calculate_fnv1a_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_hash_calculate_fnv1a_64bit(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t hash_value      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          fsfat_test_hash_data1,
+	          0,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0xcbf29ce484222325ULL );
+
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          fsfat_test_hash_data1,
+	          1,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0xaf63dc4c8601ec8cULL );
+
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          fsfat_test_hash_data1,
+	          6,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0x85944171f73967e8ULL );
+
+	/* Test calculating the hash over multiple buffers
+	 */
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          fsfat_test_hash_data1,
+	          3,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          &( fsfat_test_hash_data1[ 3 ] ),
+	          3,
+	          hash_value,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0x85944171f73967e8ULL );
+
+	/* Test error cases
+	 */
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          NULL,
+	          fsfat_test_hash_data1,
+	          6,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          NULL,
+	          6,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_hash_calculate_fnv1a_64bit(
+	          &hash_value,
+	          fsfat_test_hash_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFSFAT_HASH_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_hash_calculate_fnv1a_64bit",
+	 fsfat_test_hash_calculate_fnv1a_64bit );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -525,6 +526,489 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsfat_name_compare_case_folded_name_with_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_name_compare_case_folded_name_with_utf8_string(
+     void )
+{
+	uint8_t case_folded_name[ 5 ] = { 'E', 'Q', 'U', 'A', 'L' };
+	uint8_t utf8_string1[ 6 ]     = { 'e', 'Q', 'u', 'a', 'L', 0 };
+	uint8_t utf8_string2[ 4 ]     = { 'e', 'q', 'u', 'a' };
+	uint8_t utf8_string3[ 6 ]     = { 'e', 'q', 'u', 'a', 'l', 's' };
+	uint8_t utf8_string4[ 5 ]     = { 'e', 'q', 'u', 'a', 'm' };
+	libcerror_error_t *error      = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          5,
+	          utf8_string1,
+	          6,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          5,
+	          utf8_string2,
+	          4,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          5,
+	          utf8_string3,
+	          6,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          5,
+	          utf8_string4,
+	          5,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          0,
+	          utf8_string1,
+	          6,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          NULL,
+	          5,
+	          utf8_string1,
+	          6,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string1,
+	          6,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          5,
+	          NULL,
+	          6,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_compare_case_folded_name_with_utf8_string(
+	          case_folded_name,
+	          5,
+	          utf8_string1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_name_copy_case_folded_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_name_copy_case_folded_utf8_string(
+     void )
+{
+	uint8_t case_folded_string[ 16 ];
+
+	uint8_t utf8_string[ 6 ]         = { 'e', 'Q', 'u', 'a', 'L', 0 };
+	libcerror_error_t *error         = NULL;
+	size_t case_folded_string_length = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsfat_name_copy_case_folded_utf8_string(
+	          utf8_string,
+	          6,
+	          case_folded_string,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_SIZE(
+	 "case_folded_string_length",
+	 case_folded_string_length,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          case_folded_string,
+	          "EQUAL",
+	          5 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsfat_name_copy_case_folded_utf8_string(
+	          NULL,
+	          6,
+	          case_folded_string,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_copy_case_folded_utf8_string(
+	          utf8_string,
+	          6,
+	          NULL,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_copy_case_folded_utf8_string(
+	          utf8_string,
+	          6,
+	          case_folded_string,
+	          2,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_copy_case_folded_utf8_string(
+	          utf8_string,
+	          6,
+	          case_folded_string,
+	          16,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_name_copy_case_folded_utf8_string_from_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_name_copy_case_folded_utf8_string_from_name(
+     void )
+{
+	uint8_t case_folded_string[ 16 ];
+
+	uint8_t byte_stream[ 6 ]         = { 'e', 'Q', 'u', 'a', 'L', 0 };
+	uint8_t utf16_stream[ 12 ]       = { 'e', 0, 'Q', 0, 'u', 0, 'a', 0, 'L', 0, 0, 0 };
+	libcerror_error_t *error         = NULL;
+	size_t case_folded_string_length = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsfat_name_copy_case_folded_utf8_string_from_name(
+	          utf16_stream,
+	          12,
+	          1,
+	          case_folded_string,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_SIZE(
+	 "case_folded_string_length",
+	 case_folded_string_length,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          case_folded_string,
+	          "EQUAL",
+	          5 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsfat_name_copy_case_folded_utf8_string_from_name(
+	          byte_stream,
+	          6,
+	          0,
+	          case_folded_string,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_SIZE(
+	 "case_folded_string_length",
+	 case_folded_string_length,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          case_folded_string,
+	          "EQUAL",
+	          5 );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsfat_name_copy_case_folded_utf8_string_from_name(
+	          NULL,
+	          12,
+	          1,
+	          case_folded_string,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_copy_case_folded_utf8_string_from_name(
+	          utf16_stream,
+	          12,
+	          1,
+	          NULL,
+	          16,
+	          &case_folded_string_length,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_name_copy_case_folded_utf8_string_from_name(
+	          utf16_stream,
+	          12,
+	          1,
+	          case_folded_string,
+	          16,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
 
 /* The main program
@@ -552,6 +1036,18 @@ int main(
 	 "libfsfat_name_compare_with_utf16_string",
 	 fsfat_test_name_compare_with_utf16_string );
 
+	FSFAT_TEST_RUN(
+	 "libfsfat_name_compare_case_folded_name_with_utf8_string",
+	 fsfat_test_name_compare_case_folded_name_with_utf8_string );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_name_copy_case_folded_utf8_string",
+	 fsfat_test_name_copy_case_folded_utf8_string );
+
+	FSFAT_TEST_RUN(
+	 "libfsfat_name_copy_case_folded_utf8_string_from_name",
+	 fsfat_test_name_copy_case_folded_utf8_string_from_name );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,431 @@
+/*
+ * Library IO access pattern replay cache simulator testing program
+ *
+ * Copyright (C) 2021-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsfat_io_trace.h"
+#include "fsfat_replay_simulator.h"
+#include "fsfat_test_libcerror.h"
+#include "fsfat_test_macros.h"
+#include "fsfat_test_unused.h"
+
+/* Reads of single blocks of 4096 bytes that are followed by a read of 2 blocks,
+ * which are 2, 0, 2, 1 and 0-1 in blocks
+ */
+fsfat_replay_read_t fsfat_test_replay_simulator_reads1[ 5 ] = {
+	{ 8192, 4096, FSFAT_IO_TRACE_STAGE_DATA },
+	{ 0, 4096, FSFAT_IO_TRACE_STAGE_DATA },
+	{ 8192, 4096, FSFAT_IO_TRACE_STAGE_DATA },
+	{ 4096, 4096, FSFAT_IO_TRACE_STAGE_DATA },
+	{ 0, 8192, FSFAT_IO_TRACE_STAGE_DATA } };
+
+/* A read of 3 blocks that is followed by reads of single blocks,
+ * which are 0-2, 1 and 4 in blocks
+ */
+fsfat_replay_read_t fsfat_test_replay_simulator_reads2[ 3 ] = {
+	{ 0, 12288, FSFAT_IO_TRACE_STAGE_DIRECTORY },
+	{ 4096, 4096, FSFAT_IO_TRACE_STAGE_DIRECTORY },
+	{ 16384, 4096, FSFAT_IO_TRACE_STAGE_DIRECTORY } };
+
+/* Tests the fsfat_replay_simulate function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_replay_simulate(
+     void )
+{
+	fsfat_replay_result_t replay_result;
+	fsfat_replay_trace_t trace;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	trace.volume_size     = 1048576;
+	trace.reads           = fsfat_test_replay_simulator_reads1;
+	trace.number_of_reads = 5;
+
+	/* Test with a direct mapped cache of 2 blocks, where blocks 0 and 2 share a slot
+	 * and block 1 of the last read is a hit although it is fetched by the same device read
+	 */
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_DIRECT_MAPPED,
+	          4096,
+	          8192,
+	          0,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_read_hits",
+	 replay_result.number_of_read_hits,
+	 (uint64_t) 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_hits",
+	 replay_result.number_of_block_hits,
+	 (uint64_t) 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_misses",
+	 replay_result.number_of_block_misses,
+	 (uint64_t) 5 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_device_reads",
+	 replay_result.number_of_device_reads,
+	 (uint64_t) 5 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_bytes_read",
+	 replay_result.number_of_bytes_read,
+	 (uint64_t) 20480 );
+
+	/* Test with a FIFO cache of 2 blocks, where the hit on block 2 does not
+	 * prevent its eviction by block 1
+	 */
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_FIFO,
+	          4096,
+	          8192,
+	          0,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_read_hits",
+	 replay_result.number_of_read_hits,
+	 (uint64_t) 2 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_hits",
+	 replay_result.number_of_block_hits,
+	 (uint64_t) 3 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_misses",
+	 replay_result.number_of_block_misses,
+	 (uint64_t) 3 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_device_reads",
+	 replay_result.number_of_device_reads,
+	 (uint64_t) 3 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_bytes_read",
+	 replay_result.number_of_bytes_read,
+	 (uint64_t) 12288 );
+
+	/* Test with a LRU cache of 2 blocks, where the hit on block 2 keeps it cached
+	 * and block 0 is evicted by block 1 instead
+	 */
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_LRU,
+	          4096,
+	          8192,
+	          0,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_read_hits",
+	 replay_result.number_of_read_hits,
+	 (uint64_t) 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_hits",
+	 replay_result.number_of_block_hits,
+	 (uint64_t) 2 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_misses",
+	 replay_result.number_of_block_misses,
+	 (uint64_t) 4 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_device_reads",
+	 replay_result.number_of_device_reads,
+	 (uint64_t) 4 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_bytes_read",
+	 replay_result.number_of_bytes_read,
+	 (uint64_t) 16384 );
+
+	/* Test error cases
+	 */
+	result = fsfat_replay_simulate(
+	          NULL,
+	          FSFAT_REPLAY_POLICY_LRU,
+	          4096,
+	          8192,
+	          0,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_LRU,
+	          0,
+	          8192,
+	          0,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_LRU,
+	          4096,
+	          8192,
+	          0,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the fsfat_replay_simulate function with reads of multiple blocks
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_replay_simulate_multiple_blocks(
+     void )
+{
+	fsfat_replay_result_t replay_result;
+	fsfat_replay_trace_t trace;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	trace.volume_size     = 1048576;
+	trace.reads           = fsfat_test_replay_simulator_reads2;
+	trace.number_of_reads = 3;
+
+	/* Test that every block of a read is counted once and that the blocks
+	 * of a read are fetched by a single device read
+	 */
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_LRU,
+	          4096,
+	          16384,
+	          0,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_read_hits",
+	 replay_result.number_of_read_hits,
+	 (uint64_t) 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_hits",
+	 replay_result.number_of_block_hits,
+	 (uint64_t) 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_misses",
+	 replay_result.number_of_block_misses,
+	 (uint64_t) 4 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_device_reads",
+	 replay_result.number_of_device_reads,
+	 (uint64_t) 2 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_bytes_read",
+	 replay_result.number_of_bytes_read,
+	 (uint64_t) 16384 );
+
+	/* Test with a read-ahead of 2 blocks, where the first read fetches
+	 * blocks 0 to 2 and the third read fetches blocks 4 to 6
+	 */
+	result = fsfat_replay_simulate(
+	          &trace,
+	          FSFAT_REPLAY_POLICY_LRU,
+	          4096,
+	          32768,
+	          8192,
+	          &replay_result,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_read_hits",
+	 replay_result.number_of_read_hits,
+	 (uint64_t) 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_hits",
+	 replay_result.number_of_block_hits,
+	 (uint64_t) 1 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_block_misses",
+	 replay_result.number_of_block_misses,
+	 (uint64_t) 4 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_device_reads",
+	 replay_result.number_of_device_reads,
+	 (uint64_t) 2 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "replay_result.number_of_bytes_read",
+	 replay_result.number_of_bytes_read,
+	 (uint64_t) 24576 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSFAT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSFAT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSFAT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSFAT_TEST_RUN(
+	 "fsfat_replay_simulate",
+	 fsfat_test_replay_simulate );
+
+	FSFAT_TEST_RUN(
+	 "fsfat_replay_simulate_multiple_blocks",
+	 fsfat_test_replay_simulate_multiple_blocks );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
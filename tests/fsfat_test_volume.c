@@ -65,6 +65,10 @@ int libfsfat_volume_open_file_io_handle(
 #define FSFAT_TEST_VOLUME_VERBOSE
  */
 
+#define FSFAT_TEST_VOLUME_WALK_MAXIMUM_DEPTH			32
+#define FSFAT_TEST_VOLUME_WALK_MAXIMUM_NUMBER_OF_PATHS		1024
+#define FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE		512
+
 /* Creates and opens a source volume
  * Returns 1 if successful or -1 on error
  */
@@ -1234,6 +1238,287 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsfat_volume_set_statistics_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_volume_set_statistics_flags(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsfat_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsfat_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_volume_set_statistics_flags(
+	          volume,
+	          LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_volume_set_statistics_flags(
+	          volume,
+	          0,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsfat_volume_set_statistics_flags(
+	          NULL,
+	          LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_volume_set_statistics_flags(
+	          volume,
+	          0xffffffffUL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsfat_volume_free(
+	          &volume,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsfat_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsfat_volume_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_volume_get_statistics(
+     libfsfat_volume_t *volume )
+{
+	libfsfat_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libfsfat_statistics_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	statistics.size = (uint32_t) sizeof( libfsfat_statistics_t );
+
+	result = libfsfat_volume_get_statistics(
+	          volume,
+	          &statistics,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "statistics.size",
+	 statistics.size,
+	 (uint32_t) sizeof( libfsfat_statistics_t ) );
+
+	/* Opening the volume reads the boot record and the allocation table
+	 */
+	FSFAT_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.number_of_read_calls",
+	 (int64_t) statistics.number_of_read_calls,
+	 (int64_t) 0 );
+
+	FSFAT_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.number_of_bytes_read",
+	 (int64_t) statistics.number_of_bytes_read,
+	 (int64_t) 0 );
+
+	/* The time is not measured unless LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME is set
+	 */
+	FSFAT_TEST_ASSERT_EQUAL_UINT32(
+	 "statistics.flags",
+	 statistics.flags,
+	 (uint32_t) 0 );
+
+	FSFAT_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.lock_wait_time",
+	 statistics.lock_wait_time,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsfat_volume_get_statistics(
+	          NULL,
+	          &statistics,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_volume_get_statistics(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	statistics.size = 0;
+
+	result = libfsfat_volume_get_statistics(
+	          volume,
+	          &statistics,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The statistics flags cannot be changed while the volume is open
+	 */
+	result = libfsfat_volume_set_statistics_flags(
+	          volume,
+	          LIBFSFAT_STATISTICS_FLAG_MEASURE_TIME,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsfat_volume_get_utf8_label_size function
  * Returns 1 if successful or 0 if not
  */
@@ -1704,32 +1989,571 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* The walk paths used by the libfsfat_volume_walk tests
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+typedef struct fsfat_test_volume_walk_paths fsfat_test_volume_walk_paths_t;
+
+struct fsfat_test_volume_walk_paths
 {
-	libbfio_handle_t *file_io_handle  = NULL;
-	libcerror_error_t *error          = NULL;
-	libfsfat_volume_t *volume         = NULL;
-	system_character_t *option_offset = NULL;
-	system_character_t *source        = NULL;
-	system_integer_t option           = 0;
-	size_t string_length              = 0;
-	off64_t volume_offset             = 0;
-	int result                        = 0;
+	/* The paths
+	 */
+	char paths[ FSFAT_TEST_VOLUME_WALK_MAXIMUM_NUMBER_OF_PATHS ][ FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE ];
 
-	while( ( option = fsfat_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "o:" ) ) ) != (system_integer_t) -1 )
+	/* The number of paths
+	 */
+	int number_of_paths;
+
+	/* The path of the current file entry
+	 */
+	char current_path[ FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE ];
+
+	/* The length of the current path per depth
+	 */
+	size_t current_path_lengths[ FSFAT_TEST_VOLUME_WALK_MAXIMUM_DEPTH ];
+};
+
+/* Appends the path of a file entry to the walk paths
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_test_volume_walk_paths_append(
+     fsfat_test_volume_walk_paths_t *walk_paths,
+     libfsfat_file_entry_t *file_entry,
+     int depth,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_test_volume_walk_paths_append";
+	size_t name_size      = 0;
+	size_t path_length    = 0;
+	int result            = 0;
+
+	if( walk_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walk paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( depth < 0 )
+	 || ( depth >= FSFAT_TEST_VOLUME_WALK_MAXIMUM_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( walk_paths->number_of_paths >= FSFAT_TEST_VOLUME_WALK_MAXIMUM_NUMBER_OF_PATHS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid walk paths - number of paths value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The root directory has no name and is represented by an empty path
+	 */
+	if( depth > 0 )
+	{
+		path_length = walk_paths->current_path_lengths[ depth - 1 ];
+
+		if( ( path_length + 2 ) >= FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid path length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		walk_paths->current_path[ path_length++ ] = '/';
+
+		result = libfsfat_file_entry_get_utf8_name_size(
+		          file_entry,
+		          &name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name size.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( name_size > 1 ) )
+		{
+			if( name_size > ( FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE - path_length ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid name size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfsfat_file_entry_get_utf8_name(
+			     file_entry,
+			     (uint8_t *) &( walk_paths->current_path[ path_length ] ),
+			     name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name.",
+				 function );
+
+				return( -1 );
+			}
+			path_length += name_size - 1;
+		}
+	}
+	walk_paths->current_path[ path_length ] = 0;
+
+	walk_paths->current_path_lengths[ depth ] = path_length;
+
+	if( narrow_string_copy(
+	     walk_paths->paths[ walk_paths->number_of_paths ],
+	     walk_paths->current_path,
+	     path_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	walk_paths->number_of_paths += 1;
+
+	return( 1 );
+}
+
+/* Callback function to collect the paths of the file entries of a walk
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_test_volume_walk_callback(
+     libfsfat_file_entry_t *file_entry,
+     int depth,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "fsfat_test_volume_walk_callback";
+
+	if( ( file_entry == NULL )
+	 || ( depth < 0 )
+	 || ( callback_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid argument.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsfat_test_volume_walk_paths_append(
+	     (fsfat_test_volume_walk_paths_t *) callback_data,
+	     file_entry,
+	     depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Collects the paths of a file entry and its sub file entries by index
+ * Returns 1 if successful or -1 on error
+ */
+int fsfat_test_volume_walk_by_index(
+     libfsfat_file_entry_t *file_entry,
+     int depth,
+     fsfat_test_volume_walk_paths_t *walk_paths,
+     libcerror_error_t **error )
+{
+	libfsfat_file_entry_t *sub_file_entry = NULL;
+	static char *function                 = "fsfat_test_volume_walk_by_index";
+	int number_of_sub_file_entries        = 0;
+	int sub_file_entry_index              = 0;
+
+	if( fsfat_test_volume_walk_paths_append(
+	     walk_paths,
+	     file_entry,
+	     depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsfat_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsfat_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( fsfat_test_volume_walk_by_index(
+		     sub_file_entry,
+		     depth + 1,
+		     walk_paths,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsfat_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsfat_volume_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int fsfat_test_volume_walk(
+     libfsfat_volume_t *volume )
+{
+	fsfat_test_volume_walk_paths_t *expected_walk_paths = NULL;
+	fsfat_test_volume_walk_paths_t *walk_paths          = NULL;
+	libcerror_error_t *error                            = NULL;
+	libfsfat_file_entry_t *root_directory               = NULL;
+	int number_of_matches                               = 0;
+	int path_index                                      = 0;
+	int result                                          = 0;
+	int sub_path_index                                  = 0;
+
+	/* Initialize test
+	 */
+	walk_paths = (fsfat_test_volume_walk_paths_t *) memory_allocate(
+	                                                 sizeof( fsfat_test_volume_walk_paths_t ) );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "walk_paths",
+	 walk_paths );
+
+	walk_paths->number_of_paths = 0;
+
+	expected_walk_paths = (fsfat_test_volume_walk_paths_t *) memory_allocate(
+	                                                          sizeof( fsfat_test_volume_walk_paths_t ) );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_walk_paths",
+	 expected_walk_paths );
+
+	expected_walk_paths->number_of_paths = 0;
+
+	result = libfsfat_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsfat_test_volume_walk_by_index(
+	          root_directory,
+	          0,
+	          expected_walk_paths,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsfat_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsfat_volume_walk(
+	          volume,
+	          &fsfat_test_volume_walk_callback,
+	          (void *) walk_paths,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSFAT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The walk should pass every file entry to the callback function exactly once
+	 * in the same order as a depth-first traversal by sub file entry index
+	 */
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_paths",
+	 walk_paths->number_of_paths,
+	 expected_walk_paths->number_of_paths );
+
+	for( path_index = 0;
+	     path_index < walk_paths->number_of_paths;
+	     path_index++ )
+	{
+		result = narrow_string_compare(
+		          walk_paths->paths[ path_index ],
+		          expected_walk_paths->paths[ path_index ],
+		          FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE );
+
+		FSFAT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_matches = 0;
+
+		for( sub_path_index = 0;
+		     sub_path_index < walk_paths->number_of_paths;
+		     sub_path_index++ )
+		{
+			if( narrow_string_compare(
+			     walk_paths->paths[ path_index ],
+			     walk_paths->paths[ sub_path_index ],
+			     FSFAT_TEST_VOLUME_WALK_MAXIMUM_PATH_SIZE ) == 0 )
+			{
+				number_of_matches++;
+			}
+		}
+		FSFAT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_matches",
+		 number_of_matches,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libfsfat_volume_walk(
+	          NULL,
+	          &fsfat_test_volume_walk_callback,
+	          (void *) walk_paths,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_volume_walk(
+	          volume,
+	          NULL,
+	          (void *) walk_paths,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsfat_volume_walk(
+	          volume,
+	          &fsfat_test_volume_walk_callback,
+	          NULL,
+	          &error );
+
+	FSFAT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSFAT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected_walk_paths );
+
+	memory_free(
+	 walk_paths );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfsfat_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( expected_walk_paths != NULL )
+	{
+		memory_free(
+		 expected_walk_paths );
+	}
+	if( walk_paths != NULL )
+	{
+		memory_free(
+		 walk_paths );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsfat_volume_t *volume         = NULL;
+	system_character_t *option_offset = NULL;
+	system_character_t *source        = NULL;
+	system_integer_t option           = 0;
+	size_t string_length              = 0;
+	off64_t volume_offset             = 0;
+	int result                        = 0;
+
+	while( ( option = fsfat_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -1788,6 +2612,10 @@ int main(
 	 "libfsfat_volume_free",
 	 fsfat_test_volume_free );
 
+	FSFAT_TEST_RUN(
+	 "libfsfat_volume_set_statistics_flags",
+	 fsfat_test_volume_set_statistics_flags );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1927,6 +2755,11 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSFAT_DLL_IMPORT ) */
 
+		FSFAT_TEST_RUN_WITH_ARGS(
+		 "libfsfat_volume_get_statistics",
+		 fsfat_test_volume_get_statistics,
+		 volume );
+
 		FSFAT_TEST_RUN_WITH_ARGS(
 		 "libfsfat_volume_get_utf8_label_size",
 		 fsfat_test_volume_get_utf8_label_size,
@@ -1956,6 +2789,11 @@ int main(
 		 fsfat_test_volume_get_root_directory,
 		 volume );
 
+		FSFAT_TEST_RUN_WITH_ARGS(
+		 "libfsfat_volume_walk",
+		 fsfat_test_volume_walk,
+		 volume );
+
 		/* Clean up
 		 */
 		result = fsfat_test_volume_close_source(
@@ -20,8 +20,11 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import io
 import os
+import struct
 import sys
+import threading
 import unittest
 
 import pyfsfat
@@ -150,6 +153,60 @@ class DataRangeFileObject(object):
     self._current_offset = offset
 
 
+def CreateFAT12Image():
+  """Creates a FAT-12 volume image with known contents.
+
+  The volume contains the file README.TXT and the directory DIR, which
+  contains the file FILE.TXT.
+
+  Returns:
+    bytes: volume image.
+  """
+  bytes_per_sector = 512
+
+  # Sector 0 contains the boot record, sectors 1 and 2 the allocation tables,
+  # sector 3 the root directory and sector 4 onwards clusters 2 onwards.
+  boot_record = bytearray(bytes_per_sector)
+  boot_record[0:3] = b"\xeb\x3c\x90"
+  boot_record[3:11] = b"MSDOS5.0"
+  struct.pack_into(
+      "<HBHBHHBHHHI", boot_record, 11, bytes_per_sector, 1, 1, 2, 16, 64,
+      0xf8, 1, 32, 2, 0)
+  boot_record[38] = 0x29
+  boot_record[510:512] = b"\x55\xaa"
+
+  # FAT-12 entries 0 and 1 are reserved and clusters 2, 3 and 4 each contain
+  # the last cluster of their chain.
+  allocation_table = bytearray(bytes_per_sector)
+  allocation_table[0:8] = b"\xf8\xff\xff\xff\xff\xff\xff\x0f"
+
+  def DirectoryEntry(name, file_attribute_flags, cluster_number, size):
+    """Creates a short name directory entry."""
+    return struct.pack(
+        "<11sBBBHHHHHHHI", name, file_attribute_flags, 0, 0, 0, 0, 0, 0, 0, 0,
+        cluster_number, size)
+
+  root_directory = bytearray(bytes_per_sector)
+  root_directory[0:64] = (
+      DirectoryEntry(b"README  TXT", 0x20, 3, 13) +
+      DirectoryEntry(b"DIR        ", 0x10, 2, 0))
+
+  sub_directory = bytearray(bytes_per_sector)
+  sub_directory[0:96] = (
+      DirectoryEntry(b".          ", 0x10, 2, 0) +
+      DirectoryEntry(b"..         ", 0x10, 0, 0) +
+      DirectoryEntry(b"FILE    TXT", 0x20, 4, 5))
+
+  readme_data = b"Known README\n".ljust(bytes_per_sector, b"\x00")
+  file_data = b"FILE\n".ljust(bytes_per_sector, b"\x00")
+
+  image_data = b"".join([
+      bytes(boot_record), bytes(allocation_table), bytes(allocation_table),
+      bytes(root_directory), bytes(sub_directory), readme_data, file_data])
+
+  return image_data.ljust(64 * bytes_per_sector, b"\x00")
+
+
 class VolumeTypeTests(unittest.TestCase):
   """Tests the volume type."""
 
@@ -213,6 +270,12 @@ class VolumeTypeTests(unittest.TestCase):
       with self.assertRaises(ValueError):
         fsfat_volume.open_file_object(file_object, mode="w")
 
+      fsfat_volume.open_file_object(file_object, read_ahead_size=4096)
+      fsfat_volume.close()
+
+      with self.assertRaises(ValueError):
+        fsfat_volume.open_file_object(file_object, read_ahead_size=1)
+
   def test_close(self):
     """Tests the close function."""
     test_source = getattr(unittest, "source", None)
@@ -306,6 +369,306 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsfat_volume.close()
 
+  def test_open_close_concurrently(self):
+    """Tests opening and closing a volume from multiple threads."""
+    image_data = CreateFAT12Image()
+
+    fsfat_volume = pyfsfat.volume()
+    errors = []
+
+    def OpenCloseVolume():
+      """Opens and closes the shared volume."""
+      for _ in range(16):
+        with io.BytesIO(image_data) as file_object:
+          try:
+            fsfat_volume.open_file_object(file_object)
+          except IOError:
+            # Another thread has the volume open.
+            continue
+
+          try:
+            root_directory = fsfat_volume.get_root_directory()
+            if root_directory.number_of_sub_file_entries != 2:
+              errors.append(root_directory.number_of_sub_file_entries)
+
+          except Exception as exception:  # pylint: disable=broad-except
+            errors.append(exception)
+
+          finally:
+            fsfat_volume.close()
+
+    threads = [threading.Thread(target=OpenCloseVolume) for _ in range(4)]
+
+    for thread in threads:
+      thread.start()
+
+    for thread in threads:
+      thread.join()
+
+    self.assertEqual(errors, [])
+
+  def test_iterate_sub_file_entries_concurrently(self):
+    """Tests iterating sub file entries from multiple threads."""
+    with io.BytesIO(CreateFAT12Image()) as file_object:
+      fsfat_volume = pyfsfat.volume()
+      fsfat_volume.open_file_object(file_object)
+
+      root_directory = fsfat_volume.get_root_directory()
+
+      # Share one sub file entries iterator between threads, each sub file
+      # entry must be yielded exactly once.
+      sub_file_entries = iter(root_directory.sub_file_entries)
+      names = []
+
+      def IterateSubFileEntries():
+        """Retrieves sub file entries from the shared iterator."""
+        for sub_file_entry in sub_file_entries:
+          names.append(sub_file_entry.name)
+
+      threads = [
+          threading.Thread(target=IterateSubFileEntries) for _ in range(4)]
+
+      for thread in threads:
+        thread.start()
+
+      for thread in threads:
+        thread.join()
+
+      self.assertEqual(sorted(names), ["DIR", "README.TXT"])
+
+      fsfat_volume.close()
+
+  def test_read_buffered(self):
+    """Tests reading file entries through io.BufferedReader."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    fsfat_volume = pyfsfat.volume()
+    fsfat_volume.open(test_source)
+
+    identifiers = [
+        walk_record[1] for walk_record in fsfat_volume.walk()
+        if not walk_record[3] & pyfsfat.file_attribute_flags.DIRECTORY]
+
+    for identifier in identifiers:
+      file_entry = fsfat_volume.get_file_entry_by_identifier(identifier)
+      expected_data = file_entry.read_buffer()
+
+      file_entry.seek_offset(0, os.SEEK_SET)
+
+      self.assertFalse(file_entry.closed)
+
+      with io.BufferedReader(file_entry, buffer_size=4096) as buffered_reader:
+        data = buffered_reader.read()
+        self.assertEqual(data, expected_data)
+
+        buffered_reader.seek(0, os.SEEK_SET)
+
+        data_buffer = bytearray(len(expected_data))
+        read_count = buffered_reader.readinto(data_buffer)
+        self.assertEqual(read_count, len(expected_data))
+        self.assertEqual(bytes(data_buffer), expected_data)
+
+      # Closing the buffered reader does not release the file entry.
+      file_entry.seek_offset(0, os.SEEK_SET)
+
+      data_buffer = bytearray(len(expected_data) + 1)
+      read_count = file_entry.readinto(data_buffer)
+      self.assertEqual(read_count, len(expected_data))
+      self.assertEqual(bytes(data_buffer[:read_count]), expected_data)
+
+    fsfat_volume.close()
+
+  def test_read_cached(self):
+    """Tests reads through the file object read cache."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    # The volume opened by path does not use the file object read cache.
+    uncached_volume = pyfsfat.volume()
+    uncached_volume.open(test_source)
+
+    identifiers = [
+        walk_record[1] for walk_record in uncached_volume.walk()
+        if not walk_record[3] & pyfsfat.file_attribute_flags.DIRECTORY]
+
+    # Overlapping ranges that start and end within and across cache blocks.
+    test_ranges = [
+        (0, 1), (1, 511), (511, 2), (300, 1000), (1000, 300), (513, 4096),
+        (4095, 4098), (8191, 1), (0, 65537), (65535, 3), (1, 262145)]
+
+    for read_ahead_size in (512, 4096, 0):
+      with open(test_source, "rb") as file_object:
+        cached_volume = pyfsfat.volume()
+        cached_volume.open_file_object(
+            file_object, read_ahead_size=read_ahead_size)
+
+        # Read the ranges forwards and backwards so that cache blocks are
+        # both reused and evicted.
+        for range_offset, range_size in test_ranges + test_ranges[::-1]:
+          for identifier in identifiers:
+            uncached_file_entry = uncached_volume.get_file_entry_by_identifier(
+                identifier)
+            expected_data = uncached_file_entry.read_buffer_at_offset(
+                range_size, range_offset)
+
+            cached_file_entry = cached_volume.get_file_entry_by_identifier(
+                identifier)
+            data = cached_file_entry.read_buffer_at_offset(
+                range_size, range_offset)
+
+            self.assertEqual(data, expected_data)
+
+        cached_volume.close()
+
+    uncached_volume.close()
+
+  def test_read_concurrently(self):
+    """Tests reading different file entries from multiple threads."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    fsfat_volume = pyfsfat.volume()
+    fsfat_volume.open(test_source)
+
+    identifiers = [
+        walk_record[1] for walk_record in fsfat_volume.walk()
+        if not walk_record[3] & pyfsfat.file_attribute_flags.DIRECTORY]
+
+    expected_data = {}
+    for identifier in identifiers:
+      file_entry = fsfat_volume.get_file_entry_by_identifier(identifier)
+      expected_data[identifier] = file_entry.read_buffer()
+
+    errors = []
+
+    def ReadFileEntries(thread_index):
+      """Reads all file entries in small blocks, starting at a thread specific
+      file entry so that the threads read different file entries at the same
+      time."""
+      try:
+        for _ in range(4):
+          for index in range(len(identifiers)):
+            identifier = identifiers[(index + thread_index) % len(identifiers)]
+            file_entry = fsfat_volume.get_file_entry_by_identifier(identifier)
+
+            data_blocks = []
+            data_block = file_entry.read_buffer(4096)
+            while data_block:
+              data_blocks.append(data_block)
+              data_block = file_entry.read_buffer(4096)
+
+            if b"".join(data_blocks) != expected_data[identifier]:
+              errors.append(identifier)
+
+      except Exception as exception:  # pylint: disable=broad-except
+        errors.append(exception)
+
+    threads = [
+        threading.Thread(target=ReadFileEntries, args=(thread_index, ))
+        for thread_index in range(8)]
+
+    for thread in threads:
+      thread.start()
+
+    for thread in threads:
+      thread.join()
+
+    fsfat_volume.close()
+
+    self.assertEqual(errors, [])
+
+  def test_walk(self):
+    """Tests the walk function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsfat_volume = pyfsfat.volume()
+      fsfat_volume.open_file_object(file_object)
+
+      root_directory = fsfat_volume.get_root_directory()
+      number_of_sub_file_entries = root_directory.get_number_of_sub_file_entries()
+
+      walk_records = list(fsfat_volume.walk())
+      self.assertGreaterEqual(len(walk_records), number_of_sub_file_entries)
+
+      for walk_record in walk_records:
+        self.assertEqual(len(walk_record), 7)
+        self.assertTrue(walk_record[0].startswith("/"))
+
+      fsfat_volume.close()
+
+  def test_walk_known_contents(self):
+    """Tests the walk function on a volume with known contents."""
+    expected_paths = sorted(["/DIR", "/DIR/FILE.TXT", "/README.TXT"])
+
+    with io.BytesIO(CreateFAT12Image()) as file_object:
+      fsfat_volume = pyfsfat.volume()
+      fsfat_volume.open_file_object(file_object)
+
+      walk_records = list(fsfat_volume.walk())
+
+      paths = sorted(walk_record[0] for walk_record in walk_records)
+      self.assertEqual(paths, expected_paths)
+
+      sizes = {walk_record[0]: walk_record[2] for walk_record in walk_records}
+      self.assertEqual(sizes["/README.TXT"], 13)
+      self.assertEqual(sizes["/DIR/FILE.TXT"], 5)
+
+      for walk_record in walk_records:
+        is_directory = bool(
+            walk_record[3] & pyfsfat.file_attribute_flags.DIRECTORY)
+        self.assertEqual(is_directory, walk_record[0] == "/DIR")
+
+        file_entry = fsfat_volume.get_file_entry_by_identifier(walk_record[1])
+        self.assertEqual(file_entry.name, walk_record[0].rsplit("/", 1)[-1])
+
+      # Share one walk iterator between threads, each record must be yielded
+      # exactly once.
+      walk_iterator = fsfat_volume.walk()
+      thread_paths = []
+
+      def WalkRecords():
+        """Retrieves walk records from the shared iterator."""
+        for walk_record in walk_iterator:
+          thread_paths.append(walk_record[0])
+
+      threads = [threading.Thread(target=WalkRecords) for _ in range(4)]
+
+      for thread in threads:
+        thread.start()
+
+      for thread in threads:
+        thread.join()
+
+      self.assertEqual(sorted(thread_paths), expected_paths)
+
+      fsfat_volume.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "allocation_table block_descriptor block_tree block_tree_node boot_record directory directory_entry error extent file_entry io_handle name notify"
+$LibraryTests = "allocation_table block_descriptor block_tree block_tree_node boot_record checksum directory directory_entry directory_parser error extent file_entry hash index io_handle name notify path_hint replay_simulator"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "offset"
 
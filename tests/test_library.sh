@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="allocation_table block_descriptor block_tree block_tree_node boot_record directory directory_entry error extent file_entry io_handle name notify";
+LIBRARY_TESTS="allocation_table block_descriptor block_tree block_tree_node boot_record checksum directory directory_entry directory_parser error extent file_entry hash index io_handle name notify path_hint replay_simulator";
 LIBRARY_TESTS_WITH_INPUT="support volume";
 OPTION_SETS=("offset");
 